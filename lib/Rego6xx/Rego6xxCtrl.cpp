@@ -34,6 +34,8 @@
  *****************************************************************************/
 #include "Rego6xxCtrl.h"
 #include "Rego6xxUtil.h"
+#include "Rego6xxTracepoint.h"
+#include <math.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -55,6 +57,17 @@
  * Local Variables
  *****************************************************************************/
 
+const uint8_t Rego6xxCtrl::LATENCY_CMD_IDS[LATENCY_CMD_COUNT] =
+{
+    CMD_ID_READ_FRONT_PANEL,
+    CMD_ID_WRITE_FRONT_PANEL,
+    CMD_ID_READ_SYSTEM_REG,
+    CMD_ID_WRITE_SYSTEM_REG,
+    CMD_ID_READ_DISPLAY,
+    CMD_ID_READ_LAST_ERROR,
+    CMD_ID_READ_REGO_VERSION
+};
+
 /******************************************************************************
  * Public Methods
  *****************************************************************************/
@@ -117,22 +130,28 @@ bool Rego6xxCtrl::toBool(uint32_t value)
 
 uint32_t Rego6xxCtrl::fromFloat(float value)
 {
-    uint32_t result     = 0U;
-    bool     isNegative = (0.0F > value) ? true : false;
+    float   tenths = value * 10.0F;
+    int16_t result = 0;
 
-    if (true == isNegative)
+    /* A value out of the register range is saturated instead of wrapped around. */
+    if (static_cast<float>(INT16_MIN) > tenths)
     {
-        value = -value;
+        result = INT16_MIN;
     }
-
-    result = static_cast<uint32_t>(value * 10.0F);
-
-    if (true == isNegative)
+    else if (static_cast<float>(INT16_MAX) < tenths)
     {
-        result = (0xFFFFU - result) + 1U;
+        result = INT16_MAX;
+    }
+    else
+    {
+        /* Round to the nearest tenth, because e.g. 21.7 may be 21.6999989 as float.
+         * lroundf() rounds half away from zero, which is symmetric for negative values.
+         */
+        result = static_cast<int16_t>(lroundf(tenths));
     }
 
-    return result;
+    /* The register holds the 16-bit two's complement. */
+    return static_cast<uint16_t>(result);
 }
 
 const Rego6xxErrorRsp* Rego6xxCtrl::readLastError()
@@ -238,8 +257,15 @@ void Rego6xxCtrl::process()
 {
     if (nullptr != m_pendingRsp)
     {
+        bool wasPending = m_pendingRsp->isPending();
+
         m_pendingRsp->receive();
 
+        if (true == wasPending)
+        {
+            measureLatency();
+        }
+
         /* Pending response complete, but error happened? */
         if (false == m_pendingRsp->isPending())
         {
@@ -248,6 +274,12 @@ void Rego6xxCtrl::process()
             {
                 clearRxBuffer();
             }
+
+            if (true == wasPending)
+            {
+                recordRspFrame();
+                traceRspComplete();
+            }
         }
     }
     else
@@ -266,6 +298,19 @@ void Rego6xxCtrl::release()
     }
 }
 
+const Rego6xxCtrl::CmdLatency* Rego6xxCtrl::getLatency(uint8_t cmdId) const
+{
+    const CmdLatency* latency = nullptr;
+    uint8_t           idx     = getLatencyIdx(cmdId);
+
+    if (LATENCY_CMD_COUNT > idx)
+    {
+        latency = &m_latencies[idx];
+    }
+
+    return latency;
+}
+
 bool Rego6xxCtrl::isPending() const
 {
     bool isPending = false;
@@ -317,9 +362,97 @@ void Rego6xxCtrl::writeCmd(uint8_t devAddr, uint8_t cmdId, uint16_t regAddr, uin
     (void)m_stream.write(cmdBuffer, CMD_SIZE);
     m_stream.flush();
 
+    /* The latencies are measured after the command is sent completely. */
+    m_cmdTimestamp        = micros();
+    m_latencyIdx          = getLatencyIdx(cmdId);
+    m_isFirstByteReceived = false;
+
+    m_frameRing.add(m_cmdTimestamp, Rego6xxTrace::DIR_TX, cmdBuffer, CMD_SIZE);
+
+    EVENT_TRACE_BEGIN(Rego6xxTracepoint::ID_CMD, cmdId);
+
     return;
 }
 
+uint8_t Rego6xxCtrl::getLatencyIdx(uint8_t cmdId)
+{
+    uint8_t idx = 0U;
+
+    while ((LATENCY_CMD_COUNT > idx) && (cmdId != LATENCY_CMD_IDS[idx]))
+    {
+        ++idx;
+    }
+
+    return idx;
+}
+
+void Rego6xxCtrl::measureLatency()
+{
+    if (LATENCY_CMD_COUNT > m_latencyIdx)
+    {
+        CmdLatency& latency = m_latencies[m_latencyIdx];
+        uint32_t    elapsed = micros() - m_cmdTimestamp;
+
+        /* The response is read at once, therefore the first byte is either
+         * still in the receive buffer or the response is complete.
+         */
+        if ((false == m_isFirstByteReceived) &&
+            ((0 < m_stream.available()) ||
+             ((false == m_pendingRsp->isPending()) && (false == m_pendingRsp->isTimeout()))))
+        {
+            m_isFirstByteReceived = true;
+            latency.firstByte.add(elapsed);
+        }
+
+        /* Only a valid response counts, a timeout would distort the latency. */
+        if ((false == m_pendingRsp->isPending()) &&
+            (false == m_pendingRsp->isTimeout()) &&
+            (true == m_pendingRsp->isValid()))
+        {
+            latency.complete.add(elapsed);
+        }
+    }
+}
+
+void Rego6xxCtrl::recordRspFrame()
+{
+    if (true == m_frameRing.isEnabled())
+    {
+        uint8_t* buffer = nullptr;
+        size_t   size   = 0U;
+
+        /* The response buffer is cleared on timeout, therefore only the event is recorded. */
+        if (false == m_pendingRsp->isTimeout())
+        {
+            m_pendingRsp->getResponse(buffer, size);
+        }
+
+        m_frameRing.add(micros(), Rego6xxTrace::DIR_RX, buffer, size);
+    }
+}
+
+void Rego6xxCtrl::traceRspComplete()
+{
+#ifdef EVENT_TRACE_SIZE
+    Rego6xxTracepoint::RspStatus status = Rego6xxTracepoint::RSP_STATUS_VALID;
+
+    if (true == m_pendingRsp->isTimeout())
+    {
+        status = Rego6xxTracepoint::RSP_STATUS_TIMEOUT;
+    }
+    else if (false == m_pendingRsp->isValid())
+    {
+        status = Rego6xxTracepoint::RSP_STATUS_INVALID;
+    }
+    else
+    {
+        ;
+    }
+
+    EVENT_TRACE_END(Rego6xxTracepoint::ID_CMD, status);
+#endif /* EVENT_TRACE_SIZE */
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -47,6 +47,8 @@
 #include "Rego6xxErrorRsp.h"
 #include "Rego6xxBoolRsp.h"
 #include "Rego6xxDisplayRsp.h"
+#include "Rego6xxFrameRing.h"
+#include "Histogram.hpp"
 
 /******************************************************************************
  * Macros
@@ -168,6 +170,21 @@ public:
         DISPLAY_ROW_4 = 0x03  /**< Row 4 */
     };
 
+    /**
+     * Latency histogram in us, which resolves up to the response timeout.
+     */
+    typedef Histogram<3U, 22U> LatencyHistogram;
+
+    /**
+     * Response latencies of a command, measured from the end of sending
+     * the command.
+     */
+    struct CmdLatency
+    {
+        LatencyHistogram firstByte; /**< Latency until the first response byte is received in us. */
+        LatencyHistogram complete;  /**< Latency until the response is completely received in us. */
+    };
+
     /**
      * Constructs the Rego6xx controller.
      *
@@ -180,7 +197,12 @@ public:
         m_confirmRsp(stream),
         m_errorRsp(stream),
         m_boolRsp(stream),
-        m_displayRsp(stream)
+        m_displayRsp(stream),
+        m_latencies(),
+        m_cmdTimestamp(0U),
+        m_latencyIdx(LATENCY_CMD_COUNT),
+        m_isFirstByteReceived(false),
+        m_frameRing()
     {
         m_stream.setTimeout(20U);
         clearRxBuffer();
@@ -233,7 +255,8 @@ public:
     bool toBool(uint32_t value);
 
     /**
-     * Convert float to 16 bit value.
+     * Convert float to 16 bit value. The value is rounded to the nearest tenth
+     * and saturated to the signed 16-bit range.
      *
      * @param[in] value The float value, which should be converted to a 16-bit value.
      *
@@ -298,6 +321,37 @@ public:
      */
     bool isPending() const;
 
+    /**
+     * Get the response latencies of a command.
+     * Only the commands 0x00, 0x01, 0x02, 0x03, 0x20, 0x40 and 0x7f are measured.
+     *
+     * @param[in] cmdId Command id
+     *
+     * @return Response latencies or nullptr, if the command is not measured.
+     */
+    const CmdLatency* getLatency(uint8_t cmdId) const;
+
+    /**
+     * Get the ring with the latest protocol frames.
+     * It is disabled until its memory is allocated.
+     *
+     * @return Frame ring
+     */
+    Rego6xxFrameRing& getFrameRing()
+    {
+        return m_frameRing;
+    }
+
+    /**
+     * Get the ring with the latest protocol frames.
+     *
+     * @return Frame ring
+     */
+    const Rego6xxFrameRing& getFrameRing() const
+    {
+        return m_frameRing;
+    }
+
     /** Device address of heat pump controller */
     static const uint8_t DEV_ADDR_HEATPUMP = 0x81;
 
@@ -309,13 +363,24 @@ public:
 
 private:
 
-    Stream&           m_stream;     /**< Input/Output stream to heatpump controller. */
-    Rego6xxRsp*       m_pendingRsp; /**< Current pending response */
-    Rego6xxStdRsp     m_stdRsp;     /**< Standard response */
-    Rego6xxConfirmRsp m_confirmRsp; /**< Confirmation response */
-    Rego6xxErrorRsp   m_errorRsp;   /**< Error log response */
-    Rego6xxBoolRsp    m_boolRsp;    /**< Boolean response */
-    Rego6xxDisplayRsp m_displayRsp; /**< Display response */
+    /** Number of commands, whose latencies are measured. */
+    static const uint8_t LATENCY_CMD_COUNT = 7U;
+
+    /** Commands, whose latencies are measured. */
+    static const uint8_t LATENCY_CMD_IDS[LATENCY_CMD_COUNT];
+
+    Stream&           m_stream;                       /**< Input/Output stream to heatpump controller. */
+    Rego6xxRsp*       m_pendingRsp;                   /**< Current pending response */
+    Rego6xxStdRsp     m_stdRsp;                       /**< Standard response */
+    Rego6xxConfirmRsp m_confirmRsp;                   /**< Confirmation response */
+    Rego6xxErrorRsp   m_errorRsp;                     /**< Error log response */
+    Rego6xxBoolRsp    m_boolRsp;                      /**< Boolean response */
+    Rego6xxDisplayRsp m_displayRsp;                   /**< Display response */
+    CmdLatency        m_latencies[LATENCY_CMD_COUNT]; /**< Response latencies per measured command. */
+    uint32_t          m_cmdTimestamp;                 /**< Timestamp in us, when the pending command was sent. */
+    uint8_t           m_latencyIdx;                   /**< Latency index of the pending command or LATENCY_CMD_COUNT if not measured. */
+    bool              m_isFirstByteReceived;          /**< Is the first response byte of the pending command received? */
+    Rego6xxFrameRing  m_frameRing;                    /**< Latest protocol frames */
 
     Rego6xxCtrl();
 
@@ -338,6 +403,31 @@ private:
      * @param[in] data      Command data
      */
     void writeCmd(uint8_t devAddr, uint8_t cmdId, uint16_t regAddr, uint32_t data);
+
+    /**
+     * Get the latency index of a command.
+     *
+     * @param[in] cmdId Command id
+     *
+     * @return Latency index or LATENCY_CMD_COUNT if the command is not measured.
+     */
+    static uint8_t getLatencyIdx(uint8_t cmdId);
+
+    /**
+     * Measure the latencies of the pending response.
+     */
+    void measureLatency();
+
+    /**
+     * Trace the completion of the pending response with its status.
+     */
+    void traceRspComplete();
+
+    /**
+     * Record the frame of the completed pending response.
+     * A timeout is recorded as empty frame.
+     */
+    void recordRspFrame();
 };
 
 #endif /* __REGO6XX_CTRL_H__ */
@@ -0,0 +1,233 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Rego6xx frame ring
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "Rego6xxFrameRing.h"
+#include <new>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool Rego6xxFrameRing::allocate(size_t capacity)
+{
+    bool   isSuccessful = false;
+    size_t powerOfTwo   = 1U;
+
+    release();
+
+    while ((powerOfTwo * 2U) <= capacity)
+    {
+        powerOfTwo *= 2U;
+    }
+
+    /* At least the largest record shall fit. */
+    if ((Rego6xxTrace::RECORD_HEADER_SIZE + Rego6xxTrace::RECORD_DATA_MAX) <= powerOfTwo)
+    {
+        m_buffer = new (std::nothrow) uint8_t[powerOfTwo];
+
+        if (nullptr != m_buffer)
+        {
+            m_capacity   = powerOfTwo;
+            isSuccessful = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+void Rego6xxFrameRing::release()
+{
+    if (nullptr != m_buffer)
+    {
+        delete[] m_buffer;
+        m_buffer = nullptr;
+    }
+
+    m_capacity    = 0U;
+    m_head        = 0U;
+    m_tail        = 0U;
+    m_frames      = 0U;
+    m_overwritten = 0U;
+}
+
+void Rego6xxFrameRing::add(uint32_t timestamp, Rego6xxTrace::Direction dir, const uint8_t* data, size_t size)
+{
+    if (nullptr != m_buffer)
+    {
+        uint8_t header[Rego6xxTrace::RECORD_HEADER_SIZE];
+        size_t  recordSize = 0U;
+
+        if (nullptr == data)
+        {
+            size = 0U;
+        }
+        else if (Rego6xxTrace::RECORD_DATA_MAX < size)
+        {
+            size = Rego6xxTrace::RECORD_DATA_MAX;
+        }
+        else
+        {
+            ;
+        }
+
+        recordSize = Rego6xxTrace::RECORD_HEADER_SIZE + size;
+
+        /* Free the space of the oldest records, before they are overwritten. */
+        while ((m_head + recordSize - m_tail) > m_capacity)
+        {
+            m_tail = m_tail + getRecordSize(m_tail);
+            ++m_overwritten;
+        }
+
+        Rego6xxTrace::encodeRecordHeader(header, timestamp, dir, size);
+        copyIn(m_head, header, Rego6xxTrace::RECORD_HEADER_SIZE);
+        copyIn(m_head + Rego6xxTrace::RECORD_HEADER_SIZE, data, size);
+
+        /* The record becomes visible to a reader not before it is complete. */
+        m_head = m_head + recordSize;
+        ++m_frames;
+    }
+}
+
+size_t Rego6xxFrameRing::read(uint32_t& pos, uint32_t end, uint8_t* buffer, size_t size) const
+{
+    size_t copied = 0U;
+    bool   isFull = false;
+
+    while ((nullptr != m_buffer) &&
+           (false == isFull) &&
+           (0 < static_cast<int32_t>(end - pos)))
+    {
+        if (true == isOverwritten(pos))
+        {
+            pos = m_tail;
+        }
+        else
+        {
+            size_t recordSize = getRecordSize(pos);
+
+            if ((size - copied) < recordSize)
+            {
+                /* The record size is only reliable, if the record is still valid. */
+                if (false == isOverwritten(pos))
+                {
+                    isFull = true;
+                }
+            }
+            else
+            {
+                copyOut(pos, &buffer[copied], recordSize);
+
+                /* Discard the copy, if the record was overwritten meanwhile. */
+                if (false == isOverwritten(pos))
+                {
+                    copied += recordSize;
+                    pos    += recordSize;
+                }
+            }
+        }
+    }
+
+    return copied;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void Rego6xxFrameRing::copyIn(uint32_t pos, const uint8_t* data, size_t size)
+{
+    size_t offset = pos & (m_capacity - 1U);
+    size_t first  = m_capacity - offset;
+
+    if (first > size)
+    {
+        first = size;
+    }
+
+    if (0U < size)
+    {
+        memcpy(&m_buffer[offset], data, first);
+        memcpy(m_buffer, &data[first], size - first);
+    }
+}
+
+void Rego6xxFrameRing::copyOut(uint32_t pos, uint8_t* buffer, size_t size) const
+{
+    size_t offset = pos & (m_capacity - 1U);
+    size_t first  = m_capacity - offset;
+
+    if (first > size)
+    {
+        first = size;
+    }
+
+    if (0U < size)
+    {
+        memcpy(buffer, &m_buffer[offset], first);
+        memcpy(&buffer[first], m_buffer, size - first);
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
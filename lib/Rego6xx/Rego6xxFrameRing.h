@@ -0,0 +1,245 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Rego6xx frame ring
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @{
+ */
+
+#ifndef __REGO6XX_FRAME_RING_H__
+#define __REGO6XX_FRAME_RING_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <Arduino.h>
+#include "Rego6xxTrace.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * RAM ring buffer, which keeps the latest frames in the Rego6xx trace record
+ * format. The oldest frames are overwritten, therefore it can stay enabled
+ * permanently. Adding a frame copies only its bytes, no formatting is done.
+ *
+ * The frames are added by the main loop and can be read by another task
+ * concurrently. The positions are monotonic byte counters. The tail is
+ * moved before a record is overwritten, therefore a reader detects that a
+ * copied record became invalid and continues with the oldest one.
+ */
+class Rego6xxFrameRing
+{
+public:
+
+    /**
+     * Constructs a frame ring without memory.
+     */
+    Rego6xxFrameRing() :
+        m_buffer(nullptr),
+        m_capacity(0U),
+        m_head(0U),
+        m_tail(0U),
+        m_frames(0U),
+        m_overwritten(0U)
+    {
+    }
+
+    /**
+     * Destroys the frame ring.
+     */
+    ~Rego6xxFrameRing()
+    {
+        release();
+    }
+
+    /**
+     * Allocate the ring memory. The capacity is rounded down to a power of
+     * two, which keeps the positions right when they wrap around.
+     *
+     * @param[in] capacity  Ring capacity in byte
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool allocate(size_t capacity);
+
+    /**
+     * Release the ring memory.
+     */
+    void release();
+
+    /**
+     * Is the ring enabled, i.e. is memory allocated?
+     *
+     * @return If enabled, it will return true otherwise false.
+     */
+    bool isEnabled() const
+    {
+        return (nullptr != m_buffer);
+    }
+
+    /**
+     * Add a frame. Frames with more than Rego6xxTrace::RECORD_DATA_MAX bytes
+     * are truncated.
+     *
+     * @param[in] timestamp Timestamp in us
+     * @param[in] dir       Transfer direction
+     * @param[in] data      Frame data, may be nullptr if size is 0.
+     * @param[in] size      Frame size in byte
+     */
+    void add(uint32_t timestamp, Rego6xxTrace::Direction dir, const uint8_t* data, size_t size);
+
+    /**
+     * Get the position after the latest frame.
+     *
+     * @return Head position
+     */
+    uint32_t getHead() const
+    {
+        return m_head;
+    }
+
+    /**
+     * Get the position of the oldest frame.
+     *
+     * @return Tail position
+     */
+    uint32_t getTail() const
+    {
+        return m_tail;
+    }
+
+    /**
+     * Copy whole records from the given position on, until the end
+     * position is reached or the next record doesn't fit into the buffer.
+     * If the position was overwritten meanwhile, it continues with the
+     * oldest record.
+     *
+     * @param[in,out] pos       Read position, which is advanced.
+     * @param[in]     end       End position, e.g. the head at the start of the download.
+     * @param[out]    buffer    Buffer, which to fill
+     * @param[in]     size      Buffer size in byte
+     *
+     * @return Number of copied bytes
+     */
+    size_t read(uint32_t& pos, uint32_t end, uint8_t* buffer, size_t size) const;
+
+    /**
+     * Get the number of frames, which were added.
+     *
+     * @return Number of frames
+     */
+    uint32_t getFrames() const
+    {
+        return m_frames;
+    }
+
+    /**
+     * Get the number of frames, which were overwritten.
+     *
+     * @return Number of overwritten frames
+     */
+    uint32_t getOverwritten() const
+    {
+        return m_overwritten;
+    }
+
+private:
+
+    uint8_t*          m_buffer;      /**< Ring memory */
+    size_t            m_capacity;    /**< Ring capacity in byte, a power of two. */
+    volatile uint32_t m_head;        /**< Position after the latest record. */
+    volatile uint32_t m_tail;        /**< Position of the oldest record. */
+    uint32_t          m_frames;      /**< Number of added frames */
+    uint32_t          m_overwritten; /**< Number of overwritten frames */
+
+    Rego6xxFrameRing(const Rego6xxFrameRing& other);
+    Rego6xxFrameRing& operator=(const Rego6xxFrameRing& other);
+
+    /**
+     * Is the position older than the tail, i.e. already overwritten?
+     *
+     * @param[in] pos   Position
+     *
+     * @return If overwritten, it will return true otherwise false.
+     */
+    bool isOverwritten(uint32_t pos) const
+    {
+        /* The signed difference is right, even if the positions wrap around. */
+        return (0 > static_cast<int32_t>(pos - m_tail));
+    }
+
+    /**
+     * Get the size of the record at the given position.
+     *
+     * @param[in] pos   Record position
+     *
+     * @return Record size in byte incl. its header.
+     */
+    size_t getRecordSize(uint32_t pos) const
+    {
+        uint8_t info = m_buffer[(pos + Rego6xxTrace::RECORD_HEADER_SIZE - 1U) & (m_capacity - 1U)];
+
+        return Rego6xxTrace::RECORD_HEADER_SIZE + (info & Rego6xxTrace::RECORD_DATA_MAX);
+    }
+
+    /**
+     * Copy data into the ring.
+     *
+     * @param[in] pos   Position
+     * @param[in] data  Data
+     * @param[in] size  Data size in byte
+     */
+    void copyIn(uint32_t pos, const uint8_t* data, size_t size);
+
+    /**
+     * Copy data out of the ring.
+     *
+     * @param[in]  pos      Position
+     * @param[out] buffer   Buffer
+     * @param[in]  size     Data size in byte
+     */
+    void copyOut(uint32_t pos, uint8_t* buffer, size_t size) const;
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* __REGO6XX_FRAME_RING_H__ */
+
+/** @} */
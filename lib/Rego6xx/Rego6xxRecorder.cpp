@@ -0,0 +1,248 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Rego6xx UART traffic recorder
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "Rego6xxRecorder.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+void Rego6xxRecorder::setSink(Print* sink)
+{
+    flushRecord();
+
+    m_sink = sink;
+
+    if (nullptr != m_sink)
+    {
+        (void)Rego6xxTrace::writeHeader(*m_sink);
+    }
+}
+
+void Rego6xxRecorder::flushRecord()
+{
+    if (true == m_isRecordOpen)
+    {
+        if (nullptr != m_sink)
+        {
+            (void)Rego6xxTrace::writeRecord(*m_sink, m_recordTimestamp, m_recordDir, m_record, m_recordSize);
+        }
+
+        m_isRecordOpen = false;
+        m_recordSize   = 0U;
+    }
+}
+
+int Rego6xxRecorder::available()
+{
+    int available = m_stream.available();
+
+    /* The receive record starts as soon as the first byte is seen, not
+     * when the controller consumes it. Otherwise the timestamp would
+     * contain the response timeout polling of the controller.
+     */
+    if ((nullptr != m_sink) &&
+        (0 < available))
+    {
+        openRecord(Rego6xxTrace::DIR_RX);
+    }
+
+    return available;
+}
+
+int Rego6xxRecorder::read()
+{
+    int data = m_stream.read();
+
+    if (0 <= data)
+    {
+        count(Rego6xxTrace::DIR_RX, 1U);
+
+        if (nullptr != m_sink)
+        {
+            append(Rego6xxTrace::DIR_RX, static_cast<uint8_t>(data));
+        }
+    }
+
+    return data;
+}
+
+int Rego6xxRecorder::peek()
+{
+    return m_stream.peek();
+}
+
+size_t Rego6xxRecorder::write(uint8_t data)
+{
+    size_t written = m_stream.write(data);
+
+    if (0U < written)
+    {
+        count(Rego6xxTrace::DIR_TX, written);
+
+        if (nullptr != m_sink)
+        {
+            append(Rego6xxTrace::DIR_TX, data);
+        }
+    }
+
+    return written;
+}
+
+size_t Rego6xxRecorder::write(const uint8_t* buffer, size_t size)
+{
+    size_t written = m_stream.write(buffer, size);
+
+    if (0U < written)
+    {
+        count(Rego6xxTrace::DIR_TX, written);
+    }
+
+    if (nullptr != m_sink)
+    {
+        size_t idx = 0U;
+
+        while (written > idx)
+        {
+            append(Rego6xxTrace::DIR_TX, buffer[idx]);
+            ++idx;
+        }
+    }
+
+    return written;
+}
+
+void Rego6xxRecorder::flush()
+{
+    /* A flush finishes a command, which is a good point to write the record. */
+    if (Rego6xxTrace::DIR_TX == m_recordDir)
+    {
+        flushRecord();
+    }
+
+    m_isTxFrameOpen = false;
+
+    m_stream.flush();
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void Rego6xxRecorder::openRecord(Rego6xxTrace::Direction dir)
+{
+    if ((true == m_isRecordOpen) &&
+        (dir != m_recordDir))
+    {
+        flushRecord();
+    }
+
+    if (false == m_isRecordOpen)
+    {
+        m_isRecordOpen    = true;
+        m_recordDir       = dir;
+        m_recordTimestamp = micros();
+        m_recordSize      = 0U;
+    }
+}
+
+void Rego6xxRecorder::append(Rego6xxTrace::Direction dir, uint8_t data)
+{
+    openRecord(dir);
+
+    m_record[m_recordSize] = data;
+    ++m_recordSize;
+
+    if (Rego6xxTrace::RECORD_DATA_MAX <= m_recordSize)
+    {
+        flushRecord();
+    }
+}
+
+void Rego6xxRecorder::count(Rego6xxTrace::Direction dir, size_t size)
+{
+    if (Rego6xxTrace::DIR_TX == dir)
+    {
+        if (false == m_isTxFrameOpen)
+        {
+            m_isTxFrameOpen = true;
+            ++m_txFrames;
+        }
+
+        m_isRxFrameOpen  = false;
+        m_txBytes       += size;
+    }
+    else
+    {
+        if (false == m_isRxFrameOpen)
+        {
+            m_isRxFrameOpen = true;
+            ++m_rxFrames;
+        }
+
+        m_rxBytes += size;
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,245 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Rego6xx UART traffic recorder
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @{
+ */
+
+#ifndef __REGO6XX_RECORDER_H__
+#define __REGO6XX_RECORDER_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <Arduino.h>
+#include "Rego6xxTrace.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Records the traffic of a stream in the Rego6xx trace format.
+ * It is placed between the Rego6xx controller and the stream to the heatpump
+ * and passes all data through. Without a sink, nothing is recorded, but the
+ * traffic is always counted.
+ */
+class Rego6xxRecorder : public Stream
+{
+public:
+
+    /**
+     * Constructs the recorder.
+     *
+     * @param[in] stream    Stream to the heatpump controller, which to record.
+     */
+    Rego6xxRecorder(Stream& stream) :
+        m_stream(stream),
+        m_sink(nullptr),
+        m_isRecordOpen(false),
+        m_recordDir(Rego6xxTrace::DIR_TX),
+        m_recordTimestamp(0U),
+        m_recordSize(0U),
+        m_record(),
+        m_isTxFrameOpen(false),
+        m_isRxFrameOpen(false),
+        m_txFrames(0U),
+        m_txBytes(0U),
+        m_rxFrames(0U),
+        m_rxBytes(0U)
+    {
+    }
+
+    /**
+     * Destroys the recorder.
+     */
+    ~Rego6xxRecorder()
+    {
+    }
+
+    /**
+     * Set the sink, where the trace is written to. The file header is written
+     * immediately. Set it to nullptr to stop recording.
+     *
+     * @param[in] sink  Trace sink
+     */
+    void setSink(Print* sink);
+
+    /**
+     * Write the currently collected record to the sink. Call it before the
+     * trace is evaluated, otherwise the last record may be missing.
+     */
+    void flushRecord();
+
+    /**
+     * Get the number of frames sent to the heatpump. A frame is a sequence
+     * of data bytes, which is finished by a flush.
+     *
+     * @return Number of sent frames
+     */
+    uint32_t getTxFrames() const
+    {
+        return m_txFrames;
+    }
+
+    /**
+     * Get the number of data bytes sent to the heatpump.
+     *
+     * @return Number of sent data bytes
+     */
+    uint32_t getTxBytes() const
+    {
+        return m_txBytes;
+    }
+
+    /**
+     * Get the number of frames received from the heatpump. A frame is a
+     * sequence of data bytes between two sent frames.
+     *
+     * @return Number of received frames
+     */
+    uint32_t getRxFrames() const
+    {
+        return m_rxFrames;
+    }
+
+    /**
+     * Get the number of data bytes received from the heatpump.
+     *
+     * @return Number of received data bytes
+     */
+    uint32_t getRxBytes() const
+    {
+        return m_rxBytes;
+    }
+
+    /**
+     * Get the number of available data.
+     *
+     * @return Number of byte which are available
+     */
+    int available() override;
+
+    /**
+     * Read a single data byte.
+     *
+     * @return Single data byte or -1 if no byte is available.
+     */
+    int read() override;
+
+    /**
+     * Read a single data byte, but without increasing the internal read position.
+     *
+     * @return Single data byte or -1 if no byte is available.
+     */
+    int peek() override;
+
+    /**
+     * Write a single data byte.
+     *
+     * @param[in] data  Single data byte
+     *
+     * @return Number of written data byte
+     */
+    size_t write(uint8_t data) override;
+
+    /**
+     * Write several data bytes.
+     *
+     * @param[in] buffer    Data buffer
+     * @param[in] size      Data buffer size in byte
+     *
+     * @return Number of written data byte
+     */
+    size_t write(const uint8_t* buffer, size_t size) override;
+
+    /**
+     * Flush the output buffer.
+     */
+    void flush() override;
+
+private:
+
+    Stream&                 m_stream;                                /**< Recorded stream to heatpump controller. */
+    Print*                  m_sink;                                  /**< Trace sink. */
+    bool                    m_isRecordOpen;                          /**< Is a record collecting data? */
+    Rego6xxTrace::Direction m_recordDir;                             /**< Direction of the open record. */
+    uint32_t                m_recordTimestamp;                       /**< Timestamp of the open record in us. */
+    size_t                  m_recordSize;                            /**< Number of collected data bytes of the open record. */
+    uint8_t                 m_record[Rego6xxTrace::RECORD_DATA_MAX]; /**< Collected data bytes of the open record. */
+    bool                    m_isTxFrameOpen;                         /**< Is a sent frame not finished yet? */
+    bool                    m_isRxFrameOpen;                         /**< Is a received frame not finished yet? */
+    uint32_t                m_txFrames;                              /**< Number of sent frames */
+    uint32_t                m_txBytes;                               /**< Number of sent data bytes */
+    uint32_t                m_rxFrames;                              /**< Number of received frames */
+    uint32_t                m_rxBytes;                               /**< Number of received data bytes */
+
+    Rego6xxRecorder();
+
+    /**
+     * Open a record in the given direction. An open record in the other
+     * direction is written to the sink before.
+     *
+     * @param[in] dir   Transfer direction
+     */
+    void openRecord(Rego6xxTrace::Direction dir);
+
+    /**
+     * Append a data byte to the open record.
+     *
+     * @param[in] dir   Transfer direction
+     * @param[in] data  Data byte
+     */
+    void append(Rego6xxTrace::Direction dir, uint8_t data);
+
+    /**
+     * Count transferred data bytes. The first data bytes in a direction
+     * start a new frame.
+     *
+     * @param[in] dir   Transfer direction
+     * @param[in] size  Number of data bytes
+     */
+    void count(Rego6xxTrace::Direction dir, size_t size);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* __REGO6XX_RECORDER_H__ */
+
+/** @} */
@@ -0,0 +1,282 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Rego6xx UART traffic replay
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "Rego6xxReplay.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool Rego6xxReplay::begin()
+{
+    bool isValid = Rego6xxTrace::isHeaderValid(m_trace, m_size);
+
+    m_pos          = (true == isValid) ? Rego6xxTrace::HEADER_SIZE : m_size;
+    m_txIdx        = 0U;
+    m_isTxOpen     = false;
+    m_isTxMismatch = false;
+    m_rxIdx        = 0U;
+    m_isRxLoaded   = false;
+    m_traceRef     = 0U;
+    m_timeRef      = micros();
+    m_commands     = 0U;
+    m_mismatches   = 0U;
+
+    if (true == isValid)
+    {
+        Rego6xxTrace::Record record;
+
+        /* A trace may start with a response, which is related to the first record. */
+        if (0U < peekRecord(record))
+        {
+            m_traceRef = record.timestamp;
+        }
+    }
+
+    return isValid;
+}
+
+int Rego6xxReplay::available()
+{
+    int available = 0;
+
+    loadResponse();
+
+    if (true == m_isRxLoaded)
+    {
+        available = static_cast<int>(m_rxRecord.size - m_rxIdx);
+    }
+
+    return available;
+}
+
+int Rego6xxReplay::read()
+{
+    int data = -1;
+
+    loadResponse();
+
+    if (true == m_isRxLoaded)
+    {
+        data = m_rxRecord.data[m_rxIdx];
+        ++m_rxIdx;
+
+        if (m_rxRecord.size <= m_rxIdx)
+        {
+            m_isRxLoaded = false;
+        }
+    }
+
+    return data;
+}
+
+int Rego6xxReplay::peek()
+{
+    int data = -1;
+
+    loadResponse();
+
+    if (true == m_isRxLoaded)
+    {
+        data = m_rxRecord.data[m_rxIdx];
+    }
+
+    return data;
+}
+
+size_t Rego6xxReplay::write(uint8_t data)
+{
+    if (false == m_isTxOpen)
+    {
+        openCommand();
+    }
+
+    if ((m_txRecord.size <= m_txIdx) ||
+        (data != m_txRecord.data[m_txIdx]))
+    {
+        if (false == m_isTxMismatch)
+        {
+            m_isTxMismatch = true;
+            ++m_mismatches;
+        }
+    }
+
+    ++m_txIdx;
+
+    /* The response timing is related to the end of the command. */
+    if (m_txRecord.size == m_txIdx)
+    {
+        m_isTxOpen = false;
+        m_timeRef  = micros();
+    }
+
+    return 1U;
+}
+
+void Rego6xxReplay::flush()
+{
+    if (true == m_isTxOpen)
+    {
+        /* Command is shorter than the recorded one. */
+        if (false == m_isTxMismatch)
+        {
+            m_isTxMismatch = true;
+            ++m_mismatches;
+        }
+
+        m_isTxOpen = false;
+        m_timeRef  = micros();
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+size_t Rego6xxReplay::peekRecord(Rego6xxTrace::Record& record) const
+{
+    size_t recordSize = 0U;
+
+    if ((nullptr != m_trace) &&
+        (m_size > m_pos))
+    {
+        recordSize = Rego6xxTrace::parseRecord(&m_trace[m_pos], m_size - m_pos, record);
+    }
+
+    return recordSize;
+}
+
+void Rego6xxReplay::openCommand()
+{
+    Rego6xxTrace::Record record;
+    size_t               recordSize = peekRecord(record);
+
+    /* Skip responses, which the controller didn't wait for. */
+    while ((0U < recordSize) &&
+           (Rego6xxTrace::DIR_RX == record.dir))
+    {
+        m_pos      += recordSize;
+        recordSize  = peekRecord(record);
+    }
+
+    m_isRxLoaded   = false;
+    m_isTxOpen     = true;
+    m_isTxMismatch = false;
+    m_txIdx        = 0U;
+    ++m_commands;
+
+    if (0U < recordSize)
+    {
+        m_txRecord  = record;
+        m_traceRef  = record.timestamp;
+        m_pos      += recordSize;
+    }
+    else
+    {
+        /* Trace is finished, every further command is unexpected. */
+        m_txRecord.timestamp = m_traceRef;
+        m_txRecord.dir       = Rego6xxTrace::DIR_TX;
+        m_txRecord.size      = 0U;
+        m_txRecord.data      = nullptr;
+    }
+}
+
+void Rego6xxReplay::loadResponse()
+{
+    Rego6xxTrace::Record record;
+
+    if ((false == m_isRxLoaded) &&
+        (false == m_isTxOpen))
+    {
+        size_t recordSize = peekRecord(record);
+
+        if ((0U < recordSize) &&
+            (Rego6xxTrace::DIR_RX == record.dir))
+        {
+            bool isDue = true;
+
+            if (0U < m_speed)
+            {
+                /* The recorded timestamp of the command is the time of its
+                 * first byte, but the reference time is taken after its last
+                 * byte. Therefore the response may be provided a little bit
+                 * later than recorded, which is less than one byte time.
+                 */
+                uint32_t traceDelay = (record.timestamp - m_traceRef) / m_speed;
+                uint32_t delay      = micros() - m_timeRef;
+
+                isDue = (traceDelay <= delay);
+            }
+
+            if (true == isDue)
+            {
+                m_rxRecord    = record;
+                m_rxIdx       = 0U;
+                m_isRxLoaded  = true;
+                m_pos        += recordSize;
+            }
+        }
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,239 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Rego6xx UART traffic replay
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @{
+ */
+
+#ifndef __REGO6XX_REPLAY_H__
+#define __REGO6XX_REPLAY_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <Arduino.h>
+#include "Rego6xxTrace.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Replays a recorded trace to the Rego6xx controller.
+ * It takes the place of the heatpump: every command written by the controller
+ * is compared with the next recorded command and the recorded response is
+ * provided with the recorded delay, divided by the speed factor.
+ */
+class Rego6xxReplay : public Stream
+{
+public:
+
+    /**
+     * Constructs the replay.
+     *
+     * @param[in] trace Recorded trace, incl. file header.
+     * @param[in] size  Trace size in byte
+     */
+    Rego6xxReplay(const uint8_t* trace, size_t size) :
+        m_trace(trace),
+        m_size(size),
+        m_pos(0U),
+        m_speed(1U),
+        m_txRecord(),
+        m_txIdx(0U),
+        m_isTxOpen(false),
+        m_isTxMismatch(false),
+        m_rxRecord(),
+        m_rxIdx(0U),
+        m_isRxLoaded(false),
+        m_traceRef(0U),
+        m_timeRef(0U),
+        m_commands(0U),
+        m_mismatches(0U)
+    {
+    }
+
+    /**
+     * Destroys the replay.
+     */
+    ~Rego6xxReplay()
+    {
+    }
+
+    /**
+     * Start replaying from the begin of the trace.
+     *
+     * @return If the trace is valid, it will return true otherwise false.
+     */
+    bool begin();
+
+    /**
+     * Set the recorded trace, which is replayed after the next begin().
+     *
+     * @param[in] trace Recorded trace, incl. file header.
+     * @param[in] size  Trace size in byte
+     */
+    void setTrace(const uint8_t* trace, size_t size)
+    {
+        m_trace = trace;
+        m_size  = size;
+    }
+
+    /**
+     * Set the speed factor. 1 replays with the original timing, a factor of
+     * N replays N times faster and 0 provides every response immediately.
+     *
+     * @param[in] speed Speed factor
+     */
+    void setSpeed(uint8_t speed)
+    {
+        m_speed = speed;
+    }
+
+    /**
+     * Is the whole trace replayed?
+     *
+     * @return If finished, it will return true otherwise false.
+     */
+    bool isFinished() const
+    {
+        return (m_size <= m_pos) && (false == m_isRxLoaded);
+    }
+
+    /**
+     * Get the number of commands written by the controller.
+     *
+     * @return Number of commands
+     */
+    uint32_t getCommandCount() const
+    {
+        return m_commands;
+    }
+
+    /**
+     * Get the number of commands, which differ from the recorded ones.
+     *
+     * @return Number of mismatches
+     */
+    uint32_t getMismatchCount() const
+    {
+        return m_mismatches;
+    }
+
+    /**
+     * Get the number of available data.
+     *
+     * @return Number of byte which are available
+     */
+    int available() override;
+
+    /**
+     * Read a single data byte.
+     *
+     * @return Single data byte or -1 if no byte is available.
+     */
+    int read() override;
+
+    /**
+     * Read a single data byte, but without increasing the internal read position.
+     *
+     * @return Single data byte or -1 if no byte is available.
+     */
+    int peek() override;
+
+    /**
+     * Write a single data byte of a command.
+     *
+     * @param[in] data  Single data byte
+     *
+     * @return Number of written data byte
+     */
+    size_t write(uint8_t data) override;
+
+    /**
+     * Flush finishes the current command.
+     */
+    void flush() override;
+
+private:
+
+    const uint8_t*       m_trace;        /**< Recorded trace */
+    size_t               m_size;         /**< Trace size in byte */
+    size_t               m_pos;          /**< Position of the next record in the trace. */
+    uint8_t              m_speed;        /**< Speed factor */
+    Rego6xxTrace::Record m_txRecord;     /**< Recorded command, which is compared with the written one. */
+    size_t               m_txIdx;        /**< Number of written bytes of the current command. */
+    bool                 m_isTxOpen;     /**< Is the controller writing a command? */
+    bool                 m_isTxMismatch; /**< Does the current command differ from the recorded one? */
+    Rego6xxTrace::Record m_rxRecord;     /**< Recorded response, which is provided to the controller. */
+    size_t               m_rxIdx;        /**< Number of read bytes of the current response. */
+    bool                 m_isRxLoaded;   /**< Is a response loaded? */
+    uint32_t             m_traceRef;     /**< Trace timestamp of the last command in us. */
+    uint32_t             m_timeRef;      /**< Time when the last command was written in us. */
+    uint32_t             m_commands;     /**< Number of written commands */
+    uint32_t             m_mismatches;   /**< Number of commands, which differ from the recorded ones. */
+
+    Rego6xxReplay();
+
+    /**
+     * Get the next record from the trace, without consuming it.
+     *
+     * @param[out] record   Record
+     *
+     * @return Number of bytes the record occupies in the trace or 0 if no record is available.
+     */
+    size_t peekRecord(Rego6xxTrace::Record& record) const;
+
+    /**
+     * Start a new command, which is compared with the next recorded command.
+     * Recorded responses, which were not read by the controller, are skipped.
+     */
+    void openCommand();
+
+    /**
+     * Load the next response, if its time has come.
+     */
+    void loadResponse();
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* __REGO6XX_REPLAY_H__ */
+
+/** @} */
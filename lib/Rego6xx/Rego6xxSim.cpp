@@ -66,7 +66,10 @@ int Rego6xxSim::read()
 
     if (m_rspSize > m_readIndex)
     {
-        Serial.printf("Rx: %02X\n", m_rspBuffer[m_readIndex]);
+        if (true == m_isVerbose)
+        {
+            Serial.printf("Rx: %02X\n", m_rspBuffer[m_readIndex]);
+        }
 
         result = m_rspBuffer[m_readIndex];
         ++m_readIndex;
@@ -91,15 +94,18 @@ size_t Rego6xxSim::write(const uint8_t* buffer, size_t size)
 {
     size_t index = 0;
 
-    Serial.printf("Tx: ");
-
-    while(size > index)
+    if (true == m_isVerbose)
     {
-        Serial.printf("%02X", buffer[index]);
-        ++index;
-    }
+        Serial.printf("Tx: ");
 
-    Serial.printf("\n");
+        while(size > index)
+        {
+            Serial.printf("%02X", buffer[index]);
+            ++index;
+        }
+
+        Serial.printf("\n");
+    }
 
     /* Prepare response */
     m_readIndex = 0;
@@ -108,6 +114,38 @@ size_t Rego6xxSim::write(const uint8_t* buffer, size_t size)
     return size;
 }
 
+bool Rego6xxSim::setValue(uint8_t cmdId, uint16_t addr, uint16_t value)
+{
+    bool    isSuccessful    = false;
+    uint8_t index           = 0;
+
+    while((m_valueCount > index) &&
+          ((cmdId != m_values[index].cmdId) || (addr != m_values[index].addr)))
+    {
+        ++index;
+    }
+
+    if (m_valueCount > index)
+    {
+        m_values[index].value = value;
+        isSuccessful = true;
+    }
+    else if (MAX_VALUES > m_valueCount)
+    {
+        m_values[m_valueCount].cmdId = cmdId;
+        m_values[m_valueCount].addr  = addr;
+        m_values[m_valueCount].value = value;
+        ++m_valueCount;
+        isSuccessful = true;
+    }
+    else
+    {
+        ;
+    }
+
+    return isSuccessful;
+}
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
@@ -116,6 +154,26 @@ size_t Rego6xxSim::write(const uint8_t* buffer, size_t size)
  * Private Methods
  *****************************************************************************/
 
+uint16_t Rego6xxSim::getValue(uint8_t cmdId, uint16_t addr, uint16_t defaultValue) const
+{
+    uint16_t    value   = defaultValue;
+    uint8_t     index   = 0;
+
+    while(m_valueCount > index)
+    {
+        if ((cmdId == m_values[index].cmdId) &&
+            (addr == m_values[index].addr))
+        {
+            value = m_values[index].value;
+            break;
+        }
+
+        ++index;
+    }
+
+    return value;
+}
+
 void Rego6xxSim::generateStdRsp(uint16_t value)
 {
     m_rspSize = 5;
@@ -230,9 +288,12 @@ void Rego6xxSim::prepareRsp(const uint8_t* buffer, size_t size)
                 addr |= ((uint16_t)(buffer[3] & 0x7f)) <<  7;
                 addr |= ((uint16_t)(buffer[4] & 0x7f)) <<  0;
 
-                Serial.printf("Read front panel addr 0x%04X.\n", addr);
+                if (true == m_isVerbose)
+                {
+                    Serial.printf("Read front panel addr 0x%04X.\n", addr);
+                }
 
-                generateBoolRsp(true);
+                generateBoolRsp(0 != getValue(Rego6xxCtrl::CMD_ID_READ_FRONT_PANEL, addr, 1));
             }
             break;
 
@@ -249,7 +310,10 @@ void Rego6xxSim::prepareRsp(const uint8_t* buffer, size_t size)
                 value |= ((uint16_t)(buffer[6] & 0x7f)) <<  7;
                 value |= ((uint16_t)(buffer[7] & 0x7f)) <<  0;
 
-                Serial.printf("Write 0x%04X to front panel 0x%04X.\n", value, addr);
+                if (true == m_isVerbose)
+                {
+                    Serial.printf("Write 0x%04X to front panel 0x%04X.\n", value, addr);
+                }
 
                 generateConfirmRsp();
             }
@@ -263,9 +327,12 @@ void Rego6xxSim::prepareRsp(const uint8_t* buffer, size_t size)
                 addr |= ((uint16_t)(buffer[3] & 0x7f)) <<  7;
                 addr |= ((uint16_t)(buffer[4] & 0x7f)) <<  0;
 
-                Serial.printf("Read system register 0x%04X.\n", addr);
+                if (true == m_isVerbose)
+                {
+                    Serial.printf("Read system register 0x%04X.\n", addr);
+                }
 
-                generateStdRsp(240);    /* 24.0 °C ... just a value */
+                generateStdRsp(getValue(Rego6xxCtrl::CMD_ID_READ_SYSTEM_REG, addr, 240));    /* 24.0 °C ... just a value */
             }
             break;
 
@@ -282,7 +349,12 @@ void Rego6xxSim::prepareRsp(const uint8_t* buffer, size_t size)
                 value |= ((uint16_t)(buffer[6] & 0x7f)) <<  7;
                 value |= ((uint16_t)(buffer[7] & 0x7f)) <<  0;
 
-                Serial.printf("Write %u to system register 0x%04X.\n", value, addr);
+                if (true == m_isVerbose)
+                {
+                    Serial.printf("Write %u to system register 0x%04X.\n", value, addr);
+                }
+
+                (void)setValue(Rego6xxCtrl::CMD_ID_READ_SYSTEM_REG, addr, value);
 
                 generateConfirmRsp();
             }
@@ -317,7 +389,10 @@ void Rego6xxSim::prepareRsp(const uint8_t* buffer, size_t size)
             break;
 
         case Rego6xxCtrl::CMD_ID_READ_REGO_VERSION:
-            Serial.printf("Read Rego6xxx version.\n");
+            if (true == m_isVerbose)
+            {
+                Serial.printf("Read Rego6xxx version.\n");
+            }
 
             generateStdRsp(0x0258); /* 0x0258 for Rego600 */
             break;
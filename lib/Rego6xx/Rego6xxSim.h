@@ -65,7 +65,10 @@ public:
     Rego6xxSim() :
         m_readIndex(0),
         m_rspBuffer(),
-        m_rspSize(0)
+        m_rspSize(0),
+        m_isVerbose(true),
+        m_values(),
+        m_valueCount(0)
     {
     }
 
@@ -123,13 +126,69 @@ public:
      */
     size_t write(const uint8_t* buffer, size_t size) override;
 
+    /**
+     * Enable or disable the output of the communication on the serial.
+     * 
+     * @param[in] isVerbose Enable (true) or disable (false) the output.
+     */
+    void setVerbose(bool isVerbose)
+    {
+        m_isVerbose = isVerbose;
+    }
+
+    /**
+     * Set the value, which is responded to a read command. Values, which
+     * are not set, are responded with a fixed default value.
+     * A write to a system register sets its value too.
+     * 
+     * @param[in] cmdId Read command id
+     * @param[in] addr  Address
+     * @param[in] value Value
+     * 
+     * @return If successful, it will return true otherwise false.
+     */
+    bool setValue(uint8_t cmdId, uint16_t addr, uint16_t value);
+
+    /**
+     * Remove all set values.
+     */
+    void clearValues()
+    {
+        m_valueCount = 0;
+    }
+
 private:
 
     static const uint8_t    RSP_BUFFER_SIZE = 64;    /**< Rego6xx response buffer size in byte. */
+    static const uint8_t    MAX_VALUES      = 32;    /**< Max. number of values, which can be set. */
+
+    /**
+     * A value, which is responded to a read command.
+     */
+    struct Value
+    {
+        uint8_t     cmdId;  /**< Read command id */
+        uint16_t    addr;   /**< Address */
+        uint16_t    value;  /**< Value */
+    };
 
     uint8_t m_readIndex;                    /**< Read index in the standard response buffer. */
     uint8_t m_rspBuffer[RSP_BUFFER_SIZE];   /**< Standard response buffer */
     size_t  m_rspSize;                      /**< Size of current filled response buffer */
+    bool    m_isVerbose;                    /**< Output the communication on the serial? */
+    Value   m_values[MAX_VALUES];           /**< Values, which are responded to read commands. */
+    uint8_t m_valueCount;                   /**< Number of set values */
+
+    /**
+     * Get the value, which is responded to a read command.
+     * 
+     * @param[in] cmdId         Read command id
+     * @param[in] addr          Address
+     * @param[in] defaultValue  Value, which is used if no value is set.
+     * 
+     * @return Value
+     */
+    uint16_t getValue(uint8_t cmdId, uint16_t addr, uint16_t defaultValue) const;
 
     /**
      * Generate a valid standard response with the given value.
@@ -0,0 +1,168 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Rego6xx UART trace format
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "Rego6xxTrace.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** File header magic. */
+static const uint8_t MAGIC[] = { 'R', '6', 'T', 'R' };
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+void Rego6xxTrace::encodeHeader(uint8_t* header)
+{
+    header[0] = MAGIC[0];
+    header[1] = MAGIC[1];
+    header[2] = MAGIC[2];
+    header[3] = MAGIC[3];
+    header[4] = VERSION;
+    header[5] = 0U; /* Flags, reserved for future use. */
+    header[6] = 0U;
+    header[7] = 0U;
+}
+
+size_t Rego6xxTrace::writeHeader(Print& out)
+{
+    uint8_t header[HEADER_SIZE];
+
+    encodeHeader(header);
+
+    return out.write(header, HEADER_SIZE);
+}
+
+void Rego6xxTrace::encodeRecordHeader(uint8_t* header, uint32_t timestamp, Direction dir, size_t size)
+{
+    header[0] = static_cast<uint8_t>((timestamp >> 0U) & 0xFFU);
+    header[1] = static_cast<uint8_t>((timestamp >> 8U) & 0xFFU);
+    header[2] = static_cast<uint8_t>((timestamp >> 16U) & 0xFFU);
+    header[3] = static_cast<uint8_t>((timestamp >> 24U) & 0xFFU);
+    header[4] = static_cast<uint8_t>((static_cast<uint8_t>(dir) << 7U) | (size & RECORD_DATA_MAX));
+}
+
+size_t Rego6xxTrace::writeRecord(Print& out, uint32_t timestamp, Direction dir, const uint8_t* data, size_t size)
+{
+    size_t written = 0U;
+
+    while ((nullptr != data) && (0U < size))
+    {
+        uint8_t record[RECORD_HEADER_SIZE + RECORD_DATA_MAX];
+        size_t  chunkSize = (RECORD_DATA_MAX < size) ? RECORD_DATA_MAX : size;
+
+        encodeRecordHeader(record, timestamp, dir, chunkSize);
+        memcpy(&record[RECORD_HEADER_SIZE], data, chunkSize);
+
+        /* Write the record at once, so a sink can reject it completely. */
+        written += out.write(record, RECORD_HEADER_SIZE + chunkSize);
+
+        data    += chunkSize;
+        size    -= chunkSize;
+    }
+
+    return written;
+}
+
+bool Rego6xxTrace::isHeaderValid(const uint8_t* buffer, size_t size)
+{
+    bool isValid = false;
+
+    if ((nullptr != buffer) &&
+        (HEADER_SIZE <= size))
+    {
+        if ((MAGIC[0] == buffer[0]) &&
+            (MAGIC[1] == buffer[1]) &&
+            (MAGIC[2] == buffer[2]) &&
+            (MAGIC[3] == buffer[3]) &&
+            (VERSION == buffer[4]))
+        {
+            isValid = true;
+        }
+    }
+
+    return isValid;
+}
+
+size_t Rego6xxTrace::parseRecord(const uint8_t* buffer, size_t size, Record& record)
+{
+    size_t recordSize = 0U;
+
+    if ((nullptr != buffer) &&
+        (RECORD_HEADER_SIZE <= size))
+    {
+        uint8_t dataSize = buffer[4] & 0x7FU;
+
+        if ((RECORD_HEADER_SIZE + dataSize) <= size)
+        {
+            record.timestamp  = static_cast<uint32_t>(buffer[0]) << 0U;
+            record.timestamp |= static_cast<uint32_t>(buffer[1]) << 8U;
+            record.timestamp |= static_cast<uint32_t>(buffer[2]) << 16U;
+            record.timestamp |= static_cast<uint32_t>(buffer[3]) << 24U;
+            record.dir        = (0U == (buffer[4] & 0x80U)) ? DIR_TX : DIR_RX;
+            record.size       = dataSize;
+            record.data       = &buffer[RECORD_HEADER_SIZE];
+
+            recordSize        = RECORD_HEADER_SIZE + dataSize;
+        }
+    }
+
+    return recordSize;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
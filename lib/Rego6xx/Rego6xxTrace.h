@@ -0,0 +1,184 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Rego6xx UART trace format
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @{
+ */
+
+#ifndef __REGO6XX_TRACE_H__
+#define __REGO6XX_TRACE_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <Arduino.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Binary trace format of the UART traffic between host and heatpump.
+ *
+ * A trace starts with a file header, followed by any number of records.
+ * All multi-byte values are little endian.
+ *
+ *      File header:
+ *      *-------*---------*-------*----------*
+ *      |   4   |    1    |   1   |     2    | <- Number of bytes
+ *      *-------*---------*-------*----------*
+ *      | Magic | Version | Flags | Reserved |
+ *      *-------*---------*-------*----------*
+ *
+ *      Record:
+ *      *----------------*----------------------*--------*
+ *      |       4        |          1           |    n   | <- Number of bytes
+ *      *----------------*----------------------*--------*
+ *      | Timestamp [us] | Direction | Size (n) |  Data  |
+ *      *----------------*----------------------*--------*
+ *
+ * The direction is stored in bit 7 and the data size in bit 0-6 of the
+ * same byte. A record contains all bytes which crossed the wire in one
+ * direction without interruption. The timestamp is the time of the first
+ * byte of the record.
+ *
+ * The frame trace of the Rego6xxCtrl uses the same format, but a record
+ * contains a complete command or response frame. Its timestamp is the
+ * time the frame was written or completely received. A receive record
+ * without data marks a response timeout.
+ */
+namespace Rego6xxTrace
+{
+
+/** Transfer direction, seen from the host. */
+enum Direction : uint8_t
+{
+    DIR_TX = 0U, /**< Host to heatpump controller */
+    DIR_RX = 1U  /**< Heatpump controller to host */
+};
+
+/** A single decoded trace record. */
+struct Record
+{
+    uint32_t       timestamp; /**< Timestamp of the first byte in us */
+    Direction      dir;       /**< Transfer direction */
+    uint8_t        size;      /**< Number of data bytes */
+    const uint8_t* data;      /**< Data bytes, pointing into the trace buffer */
+};
+
+/** Trace format version. */
+static const uint8_t VERSION            = 1U;
+
+/** File header size in bytes. */
+static const size_t  HEADER_SIZE        = 8U;
+
+/** Record header size in bytes. */
+static const size_t  RECORD_HEADER_SIZE = 5U;
+
+/** Max. number of data bytes per record. */
+static const size_t  RECORD_DATA_MAX    = 127U;
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * Encode the file header.
+ *
+ * @param[out] header   File header buffer with HEADER_SIZE bytes
+ */
+void encodeHeader(uint8_t* header);
+
+/**
+ * Write the file header.
+ *
+ * @param[in] out   Output
+ *
+ * @return Number of written bytes.
+ */
+size_t writeHeader(Print& out);
+
+/**
+ * Encode a record header.
+ *
+ * @param[out] header       Record header buffer with RECORD_HEADER_SIZE bytes
+ * @param[in]  timestamp    Timestamp of the first byte in us
+ * @param[in]  dir          Transfer direction
+ * @param[in]  size         Number of data bytes, at most RECORD_DATA_MAX.
+ */
+void encodeRecordHeader(uint8_t* header, uint32_t timestamp, Direction dir, size_t size);
+
+/**
+ * Write a single record. If the data doesn't fit into one record, it will
+ * be split up into several records with the same timestamp.
+ *
+ * @param[in] out       Output
+ * @param[in] timestamp Timestamp of the first byte in us
+ * @param[in] dir       Transfer direction
+ * @param[in] data      Data bytes
+ * @param[in] size      Number of data bytes
+ *
+ * @return Number of written bytes.
+ */
+size_t writeRecord(Print& out, uint32_t timestamp, Direction dir, const uint8_t* data, size_t size);
+
+/**
+ * Is the file header at the begin of the buffer valid?
+ *
+ * @param[in] buffer    Trace buffer
+ * @param[in] size      Trace buffer size in byte
+ *
+ * @return If valid, it will return true otherwise false.
+ */
+bool isHeaderValid(const uint8_t* buffer, size_t size);
+
+/**
+ * Parse the record at the begin of the buffer.
+ *
+ * @param[in]  buffer   Buffer, which starts with a record
+ * @param[in]  size     Buffer size in byte
+ * @param[out] record   Decoded record
+ *
+ * @return Number of bytes the record occupies or 0 if the record is incomplete.
+ */
+size_t parseRecord(const uint8_t* buffer, size_t size, Record& record);
+
+}
+
+#endif /* __REGO6XX_TRACE_H__ */
+
+/** @} */
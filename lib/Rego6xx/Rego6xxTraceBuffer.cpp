@@ -0,0 +1,137 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Rego6xx trace buffer
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "Rego6xxTraceBuffer.h"
+#include <new>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool Rego6xxTraceBuffer::allocate(size_t capacity)
+{
+    bool isSuccessful = false;
+
+    release();
+
+    if (0U < capacity)
+    {
+        m_buffer = new (std::nothrow) uint8_t[capacity];
+
+        if (nullptr != m_buffer)
+        {
+            m_capacity   = capacity;
+            isSuccessful = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+void Rego6xxTraceBuffer::release()
+{
+    if (nullptr != m_buffer)
+    {
+        delete[] m_buffer;
+        m_buffer = nullptr;
+    }
+
+    m_capacity = 0U;
+    clear();
+}
+
+size_t Rego6xxTraceBuffer::write(uint8_t data)
+{
+    return write(&data, 1U);
+}
+
+size_t Rego6xxTraceBuffer::write(const uint8_t* buffer, size_t size)
+{
+    size_t written = 0U;
+
+    if ((nullptr != m_buffer) &&
+        (nullptr != buffer) &&
+        ((m_capacity - m_size) >= size))
+    {
+        memcpy(&m_buffer[m_size], buffer, size);
+
+        /* Increase the size only after the data is complete, because a
+         * reader may use it concurrently.
+         */
+        m_size  += size;
+        written  = size;
+    }
+    else
+    {
+        m_dropped += size;
+    }
+
+    return written;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,172 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Rego6xx trace buffer
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @{
+ */
+
+#ifndef __REGO6XX_TRACE_BUFFER_H__
+#define __REGO6XX_TRACE_BUFFER_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <Arduino.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Linear RAM buffer, which captures a trace until it is full.
+ * Data is only appended, therefore the already written part of the buffer
+ * can be read while recording continues.
+ */
+class Rego6xxTraceBuffer : public Print
+{
+public:
+
+    /**
+     * Constructs a trace buffer without memory.
+     */
+    Rego6xxTraceBuffer() :
+        m_buffer(nullptr),
+        m_capacity(0U),
+        m_size(0U),
+        m_dropped(0U)
+    {
+    }
+
+    /**
+     * Destroys the trace buffer.
+     */
+    ~Rego6xxTraceBuffer()
+    {
+        release();
+    }
+
+    /**
+     * Allocate the buffer memory.
+     *
+     * @param[in] capacity  Buffer capacity in byte
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool allocate(size_t capacity);
+
+    /**
+     * Release the buffer memory.
+     */
+    void release();
+
+    /**
+     * Clear the buffer content.
+     */
+    void clear()
+    {
+        m_size    = 0U;
+        m_dropped = 0U;
+    }
+
+    /**
+     * Write a single data byte.
+     *
+     * @param[in] data  Single data byte
+     *
+     * @return Number of written data byte
+     */
+    size_t write(uint8_t data) override;
+
+    /**
+     * Write several data bytes. If they don't fit completely, nothing
+     * is written, which keeps the trace consistent.
+     *
+     * @param[in] buffer    Data buffer
+     * @param[in] size      Data buffer size in byte
+     *
+     * @return Number of written data byte
+     */
+    size_t write(const uint8_t* buffer, size_t size) override;
+
+    /**
+     * Get the captured data.
+     *
+     * @return Captured data
+     */
+    const uint8_t* getData() const
+    {
+        return m_buffer;
+    }
+
+    /**
+     * Get the number of captured bytes.
+     *
+     * @return Number of captured bytes
+     */
+    size_t getSize() const
+    {
+        return m_size;
+    }
+
+    /**
+     * Get the number of bytes, which didn't fit into the buffer anymore.
+     *
+     * @return Number of dropped bytes
+     */
+    uint32_t getDropped() const
+    {
+        return m_dropped;
+    }
+
+private:
+
+    uint8_t*        m_buffer;   /**< Buffer memory */
+    size_t          m_capacity; /**< Buffer capacity in byte */
+    volatile size_t m_size;     /**< Number of captured bytes */
+    uint32_t        m_dropped;  /**< Number of dropped bytes */
+
+    Rego6xxTraceBuffer(const Rego6xxTraceBuffer& other);
+    Rego6xxTraceBuffer& operator=(const Rego6xxTraceBuffer& other);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* __REGO6XX_TRACE_BUFFER_H__ */
+
+/** @} */
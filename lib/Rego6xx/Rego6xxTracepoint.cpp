@@ -0,0 +1,84 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Rego6xx tracepoints
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "Rego6xxTracepoint.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+#ifdef EVENT_TRACE_SIZE
+
+const EventTrace::Info Rego6xxTracepoint::INFOS[Rego6xxTracepoint::ID_COUNT] =
+{
+    { "cmd",                    Rego6xxTracepoint::TRACK_BUS        },
+    { "pause",                  Rego6xxTracepoint::TRACK_SCHEDULER  },
+    { "state",                  Rego6xxTracepoint::TRACK_SCHEDULER  },
+    { "publish sensor",         Rego6xxTracepoint::TRACK_PUBLISH    },
+    { "publish binary sensor",  Rego6xxTracepoint::TRACK_PUBLISH    },
+    { "publish text sensor",    Rego6xxTracepoint::TRACK_PUBLISH    },
+    { "publish number",         Rego6xxTracepoint::TRACK_PUBLISH    },
+    { "initial snapshot",       Rego6xxTracepoint::TRACK_SCHEDULER  },
+    { "dependent refresh",      Rego6xxTracepoint::TRACK_SCHEDULER  }
+};
+
+#endif /* EVENT_TRACE_SIZE */
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
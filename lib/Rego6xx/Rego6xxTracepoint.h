@@ -0,0 +1,108 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Rego6xx tracepoints
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @{
+ */
+
+#ifndef __REGO6XX_TRACEPOINT_H__
+#define __REGO6XX_TRACEPOINT_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <Arduino.h>
+#include "EventTrace.hpp"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Ids of all tracepoints of the heatpump communication. The tracepoints are
+ * only compiled in, if the event trace is enabled (see EventTrace.hpp).
+ */
+namespace Rego6xxTracepoint
+{
+
+/** Tracepoint ids, which are used as index of the event descriptions. */
+enum Id : uint8_t
+{
+    ID_CMD = 0U,                /**< Command written until its response is complete, argument is the command id and the response status. */
+    ID_PAUSE,                   /**< Request pause, argument is the pause duration in ms. */
+    ID_STATE,                   /**< State transition of the polling state machine, argument is the new state. */
+    ID_PUBLISH_SENSOR,          /**< Publish of a sensor, argument is the sensor index. */
+    ID_PUBLISH_BINARY_SENSOR,   /**< Publish of a binary sensor, argument is the binary sensor index. */
+    ID_PUBLISH_TEXT_SENSOR,     /**< Publish of a text sensor, argument is the text sensor index. */
+    ID_PUBLISH_NUMBER,          /**< Publish of a number, argument is the number index. */
+    ID_INITIAL_SNAPSHOT,        /**< Every entity of the startup burst was read once, argument is the number of entities. */
+    ID_DEPENDENT_REFRESH,       /**< Targeted round of the entities, which depend on a changed entity, argument is the state. */
+    ID_COUNT                    /**< Number of tracepoint ids */
+};
+
+/** Response status, which is the argument at the end of a command. */
+enum RspStatus : uint8_t
+{
+    RSP_STATUS_VALID = 0U,  /**< Valid response */
+    RSP_STATUS_TIMEOUT,     /**< Response timeout */
+    RSP_STATUS_INVALID      /**< Invalid response */
+};
+
+/** Tracks in the trace viewer. */
+enum Track : uint8_t
+{
+    TRACK_BUS = 1U,     /**< Commands on the bus */
+    TRACK_SCHEDULER,    /**< Request pauses and state transitions */
+    TRACK_PUBLISH       /**< Publishing of the entity states */
+};
+
+#ifdef EVENT_TRACE_SIZE
+
+/** Event descriptions for the export, indexed by the tracepoint id. */
+extern const EventTrace::Info INFOS[ID_COUNT];
+
+#endif /* EVENT_TRACE_SIZE */
+
+}
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* __REGO6XX_TRACEPOINT_H__ */
+
+/** @} */
@@ -0,0 +1,473 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Event trace
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup UTILITIES
+ *
+ * @{
+ */
+
+#ifndef EVENTTRACE_HPP
+#define EVENTTRACE_HPP
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/*
+ * The event trace is enabled by defining EVENT_TRACE_SIZE with the number of
+ * events, which are kept in the ring buffer, e.g. -DEVENT_TRACE_SIZE=1024U.
+ * Without it, all tracepoints compile to nothing.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <Arduino.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+#ifdef EVENT_TRACE_SIZE
+
+/** Trace the begin of a duration event with an argument. */
+#define EVENT_TRACE_BEGIN(__id, __arg)      EventTrace::getInstance().add(EventTrace::PHASE_BEGIN, (__id), (__arg))
+
+/** Trace the end of a duration event with an argument. */
+#define EVENT_TRACE_END(__id, __arg)        EventTrace::getInstance().add(EventTrace::PHASE_END, (__id), (__arg))
+
+/** Trace an instant event with an argument. */
+#define EVENT_TRACE_INSTANT(__id, __arg)    EventTrace::getInstance().add(EventTrace::PHASE_INSTANT, (__id), (__arg))
+
+#else /* EVENT_TRACE_SIZE */
+
+/** Event trace is disabled. */
+#define EVENT_TRACE_BEGIN(__id, __arg)      do { } while (0)
+
+/** Event trace is disabled. */
+#define EVENT_TRACE_END(__id, __arg)        do { } while (0)
+
+/** Event trace is disabled. */
+#define EVENT_TRACE_INSTANT(__id, __arg)    do { } while (0)
+
+#endif /* EVENT_TRACE_SIZE */
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+#ifdef EVENT_TRACE_SIZE
+
+/**
+ * Event trace, which keeps the latest events in a fixed RAM ring buffer.
+ * An event takes 8 bytes and is added in constant time without any heap
+ * allocation, therefore tracepoints can stay in the hot paths.
+ *
+ * The events are exported in the Chrome trace event format, which can be
+ * loaded into chrome://tracing or https://ui.perfetto.dev. The export is
+ * done in pieces, so it can be read by another task while tracing
+ * continues. Events, which are overwritten meanwhile, are skipped.
+ */
+class EventTrace
+{
+public:
+
+    /**
+     * Clock function, which returns the current time in us.
+     */
+    typedef uint32_t (*ClockFunc)();
+
+    /**
+     * Event phase, the values are the phase characters of the Chrome trace format.
+     */
+    enum Phase : uint8_t
+    {
+        PHASE_BEGIN   = 'B',    /**< Begin of a duration event */
+        PHASE_END     = 'E',    /**< End of a duration event */
+        PHASE_INSTANT = 'i'     /**< Instant event */
+    };
+
+    /**
+     * A single traced event.
+     */
+    struct Event
+    {
+        uint32_t    timestamp;  /**< Timestamp in us */
+        uint16_t    arg;        /**< Event specific argument */
+        uint8_t     id;         /**< Event id */
+        uint8_t     phase;      /**< Event phase */
+    };
+
+    /**
+     * Description of an event id, which is used by the export.
+     */
+    struct Info
+    {
+        const char* name;   /**< Event name */
+        uint8_t     track;  /**< Track (thread id) in the trace viewer */
+    };
+
+    /**
+     * Export progress, which is kept by the reader between the pieces.
+     */
+    struct Cursor
+    {
+        uint32_t    seq;            /**< Sequence number of the next event */
+        uint32_t    lastTimestamp;  /**< Timestamp of the last exported event in us */
+        uint64_t    time;           /**< Time since the first exported event in us */
+        uint8_t     part;           /**< Part of the export: header, events, footer, done */
+        bool        isFirst;        /**< Is the next event the first exported one? */
+    };
+
+    /**
+     * Get the event trace instance.
+     *
+     * @return Event trace
+     */
+    static EventTrace& getInstance()
+    {
+        static EventTrace instance;
+
+        return instance;
+    }
+
+    /**
+     * Set the clock of the event trace. For simulations the time base can be
+     * replaced by a virtual clock.
+     *
+     * @param[in] clock Clock function or nullptr to use micros().
+     */
+    void setClock(ClockFunc clock)
+    {
+        m_clock = clock;
+    }
+
+    /**
+     * Add an event. The oldest event is overwritten, if the ring buffer is full.
+     *
+     * @param[in] phase Event phase
+     * @param[in] id    Event id
+     * @param[in] arg   Event specific argument
+     */
+    void add(Phase phase, uint8_t id, uint16_t arg)
+    {
+        uint32_t seq   = m_written;
+        Event&   event = m_events[seq % EVENT_TRACE_SIZE];
+
+        event.timestamp = (nullptr != m_clock) ? m_clock() : micros();
+        event.arg       = arg;
+        event.id        = id;
+        event.phase     = phase;
+
+        /* The event becomes visible to a reader not before it is complete. */
+        m_written       = seq + 1U;
+    }
+
+    /**
+     * Clear all events.
+     */
+    void clear()
+    {
+        m_written = 0U;
+    }
+
+    /**
+     * Get the number of events, which were added since the start.
+     *
+     * @return Number of events
+     */
+    uint32_t getWritten() const
+    {
+        return m_written;
+    }
+
+    /**
+     * Get the sequence number of the oldest event in the ring buffer, which
+     * can be read. The slot of the event before it is overwritten by the
+     * next added event.
+     *
+     * @return Sequence number of the oldest event
+     */
+    uint32_t getFirstSeq() const
+    {
+        uint32_t written = m_written;
+
+        return (EVENT_TRACE_SIZE <= written) ? (written - EVENT_TRACE_SIZE + 1U) : 0U;
+    }
+
+    /**
+     * Get a copy of an event by its sequence number.
+     *
+     * @param[in]  seq      Sequence number
+     * @param[out] event    Event
+     *
+     * @return If the event is available, it will return true otherwise false.
+     */
+    bool getEvent(uint32_t seq, Event& event) const
+    {
+        bool isAvailable = false;
+
+        if ((seq < m_written) && (seq >= getFirstSeq()))
+        {
+            event = m_events[seq % EVENT_TRACE_SIZE];
+
+            /* The writer may have overwritten the event during the copy. */
+            if ((seq + EVENT_TRACE_SIZE) > m_written)
+            {
+                isAvailable = true;
+            }
+        }
+
+        return isAvailable;
+    }
+
+    /**
+     * Start the export of all events in the ring buffer.
+     *
+     * @param[out] cursor   Export progress
+     */
+    void beginExport(Cursor& cursor) const
+    {
+        cursor.seq           = getFirstSeq();
+        cursor.lastTimestamp = 0U;
+        cursor.time          = 0U;
+        cursor.part          = EXPORT_HEADER;
+        cursor.isFirst       = true;
+    }
+
+    /**
+     * Export the next piece in the Chrome trace event format. Only whole
+     * events are written, therefore the buffer shall provide at least
+     * EXPORT_MIN_SIZE bytes. The timestamps are relative to the first
+     * exported event and the wrap around of the clock is compensated.
+     *
+     * @param[out]    buffer    Buffer, which to fill
+     * @param[in]     size      Buffer size in byte
+     * @param[in,out] cursor    Export progress
+     * @param[in]     infos     Event descriptions, indexed by the event id
+     * @param[in]     count     Number of event descriptions
+     *
+     * @return Number of written bytes. If the export is complete, it will return 0.
+     */
+    size_t exportChromeTrace(char* buffer, size_t size, Cursor& cursor, const Info* infos, size_t count) const
+    {
+        size_t written = 0U;
+        bool   isFull  = false;
+
+        while ((false == isFull) && (EXPORT_DONE != cursor.part))
+        {
+            size_t available = size - written;
+            int    len       = 0;
+            Event  event;
+
+            if (EXPORT_HEADER == cursor.part)
+            {
+                len = snprintf(&buffer[written], available, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+            }
+            else if (EXPORT_FOOTER == cursor.part)
+            {
+                len = snprintf(&buffer[written], available, "]}\n");
+            }
+            else
+            {
+                /* Skip the events, which were overwritten meanwhile. */
+                if (cursor.seq < getFirstSeq())
+                {
+                    cursor.seq = getFirstSeq();
+                }
+
+                if (false == getEvent(cursor.seq, event))
+                {
+                    /* Either all events are exported or the event was overwritten during the copy. */
+                    if (cursor.seq >= m_written)
+                    {
+                        cursor.part = EXPORT_FOOTER;
+                    }
+
+                    continue;
+                }
+
+                len = writeEvent(&buffer[written], available, cursor, event, infos, count);
+            }
+
+            if ((0 > len) || (static_cast<size_t>(len) >= available))
+            {
+                isFull = true;
+            }
+            else
+            {
+                written += static_cast<size_t>(len);
+
+                if (EXPORT_EVENTS == cursor.part)
+                {
+                    cursor.time          = getTime(cursor, event);
+                    cursor.lastTimestamp = event.timestamp;
+                    cursor.isFirst       = false;
+                    ++cursor.seq;
+                }
+                else
+                {
+                    ++cursor.part;
+                }
+            }
+        }
+
+        return written;
+    }
+
+    /**
+     * Export all events in the Chrome trace event format at once, e.g. to
+     * dump them at the end of a host run.
+     *
+     * @param[in] out   Output stream
+     * @param[in] infos Event descriptions, indexed by the event id
+     * @param[in] count Number of event descriptions
+     */
+    void exportChromeTrace(Print& out, const Info* infos, size_t count) const
+    {
+        char   buffer[EXPORT_MIN_SIZE];
+        Cursor cursor;
+        size_t len;
+
+        beginExport(cursor);
+
+        do
+        {
+            len = exportChromeTrace(buffer, sizeof(buffer), cursor, infos, count);
+
+            (void)out.write(reinterpret_cast<const uint8_t*>(buffer), len);
+        }
+        while (0U < len);
+    }
+
+    /** Minimum buffer size for a piece of the export in byte. */
+    static const size_t EXPORT_MIN_SIZE = 160U;
+
+private:
+
+    /** Export parts */
+    enum ExportPart : uint8_t
+    {
+        EXPORT_HEADER = 0U, /**< Trace header */
+        EXPORT_EVENTS,      /**< Events */
+        EXPORT_FOOTER,      /**< Trace footer */
+        EXPORT_DONE         /**< Export is complete */
+    };
+
+    Event               m_events[EVENT_TRACE_SIZE]; /**< Ring buffer */
+    volatile uint32_t   m_written;                  /**< Number of added events */
+    ClockFunc           m_clock;                    /**< Clock or nullptr for micros() */
+
+    /**
+     * Constructs an empty event trace.
+     */
+    EventTrace() :
+        m_events(),
+        m_written(0U),
+        m_clock(nullptr)
+    {
+    }
+
+    /**
+     * Destroys the event trace.
+     */
+    ~EventTrace()
+    {
+    }
+
+    EventTrace(const EventTrace& other);
+    EventTrace& operator=(const EventTrace& other);
+
+    /**
+     * Get the time of an event since the first exported event.
+     *
+     * @param[in] cursor    Export progress
+     * @param[in] event     Event
+     *
+     * @return Time in us
+     */
+    static uint64_t getTime(const Cursor& cursor, const Event& event)
+    {
+        uint64_t time = 0U;
+
+        if (false == cursor.isFirst)
+        {
+            /* The unsigned difference compensates the wrap around of the clock. */
+            time = cursor.time + static_cast<uint32_t>(event.timestamp - cursor.lastTimestamp);
+        }
+
+        return time;
+    }
+
+    /**
+     * Write a single event in the Chrome trace event format.
+     *
+     * @param[out] buffer   Buffer, which to fill
+     * @param[in]  size     Buffer size in byte
+     * @param[in]  cursor   Export progress
+     * @param[in]  event    Event
+     * @param[in]  infos    Event descriptions, indexed by the event id
+     * @param[in]  count    Number of event descriptions
+     *
+     * @return Number of characters, which are needed without the string termination.
+     */
+    static int writeEvent(char* buffer, size_t size, const Cursor& cursor, const Event& event, const Info* infos, size_t count)
+    {
+        const char* name  = "unknown";
+        uint8_t     track = 0U;
+
+        if ((nullptr != infos) && (count > event.id))
+        {
+            name  = infos[event.id].name;
+            track = infos[event.id].track;
+        }
+
+        return snprintf(buffer, size, "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.0f,\"pid\":1,\"tid\":%u,\"args\":{\"arg\":%u}}",
+            (true == cursor.isFirst) ? "" : ",",
+            name,
+            static_cast<char>(event.phase),
+            static_cast<double>(getTime(cursor, event)),
+            static_cast<unsigned int>(track),
+            static_cast<unsigned int>(event.arg));
+    }
+};
+
+#endif /* EVENT_TRACE_SIZE */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* EVENTTRACE_HPP */
+
+/** @} */
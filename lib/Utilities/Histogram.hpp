@@ -0,0 +1,256 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Histogram
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup UTILITIES
+ *
+ * @{
+ */
+
+#ifndef HISTOGRAM_HPP
+#define HISTOGRAM_HPP
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Histogram with logarithmic buckets. Every power of two is divided into
+ * 2^SUB_BITS buckets, e.g. with 3 sub bits a percentile has a relative error
+ * of at most 12.5% and values below 16 are exact. Values, which need more
+ * than VALUE_BITS bits, are counted in the last bucket.
+ * The memory footprint is fixed, no matter how many values are added.
+ *
+ * @tparam SUB_BITS     Number of bits to divide every power of two into buckets.
+ * @tparam VALUE_BITS   Number of bits of the largest value, which is resolved.
+ */
+template < uint8_t SUB_BITS = 3U, uint8_t VALUE_BITS = 32U >
+class Histogram
+{
+public:
+
+    /**
+     * Constructs an empty histogram.
+     */
+    Histogram() :
+        m_buckets(),
+        m_count(0U),
+        m_max(0U)
+    {
+    }
+
+    /**
+     * Destroys the histogram.
+     */
+    ~Histogram()
+    {
+    }
+
+    /**
+     * Add a value.
+     *
+     * @param[in] value Value
+     */
+    void add(uint32_t value)
+    {
+        ++m_buckets[getIndex(value)];
+        ++m_count;
+
+        if (m_max < value)
+        {
+            m_max = value;
+        }
+    }
+
+    /**
+     * Remove all values.
+     */
+    void clear()
+    {
+        memset(m_buckets, 0, sizeof(m_buckets));
+        m_count = 0U;
+        m_max   = 0U;
+    }
+
+    /**
+     * Get the number of added values.
+     *
+     * @return Number of values
+     */
+    uint32_t getCount() const
+    {
+        return m_count;
+    }
+
+    /**
+     * Get the maximum value.
+     *
+     * @return Maximum value or 0 if the histogram is empty.
+     */
+    uint32_t getMax() const
+    {
+        return m_max;
+    }
+
+    /**
+     * Get a percentile (nearest rank). The result is the upper bound of the
+     * bucket, limited to the maximum value.
+     *
+     * @param[in] percent   Percentile in % [0; 100]
+     *
+     * @return Percentile or 0 if the histogram is empty.
+     */
+    uint32_t getPercentile(uint8_t percent) const
+    {
+        uint32_t value = 0U;
+
+        if (0U < m_count)
+        {
+            uint64_t rank  = (static_cast<uint64_t>(m_count) * percent + 99U) / 100U;
+            uint64_t sum   = 0U;
+            size_t   index = 0U;
+
+            if (0U == rank)
+            {
+                rank = 1U;
+            }
+
+            while ((BUCKETS > index) && (rank > (sum + m_buckets[index])))
+            {
+                sum += m_buckets[index];
+                ++index;
+            }
+
+            value = getUpperBound(index);
+
+            if (m_max < value)
+            {
+                value = m_max;
+            }
+        }
+
+        return value;
+    }
+
+private:
+
+    /** Number of buckets per power of two. */
+    static const size_t SUB_BUCKETS = 1U << SUB_BITS;
+
+    /** Number of buckets. */
+    static const size_t BUCKETS     = (VALUE_BITS - SUB_BITS + 1U) * SUB_BUCKETS;
+
+    uint32_t m_buckets[BUCKETS]; /**< Number of values per bucket. */
+    uint32_t m_count;            /**< Number of values */
+    uint32_t m_max;              /**< Maximum value */
+
+    /**
+     * Get the bucket index of a value.
+     *
+     * @param[in] value Value
+     *
+     * @return Bucket index
+     */
+    static size_t getIndex(uint32_t value)
+    {
+        size_t index = value;
+
+        if (0U != (static_cast<uint64_t>(value) >> VALUE_BITS))
+        {
+            index = BUCKETS - 1U;
+        }
+        else if ((2U * SUB_BUCKETS) <= value)
+        {
+            uint8_t msb   = 31U - __builtin_clz(value);
+            uint8_t shift = msb - SUB_BITS;
+
+            index = (shift + 1U) * SUB_BUCKETS + ((value >> shift) & (SUB_BUCKETS - 1U));
+        }
+        else
+        {
+            ;
+        }
+
+        return index;
+    }
+
+    /**
+     * Get the largest value of a bucket.
+     *
+     * @param[in] index Bucket index
+     *
+     * @return Upper bound of the bucket
+     */
+    static uint32_t getUpperBound(size_t index)
+    {
+        uint32_t value = static_cast<uint32_t>(index);
+
+        /* The last bucket contains all larger values too. */
+        if ((BUCKETS - 1U) <= index)
+        {
+            value = UINT32_MAX;
+        }
+        else if ((2U * SUB_BUCKETS) <= index)
+        {
+            uint8_t  shift = static_cast<uint8_t>(index / SUB_BUCKETS) - 1U;
+            uint32_t lower = static_cast<uint32_t>(SUB_BUCKETS + (index % SUB_BUCKETS)) << shift;
+
+            value = lower + ((1U << shift) - 1U);
+        }
+        else
+        {
+            ;
+        }
+
+        return value;
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* HISTOGRAM_HPP */
+
+/** @} */
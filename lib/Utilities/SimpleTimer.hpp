@@ -68,11 +68,17 @@
 
 /**
  * Simple timer, based on millis().
+ * For simulations the time base can be replaced by a virtual clock.
  */
 class SimpleTimer
 {
 public:
 
+    /**
+     * Clock function, which returns the current time in ms.
+     */
+    typedef uint32_t (*ClockFunc)();
+
     /**
      * Constructs a simple timer.
      */
@@ -134,7 +140,7 @@ public:
         m_isRunning = true;
         m_isTimeout = false;
         m_duration  = duration;
-        m_start     = millis();
+        m_start     = now();
     }
 
     /**
@@ -153,7 +159,7 @@ public:
     {
         m_isRunning = true;
         m_isTimeout = false;
-        m_start     = millis();
+        m_start     = now();
     }
 
     /**
@@ -180,7 +186,7 @@ public:
         {            
             if (false == m_isTimeout)
             {
-                uint32_t delta = millis() - m_start;
+                uint32_t delta = now() - m_start;
 
                 if (m_duration <= delta)
                 {
@@ -194,12 +200,70 @@ public:
         return isTimeout;
     }
 
+    /**
+     * Get the remaining time until timeout.
+     * If timer is not running, it will always return 0.
+     * 
+     * @return Remaining time in ms
+     */
+    uint32_t getRemaining() const
+    {
+        uint32_t remaining = 0U;
+
+        if (true == m_isRunning)
+        {
+            uint32_t delta = now() - m_start;
+
+            if (m_duration > delta)
+            {
+                remaining = m_duration - delta;
+            }
+        }
+
+        return remaining;
+    }
+
+    /**
+     * Set the clock of all simple timers. Set it before any timer is
+     * started, otherwise running timers will timeout unexpected.
+     *
+     * @param[in] clock Clock function or nullptr to use millis().
+     */
+    static void setClock(ClockFunc clock)
+    {
+        getClock() = clock;
+    }
+
+    /**
+     * Get the current time of the clock of all simple timers.
+     *
+     * @return Current time in ms
+     */
+    static uint32_t now()
+    {
+        ClockFunc clock = getClock();
+
+        return (nullptr != clock) ? clock() : millis();
+    }
+
 private:
 
     bool        m_isRunning;    /**< Timer is running or not. */
     bool        m_isTimeout;    /**< Timer timeout active or not. */
     uint32_t    m_duration;     /**< Duration in ms */
     uint32_t    m_start;        /**< Timestamp at start time */
+
+    /**
+     * Get the clock of all simple timers.
+     *
+     * @return Reference to the clock function
+     */
+    static ClockFunc& getClock()
+    {
+        static ClockFunc clock = nullptr;
+
+        return clock;
+    }
 };
 
 /******************************************************************************
@@ -0,0 +1,248 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  End-to-end latency of user actions
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IVTRego6xxActionLatency.h"
+#include "SimpleTimer.hpp"
+#include "esphome/core/log.h"
+#include <stdio.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+namespace esphome
+{
+namespace ivt_rego6xx_ctrl
+{
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/**
+ * Logger tag of this component.
+ */
+static const char* TAG = "ivt_rego6xx_ctrl.action";
+
+/** Label values of the action types in the metrics. */
+static const char* ACTION_LABELS[IVTRego6xxActionLatency::ACTION_COUNT] = {
+    "button",
+    "number"
+};
+
+/** Label values of the stages in the metrics. */
+static const char* STAGE_LABELS[IVTRego6xxActionLatency::STAGE_COUNT] = {
+    "queued",
+    "wire",
+    "confirm",
+    "refresh",
+    "total"
+};
+
+/** Percentiles of the latencies in the metrics. */
+static const uint8_t LATENCY_PERCENTILES[] = { 50U, 95U };
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+void IVTRego6xxActionLatency::beginWrite(Action action, const EntityBase* entity, uint32_t requestTimestamp)
+{
+    if (ACTION_COUNT > action)
+    {
+        Measurement& measurement = m_measurements[action];
+
+        measurement.phase   = PHASE_WIRE;
+        measurement.entity  = entity;
+        measurement.request = requestTimestamp;
+        measurement.write   = SimpleTimer::now();
+        measurement.receive = measurement.write;
+        measurement.confirm = measurement.write;
+
+        m_latencies[action][STAGE_QUEUED].add(measurement.write - measurement.request);
+    }
+}
+
+void IVTRego6xxActionLatency::receive()
+{
+    size_t action = 0U;
+
+    for (action = 0U; action < ACTION_COUNT; ++action)
+    {
+        Measurement& measurement = m_measurements[action];
+
+        if (PHASE_WIRE == measurement.phase)
+        {
+            measurement.phase   = PHASE_RECEIVED;
+            measurement.receive = SimpleTimer::now();
+        }
+    }
+}
+
+void IVTRego6xxActionLatency::confirm(Action action, bool isSuccessful)
+{
+    if (ACTION_COUNT > action)
+    {
+        Measurement& measurement = m_measurements[action];
+
+        /* Without a preceding receive, the response was evaluated in the same loop cycle. */
+        if (PHASE_WIRE == measurement.phase)
+        {
+            measurement.receive = SimpleTimer::now();
+            measurement.phase   = PHASE_RECEIVED;
+        }
+
+        if (PHASE_RECEIVED == measurement.phase)
+        {
+            measurement.confirm = SimpleTimer::now();
+
+            if (false == isSuccessful)
+            {
+                measurement.phase = PHASE_IDLE;
+            }
+            else
+            {
+                m_latencies[action][STAGE_WIRE].add(measurement.receive - measurement.write);
+                m_latencies[action][STAGE_CONFIRM].add(measurement.confirm - measurement.receive);
+
+                /* Every number read, which is published after the confirmation, is a readback
+                 * of the written value. The display has to be read completely from the beginning.
+                 */
+                measurement.phase = (ACTION_NUMBER == action) ? PHASE_REFRESH : PHASE_CONFIRMED;
+            }
+        }
+    }
+}
+
+void IVTRego6xxActionLatency::beginDisplayRefresh()
+{
+    Measurement& measurement = m_measurements[ACTION_BUTTON];
+
+    if (PHASE_CONFIRMED == measurement.phase)
+    {
+        measurement.phase = PHASE_REFRESH;
+    }
+}
+
+void IVTRego6xxActionLatency::publish(Action action, const EntityBase* entity, bool isLast)
+{
+    if (ACTION_COUNT > action)
+    {
+        Measurement& measurement = m_measurements[action];
+
+        if ((PHASE_REFRESH == measurement.phase) &&
+            (true == isLast) &&
+            ((ACTION_BUTTON == action) || (entity == measurement.entity)))
+        {
+            uint32_t now     = SimpleTimer::now();
+            uint32_t refresh = now - measurement.confirm;
+            uint32_t total   = now - measurement.request;
+
+            m_latencies[action][STAGE_REFRESH].add(refresh);
+            m_latencies[action][STAGE_TOTAL].add(total);
+
+            ESP_LOGD(TAG, "'%s' took %u ms: queued %u ms, wire %u ms, confirm %u ms, refresh %u ms.",
+                     measurement.entity->get_name().c_str(),
+                     static_cast<unsigned int>(total),
+                     static_cast<unsigned int>(measurement.write - measurement.request),
+                     static_cast<unsigned int>(measurement.receive - measurement.write),
+                     static_cast<unsigned int>(measurement.confirm - measurement.receive),
+                     static_cast<unsigned int>(refresh));
+
+            measurement.phase = PHASE_IDLE;
+        }
+    }
+}
+
+void IVTRego6xxActionLatency::writeMetrics(std::string& out) const
+{
+    char   line[128];
+    size_t action = 0U;
+
+    out += "# TYPE ivt_rego6xx_action_latency_milliseconds summary\n";
+    for (action = 0U; action < ACTION_COUNT; ++action)
+    {
+        size_t stage = 0U;
+
+        for (stage = 0U; stage < STAGE_COUNT; ++stage)
+        {
+            const LatencyHistogram& latency       = m_latencies[action][stage];
+            size_t                  percentileIdx = 0U;
+
+            for (percentileIdx = 0U; percentileIdx < (sizeof(LATENCY_PERCENTILES) / sizeof(LATENCY_PERCENTILES[0])); ++percentileIdx)
+            {
+                uint8_t percentile = LATENCY_PERCENTILES[percentileIdx];
+
+                (void)snprintf(line, sizeof(line), "ivt_rego6xx_action_latency_milliseconds{action=\"%s\",stage=\"%s\",quantile=\"0.%02u\"} %u\n", ACTION_LABELS[action], STAGE_LABELS[stage], static_cast<unsigned int>(percentile), static_cast<unsigned int>(latency.getPercentile(percentile)));
+                out += line;
+            }
+
+            (void)snprintf(line, sizeof(line), "ivt_rego6xx_action_latency_milliseconds{action=\"%s\",stage=\"%s\",quantile=\"1\"} %u\n", ACTION_LABELS[action], STAGE_LABELS[stage], static_cast<unsigned int>(latency.getMax()));
+            out += line;
+            (void)snprintf(line, sizeof(line), "ivt_rego6xx_action_latency_milliseconds_count{action=\"%s\",stage=\"%s\"} %u\n", ACTION_LABELS[action], STAGE_LABELS[stage], static_cast<unsigned int>(latency.getCount()));
+            out += line;
+        }
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
@@ -0,0 +1,220 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  End-to-end latency of user actions
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "esphome/core/component.h"
+#include "Histogram.hpp"
+#include <string>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * Measures the whole path of a user action, from the button press or number
+ * change until the refreshed display or the readback is published. Every
+ * stage is kept in a histogram per action type.
+ *
+ * Only one write is on the bus at a time, therefore one measurement per
+ * action type is tracked. A write, which starts while the previous action
+ * of the same type waits for its refresh, drops the refresh of the previous
+ * one.
+ */
+class IVTRego6xxActionLatency
+{
+public:
+
+    /**
+     * Type of user action.
+     */
+    enum Action
+    {
+        ACTION_BUTTON = 0U, /**< Button press */
+        ACTION_NUMBER,      /**< Number change */
+        ACTION_COUNT        /**< Number of action types. */
+    };
+
+    /**
+     * Stage of a user action.
+     */
+    enum Stage
+    {
+        STAGE_QUEUED = 0U, /**< From the request until the command is written. */
+        STAGE_WIRE,        /**< From writing the command until the response is received. */
+        STAGE_CONFIRM,     /**< From receiving the response until it is evaluated. */
+        STAGE_REFRESH,     /**< From the evaluation until the refreshed display or readback is published. */
+        STAGE_TOTAL,       /**< From the request until the refreshed display or readback is published. */
+        STAGE_COUNT        /**< Number of stages. */
+    };
+
+    /** Histogram of the latencies in ms, which resolves up to 4 min with a relative error of at most 12.5 %. */
+    typedef Histogram<3U, 18U> LatencyHistogram;
+
+    /**
+     * Constructs the user action latency measurement.
+     */
+    IVTRego6xxActionLatency() :
+        m_measurements(),
+        m_latencies()
+    {
+    }
+
+    /**
+     * Destroys the user action latency measurement.
+     */
+    ~IVTRego6xxActionLatency()
+    {
+    }
+
+    /**
+     * The command of a user action is written now.
+     *
+     * @param[in] action            Type of user action
+     * @param[in] entity            Entity, which requested the action.
+     * @param[in] requestTimestamp  Timestamp in ms, when the user requested the action.
+     */
+    void beginWrite(Action action, const EntityBase* entity, uint32_t requestTimestamp);
+
+    /**
+     * The response of the written command is received.
+     */
+    void receive();
+
+    /**
+     * The response of the written command is evaluated.
+     *
+     * @param[in] action        Type of user action
+     * @param[in] isSuccessful  Was the write successful?
+     */
+    void confirm(Action action, bool isSuccessful);
+
+    /**
+     * A new read cycle of the display starts, which refreshes the display
+     * after a button press.
+     */
+    void beginDisplayRefresh();
+
+    /**
+     * The value of an entity is published.
+     *
+     * @param[in] action    Type of user action, which is refreshed by the entity.
+     * @param[in] entity    Entity, whose value is published.
+     * @param[in] isLast    Is it the last entity, which is refreshed? Always true for numbers.
+     */
+    void publish(Action action, const EntityBase* entity, bool isLast);
+
+    /**
+     * Get the latency histogram of a stage of an action type.
+     *
+     * @param[in] action    Type of user action
+     * @param[in] stage     Stage
+     *
+     * @return Latency histogram or nullptr if invalid.
+     */
+    const LatencyHistogram* getLatency(Action action, Stage stage) const
+    {
+        return ((ACTION_COUNT > action) && (STAGE_COUNT > stage)) ? &m_latencies[action][stage] : nullptr;
+    }
+
+    /**
+     * Append the latencies in the Prometheus text format.
+     *
+     * @param[out] out  Output
+     */
+    void writeMetrics(std::string& out) const;
+
+private:
+
+    /**
+     * Phase of a measurement.
+     */
+    enum Phase
+    {
+        PHASE_IDLE = 0U, /**< No action in progress. */
+        PHASE_WIRE,      /**< Command written, waiting for the response. */
+        PHASE_RECEIVED,  /**< Response received, waiting for its evaluation. */
+        PHASE_CONFIRMED, /**< Write confirmed, waiting for the refresh to start. */
+        PHASE_REFRESH    /**< Waiting for the refresh to be published. */
+    };
+
+    /**
+     * Measurement of a single user action.
+     */
+    struct Measurement
+    {
+        Phase             phase;   /**< Phase of the measurement */
+        const EntityBase* entity;  /**< Entity, which requested the action. */
+        uint32_t          request; /**< Timestamp of the request in ms. */
+        uint32_t          write;   /**< Timestamp of writing the command in ms. */
+        uint32_t          receive; /**< Timestamp of receiving the response in ms. */
+        uint32_t          confirm; /**< Timestamp of evaluating the response in ms. */
+    };
+
+    Measurement      m_measurements[ACTION_COUNT];           /**< Measurement per action type. */
+    LatencyHistogram m_latencies[ACTION_COUNT][STAGE_COUNT]; /**< Latencies per action type and stage. */
+
+    IVTRego6xxActionLatency(const IVTRego6xxActionLatency& other);
+    IVTRego6xxActionLatency& operator=(const IVTRego6xxActionLatency& other);
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
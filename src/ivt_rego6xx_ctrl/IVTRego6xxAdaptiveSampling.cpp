@@ -0,0 +1,232 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Rate-of-change adaptive sampling
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IVTRego6xxAdaptiveSampling.h"
+#include "IVTRego6xxMetrics.h"
+#include "SimpleTimer.hpp"
+#include <math.h>
+#include <stdio.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+namespace esphome
+{
+namespace ivt_rego6xx_ctrl
+{
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool IVTRego6xxAdaptiveSampling::addSensor(const EntityBase* entity, uint32_t minPeriod, uint32_t maxPeriod, float tolerance)
+{
+    bool isSuccessful = false;
+
+    if ((nullptr != entity) &&
+        (0U < minPeriod) &&
+        (minPeriod <= maxPeriod) &&
+        (0.0F < tolerance) &&
+        (MAX_SENSORS > m_sensorCount))
+    {
+        SensorSampling& sampling = m_sensors[m_sensorCount];
+
+        sampling.entity    = entity;
+        sampling.minPeriod = minPeriod;
+        sampling.maxPeriod = maxPeriod;
+        sampling.tolerance = tolerance;
+        sampling.period    = minPeriod; /* Start close, until the rate of change is known. */
+        sampling.rate      = 0.0F;
+        sampling.lastValue = 0.0F;
+        sampling.lastRead  = 0U;
+        sampling.samples   = 0U;
+
+        ++m_sensorCount;
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+uint32_t IVTRego6xxAdaptiveSampling::update(const EntityBase* entity, float value)
+{
+    uint32_t period = 0U;
+    size_t   idx    = findSensor(entity);
+
+    if (MAX_SENSORS > idx)
+    {
+        SensorSampling& sampling = m_sensors[idx];
+        uint32_t        now      = SimpleTimer::now();
+        uint32_t        elapsed  = now - sampling.lastRead;
+
+        if ((0U < sampling.samples) &&
+            (0U < elapsed))
+        {
+            float rate   = fabsf(value - sampling.lastValue) / static_cast<float>(elapsed);
+            float target = static_cast<float>(sampling.maxPeriod);
+
+            /* The first rate is taken as it is. */
+            if (1U == sampling.samples)
+            {
+                sampling.rate    = rate;
+                sampling.samples = 2U;
+            }
+            else
+            {
+                sampling.rate += RATE_WEIGHT * (rate - sampling.rate);
+            }
+
+            /* Time until the value is expected to drift by the tolerance. */
+            if ((0.0F < sampling.rate) &&
+                ((sampling.tolerance / sampling.rate) < target))
+            {
+                target = sampling.tolerance / sampling.rate;
+            }
+
+            /* A flat sensor is lengthened step by step, a moving one is shortened at once. */
+            if ((2.0F * static_cast<float>(sampling.period)) < target)
+            {
+                target = 2.0F * static_cast<float>(sampling.period);
+            }
+
+            sampling.period = static_cast<uint32_t>(target);
+
+            if (sampling.minPeriod > sampling.period)
+            {
+                sampling.period = sampling.minPeriod;
+            }
+            else if (sampling.maxPeriod < sampling.period)
+            {
+                sampling.period = sampling.maxPeriod;
+            }
+            else
+            {
+                ;
+            }
+        }
+        else if (0U == sampling.samples)
+        {
+            sampling.samples = 1U;
+        }
+        else
+        {
+            ;
+        }
+
+        sampling.lastValue = value;
+        sampling.lastRead  = now;
+        period             = sampling.period;
+    }
+
+    return period;
+}
+
+uint32_t IVTRego6xxAdaptiveSampling::getPeriod(const EntityBase* entity) const
+{
+    size_t idx = findSensor(entity);
+
+    return (MAX_SENSORS > idx) ? m_sensors[idx].period : 0U;
+}
+
+void IVTRego6xxAdaptiveSampling::writeMetrics(std::string& out) const
+{
+    char   line[48];
+    size_t idx = 0U;
+
+    out += "# TYPE ivt_rego6xx_adaptive_period_seconds gauge\n";
+    for (idx = 0U; idx < m_sensorCount; ++idx)
+    {
+        out += "ivt_rego6xx_adaptive_period_seconds{entity=\"";
+        appendLabelValue(out, m_sensors[idx].entity->get_name().c_str());
+        (void)snprintf(line, sizeof(line), "\"} %u\n", static_cast<unsigned int>(m_sensors[idx].period / 1000U));
+        out += line;
+    }
+
+    out += "# TYPE ivt_rego6xx_adaptive_rate_per_minute gauge\n";
+    for (idx = 0U; idx < m_sensorCount; ++idx)
+    {
+        out += "ivt_rego6xx_adaptive_rate_per_minute{entity=\"";
+        appendLabelValue(out, m_sensors[idx].entity->get_name().c_str());
+        (void)snprintf(line, sizeof(line), "\"} %.3f\n", static_cast<double>(m_sensors[idx].rate * 60000.0F));
+        out += line;
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+size_t IVTRego6xxAdaptiveSampling::findSensor(const EntityBase* entity) const
+{
+    size_t idx = 0U;
+
+    while ((idx < m_sensorCount) && (entity != m_sensors[idx].entity))
+    {
+        ++idx;
+    }
+
+    return (idx < m_sensorCount) ? idx : MAX_SENSORS;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
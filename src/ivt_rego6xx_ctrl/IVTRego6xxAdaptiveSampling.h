@@ -0,0 +1,195 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Rate-of-change adaptive sampling
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <stdint.h>
+#include "esphome/core/component.h"
+#include <string>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * Adapts the read period of a sensor to the rate of change of its value.
+ *
+ * The rate of change is estimated from the recent samples by an exponential
+ * moving average. The read period is the time, after which the value is
+ * expected to drift by the tolerance. A flat sensor is read less often, its
+ * period is at most doubled per sample. A moving sensor is read more often
+ * at once. The period stays within the configured bounds.
+ */
+class IVTRego6xxAdaptiveSampling
+{
+public:
+
+    /** Maximum number of sensors, which covers all sensors of the controller. */
+    static const size_t MAX_SENSORS = 11U;
+
+    /**
+     * Constructs the adaptive sampling.
+     */
+    IVTRego6xxAdaptiveSampling() :
+        m_sensorCount(0U),
+        m_sensors()
+    {
+    }
+
+    /**
+     * Destroys the adaptive sampling.
+     */
+    ~IVTRego6xxAdaptiveSampling()
+    {
+    }
+
+    /**
+     * Add a sensor, whose read period shall be adapted.
+     *
+     * @param[in] entity    Sensor
+     * @param[in] minPeriod Minimum read period in ms
+     * @param[in] maxPeriod Maximum read period in ms
+     * @param[in] tolerance Change of the value, which is tolerated between two reads.
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addSensor(const EntityBase* entity, uint32_t minPeriod, uint32_t maxPeriod, float tolerance);
+
+    /**
+     * Get the number of sensors.
+     *
+     * @return Number of sensors
+     */
+    size_t getCount() const
+    {
+        return m_sensorCount;
+    }
+
+    /**
+     * Update the value of a read sensor and adapt its read period.
+     *
+     * @param[in] entity    Sensor
+     * @param[in] value     Read value
+     *
+     * @return Adapted read period in ms or 0 if the sensor is not adaptive.
+     */
+    uint32_t update(const EntityBase* entity, float value);
+
+    /**
+     * Get the adapted read period of a sensor.
+     *
+     * @param[in] entity    Sensor
+     *
+     * @return Read period in ms or 0 if the sensor is not adaptive.
+     */
+    uint32_t getPeriod(const EntityBase* entity) const;
+
+    /**
+     * Append the adapted read period and the estimated rate of change of every
+     * sensor in the Prometheus text format.
+     *
+     * @param[out] out  Output
+     */
+    void writeMetrics(std::string& out) const;
+
+private:
+
+    /**
+     * Sampling state of a single sensor.
+     */
+    struct SensorSampling
+    {
+        const EntityBase* entity;       /**< Sensor */
+        uint32_t          minPeriod;    /**< Minimum read period in ms */
+        uint32_t          maxPeriod;    /**< Maximum read period in ms */
+        float             tolerance;    /**< Change of the value, which is tolerated between two reads. */
+        uint32_t          period;       /**< Adapted read period in ms */
+        float             rate;         /**< Estimated rate of change per ms */
+        float             lastValue;    /**< Last read value */
+        uint32_t          lastRead;     /**< Timestamp of the last read value in ms. */
+        uint8_t           samples;      /**< Number of samples, saturated at 2. */
+    };
+
+    /**
+     * Weight of a new sample in the rate of change estimation.
+     * A half follows a compressor start within two samples, but
+     * ignores a single outlier partly.
+     */
+    static constexpr float RATE_WEIGHT = 0.5F;
+
+    size_t         m_sensorCount;           /**< Number of sensors */
+    SensorSampling m_sensors[MAX_SENSORS];  /**< Sampling state of the sensors */
+
+    IVTRego6xxAdaptiveSampling(const IVTRego6xxAdaptiveSampling& other);
+    IVTRego6xxAdaptiveSampling& operator=(const IVTRego6xxAdaptiveSampling& other);
+
+    /**
+     * Find the sampling state of a sensor.
+     *
+     * @param[in] entity    Sensor
+     *
+     * @return Index of the sensor or MAX_SENSORS if not found.
+     */
+    size_t findSensor(const EntityBase* entity) const;
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
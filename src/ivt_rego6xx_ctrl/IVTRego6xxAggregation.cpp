@@ -0,0 +1,295 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  IVT rego6xx controller windowed aggregation
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IVTRego6xxAggregation.h"
+#include "IVTRego6xxMetrics.h"
+#include "SimpleTimer.hpp"
+#include <stdio.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+namespace esphome
+{
+namespace ivt_rego6xx_ctrl
+{
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool IVTRego6xxAggregation::addSensor(const EntityBase* entity, uint32_t window, bool isSamplePublished)
+{
+    bool isSuccessful = false;
+
+    if ((nullptr != entity) &&
+        (0U < window) &&
+        (MAX_SENSORS > m_sensorCount) &&
+        (MAX_SENSORS == findSensor(entity)))
+    {
+        SensorAggregation& aggregation = m_sensors[m_sensorCount];
+
+        aggregation.entity            = entity;
+        aggregation.window            = window;
+        aggregation.isSamplePublished = isSamplePublished;
+        aggregation.windowStart       = 0U;
+        aggregation.isResultNew       = false;
+        aggregation.windows           = 0U;
+        aggregation.samples           = 0U;
+        clearWindow(aggregation.current);
+        clearWindow(aggregation.result);
+
+        ++m_sensorCount;
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+void IVTRego6xxAggregation::begin()
+{
+    uint32_t now = SimpleTimer::now();
+    size_t   idx = 0U;
+
+    for (idx = 0U; idx < m_sensorCount; ++idx)
+    {
+        m_sensors[idx].windowStart = now;
+    }
+}
+
+void IVTRego6xxAggregation::update(const EntityBase* entity, float value)
+{
+    size_t idx = findSensor(entity);
+
+    if (MAX_SENSORS > idx)
+    {
+        SensorAggregation& aggregation = m_sensors[idx];
+        Window&            current     = aggregation.current;
+
+        if (0U == current.count)
+        {
+            current.min = value;
+            current.max = value;
+        }
+        else if (value < current.min)
+        {
+            current.min = value;
+        }
+        else if (value > current.max)
+        {
+            current.max = value;
+        }
+        else
+        {
+            ;
+        }
+
+        current.sum  += value;
+        current.last  = value;
+        ++current.count;
+        ++aggregation.samples;
+    }
+}
+
+bool IVTRego6xxAggregation::isSamplePublished(const EntityBase* entity) const
+{
+    bool   isPublished = true;
+    size_t idx         = findSensor(entity);
+
+    if (MAX_SENSORS > idx)
+    {
+        isPublished = m_sensors[idx].isSamplePublished;
+    }
+
+    return isPublished;
+}
+
+bool IVTRego6xxAggregation::process()
+{
+    bool     isClosed = false;
+    uint32_t now      = SimpleTimer::now();
+    size_t   idx      = 0U;
+
+    for (idx = 0U; idx < m_sensorCount; ++idx)
+    {
+        SensorAggregation& aggregation = m_sensors[idx];
+
+        aggregation.isResultNew = false;
+
+        if (aggregation.window <= (now - aggregation.windowStart))
+        {
+            aggregation.result      = aggregation.current;
+            aggregation.isResultNew = true;
+            clearWindow(aggregation.current);
+            ++aggregation.windows;
+
+            /* The windows stay in their grid, even if the processing was delayed. */
+            aggregation.windowStart += ((now - aggregation.windowStart) / aggregation.window) * aggregation.window;
+
+            isClosed = true;
+        }
+    }
+
+    return isClosed;
+}
+
+bool IVTRego6xxAggregation::getResult(const EntityBase* entity, Statistic statistic, float& value) const
+{
+    bool   isAvailable = false;
+    size_t idx         = findSensor(entity);
+
+    if ((MAX_SENSORS > idx) &&
+        (true == m_sensors[idx].isResultNew))
+    {
+        const Window& result = m_sensors[idx].result;
+
+        /* Only the count is available for a window without any value. */
+        if (STATISTIC_COUNT == statistic)
+        {
+            value       = static_cast<float>(result.count);
+            isAvailable = true;
+        }
+        else if (0U < result.count)
+        {
+            switch (statistic)
+            {
+            case STATISTIC_MIN:
+                value = result.min;
+                break;
+
+            case STATISTIC_MAX:
+                value = result.max;
+                break;
+
+            case STATISTIC_MEAN:
+                value = result.sum / static_cast<float>(result.count);
+                break;
+
+            case STATISTIC_LAST:
+            default:
+                value = result.last;
+                break;
+            }
+
+            isAvailable = true;
+        }
+        else
+        {
+            ;
+        }
+    }
+
+    return isAvailable;
+}
+
+void IVTRego6xxAggregation::writeMetrics(std::string& out) const
+{
+    char   line[32];
+    size_t idx = 0U;
+
+    out += "# TYPE ivt_rego6xx_aggregation_windows_total counter\n";
+    for (idx = 0U; idx < m_sensorCount; ++idx)
+    {
+        out += "ivt_rego6xx_aggregation_windows_total{entity=\"";
+        appendLabelValue(out, m_sensors[idx].entity->get_name().c_str());
+        (void)snprintf(line, sizeof(line), "\"} %u\n", static_cast<unsigned int>(m_sensors[idx].windows));
+        out += line;
+    }
+
+    out += "# TYPE ivt_rego6xx_aggregation_samples_total counter\n";
+    for (idx = 0U; idx < m_sensorCount; ++idx)
+    {
+        out += "ivt_rego6xx_aggregation_samples_total{entity=\"";
+        appendLabelValue(out, m_sensors[idx].entity->get_name().c_str());
+        (void)snprintf(line, sizeof(line), "\"} %u\n", static_cast<unsigned int>(m_sensors[idx].samples));
+        out += line;
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+size_t IVTRego6xxAggregation::findSensor(const EntityBase* entity) const
+{
+    size_t idx = 0U;
+
+    while ((idx < m_sensorCount) && (entity != m_sensors[idx].entity))
+    {
+        ++idx;
+    }
+
+    return (idx < m_sensorCount) ? idx : MAX_SENSORS;
+}
+
+void IVTRego6xxAggregation::clearWindow(Window& window)
+{
+    window.count = 0U;
+    window.min   = 0.0F;
+    window.max   = 0.0F;
+    window.sum   = 0.0F;
+    window.last  = 0.0F;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
@@ -0,0 +1,237 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  IVT rego6xx controller windowed aggregation
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <stdint.h>
+#include "esphome/core/component.h"
+#include <string>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * Aggregates the read values of a sensor over consecutive windows.
+ *
+ * Every read value updates the statistics of the current window in O(1).
+ * After the window elapsed, its statistics are provided until the next
+ * window elapsed, so a short spike is kept by the maximum or minimum,
+ * although only one value per statistic and window is published.
+ */
+class IVTRego6xxAggregation
+{
+public:
+
+    /** Maximum number of sensors, which covers all sensors of the controller. */
+    static const size_t MAX_SENSORS = 11U;
+
+    /**
+     * Statistics of a window.
+     */
+    enum Statistic
+    {
+        STATISTIC_MIN = 0U, /**< Minimum value */
+        STATISTIC_MAX,      /**< Maximum value */
+        STATISTIC_MEAN,     /**< Arithmetic mean of the values */
+        STATISTIC_LAST,     /**< Last value */
+        STATISTIC_COUNT     /**< Number of values */
+    };
+
+    /**
+     * Constructs the aggregation.
+     */
+    IVTRego6xxAggregation() :
+        m_sensorCount(0U),
+        m_sensors()
+    {
+    }
+
+    /**
+     * Destroys the aggregation.
+     */
+    ~IVTRego6xxAggregation()
+    {
+    }
+
+    /**
+     * Add a sensor, whose values shall be aggregated.
+     *
+     * @param[in] entity            Sensor
+     * @param[in] window            Window duration in ms
+     * @param[in] isSamplePublished Shall every read value still be published by the sensor?
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addSensor(const EntityBase* entity, uint32_t window, bool isSamplePublished);
+
+    /**
+     * Get the number of sensors.
+     *
+     * @return Number of sensors
+     */
+    size_t getCount() const
+    {
+        return m_sensorCount;
+    }
+
+    /**
+     * Start the first window of every sensor.
+     */
+    void begin();
+
+    /**
+     * Update the current window of a sensor with a read value.
+     *
+     * @param[in] entity    Sensor
+     * @param[in] value     Read value
+     */
+    void update(const EntityBase* entity, float value);
+
+    /**
+     * Shall a read value of a sensor be published by the sensor itself?
+     *
+     * @param[in] entity    Sensor
+     *
+     * @return If the value shall be published, it will return true otherwise false.
+     */
+    bool isSamplePublished(const EntityBase* entity) const;
+
+    /**
+     * Close every elapsed window.
+     *
+     * @return If at least one window was closed, it will return true otherwise false.
+     */
+    bool process();
+
+    /**
+     * Get a statistic of the last closed window of a sensor.
+     *
+     * @param[in]  entity       Sensor
+     * @param[in]  statistic    Statistic
+     * @param[out] value        Value of the statistic
+     *
+     * @return If the window was closed by the last process() and the statistic is available, it will return true otherwise false.
+     */
+    bool getResult(const EntityBase* entity, Statistic statistic, float& value) const;
+
+    /**
+     * Append the closed windows and aggregated samples in the Prometheus text format.
+     *
+     * @param[out] out  Output
+     */
+    void writeMetrics(std::string& out) const;
+
+private:
+
+    /**
+     * Statistics of a single window.
+     */
+    struct Window
+    {
+        uint32_t count; /**< Number of values */
+        float    min;   /**< Minimum value */
+        float    max;   /**< Maximum value */
+        float    sum;   /**< Sum of the values */
+        float    last;  /**< Last value */
+    };
+
+    /**
+     * Aggregation of a single sensor.
+     */
+    struct SensorAggregation
+    {
+        const EntityBase* entity;            /**< Sensor */
+        uint32_t          window;            /**< Window duration in ms */
+        bool              isSamplePublished; /**< Shall every read value be published by the sensor? */
+        uint32_t          windowStart;       /**< Timestamp in ms, when the current window started. */
+        Window            current;           /**< Current window */
+        Window            result;            /**< Last closed window */
+        bool              isResultNew;       /**< Was the last window closed by the last process()? */
+        uint32_t          windows;           /**< Number of closed windows */
+        uint32_t          samples;           /**< Number of aggregated values */
+    };
+
+    size_t            m_sensorCount;          /**< Number of sensors */
+    SensorAggregation m_sensors[MAX_SENSORS]; /**< Aggregations of the sensors */
+
+    IVTRego6xxAggregation(const IVTRego6xxAggregation& other);
+    IVTRego6xxAggregation& operator=(const IVTRego6xxAggregation& other);
+
+    /**
+     * Find the aggregation of a sensor.
+     *
+     * @param[in] entity    Sensor
+     *
+     * @return Index of the sensor or MAX_SENSORS if not found.
+     */
+    size_t findSensor(const EntityBase* entity) const;
+
+    /**
+     * Clear the statistics of a window.
+     *
+     * @param[out] window   Window
+     */
+    static void clearWindow(Window& window);
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
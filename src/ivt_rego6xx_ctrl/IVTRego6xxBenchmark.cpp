@@ -0,0 +1,487 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Microbenchmarks of the Rego6xx frame handling
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IVTRego6xxBenchmark.h"
+
+#ifdef IVT_REGO6XX_BENCHMARK
+
+#include "IVTRego6xxCtrl.h"
+#include "Rego6xxUtil.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <string>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+extern "C"
+{
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t num, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size);
+void* __wrap_calloc(size_t num, size_t size);
+void* __wrap_realloc(void* ptr, size_t size);
+
+}
+
+namespace esphome
+{
+namespace ivt_rego6xx_ctrl
+{
+
+static void countAlloc();
+static size_t encodeText(uint8_t* buffer, size_t size, const char* text);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/**
+ * Logger tag of this component.
+ */
+static const char* TAG = "ivt_rego6xx_ctrl.benchmark";
+
+/** Number of heap allocations of the counting task. */
+static volatile uint32_t     allocCounter = 0U;
+
+/** Only heap allocations of this task are counted, which excludes the network stack. */
+static volatile TaskHandle_t countingTask = nullptr;
+
+/** Results of the code under test end up here, so the compiler can't remove it. */
+static volatile uint32_t     resultSink   = 0U;
+
+/** Standard response with the value 24.5 °C. */
+static const uint8_t STD_RSP[]     = { Rego6xxCtrl::DEV_ADDR_HOST, 0x00U, 0x01U, 0x75U, 0x74U };
+
+/** Command frame, without device address, command id and checksum. */
+static const uint8_t CMD_PAYLOAD[] = { 0x00U, 0x04U, 0x09U, 0x00U, 0x00U, 0x00U };
+
+/** Display row, encoded in iso-8859-1. */
+static const char*   DISPLAY_ROW   = "GT1 Radiator 23.4\xB0" "C";
+
+/** Error log line. */
+static const char*   ERROR_LOG     = "240119 12:34:56";
+
+/** Error id of the error response. */
+static const uint8_t ERROR_ID      = 13U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool IVTRego6xxBenchmark::process()
+{
+    bool isFinished = false;
+
+    countingTask = xTaskGetCurrentTaskHandle();
+
+    switch (m_case)
+    {
+    case 0U:
+        benchWriteCmd();
+        break;
+
+    case 1U:
+        benchChecksumCmd();
+        break;
+
+    case 2U:
+        benchChecksumDisplay();
+        break;
+
+    case 3U:
+        benchGetValue();
+        break;
+
+    case 4U:
+        benchGetMsg();
+        break;
+
+    case 5U:
+        benchErrorRsp();
+        break;
+
+    case 6U:
+        benchToFloat();
+        break;
+
+    case 7U:
+        benchFromFloat();
+        break;
+
+    case 8U:
+        benchIso8859ToUtf8();
+        break;
+
+    default:
+        isFinished = true;
+        break;
+    }
+
+    countingTask = nullptr;
+
+    if (false == isFinished)
+    {
+        ++m_case;
+    }
+
+    return isFinished;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void IVTRego6xxBenchmark::receive(const Rego6xxRsp* rsp, const uint8_t* response, size_t size)
+{
+    m_stream.setResponse(response, size);
+
+    /* The first call starts the response timeout observation and the
+     * second one reads the complete response.
+     */
+    while (true == rsp->isPending())
+    {
+        m_ctrl.process();
+    }
+}
+
+void IVTRego6xxBenchmark::begin()
+{
+    m_startAllocs = allocCounter;
+    m_startTime   = micros();
+}
+
+void IVTRego6xxBenchmark::end(const char* name)
+{
+    uint32_t duration = micros() - m_startTime;
+    uint32_t allocs   = allocCounter - m_startAllocs;
+    float    nsPerOp  = (static_cast<float>(duration) * 1000.0F) / static_cast<float>(ITERATIONS);
+    float    allocsOp = static_cast<float>(allocs) / static_cast<float>(ITERATIONS);
+
+    resultSink = m_sink;
+
+    ESP_LOGI(TAG, "BENCH %-24s %10.1f ns/op %8.2f allocs/op", name, nsPerOp, allocsOp);
+}
+
+void IVTRego6xxBenchmark::benchWriteCmd()
+{
+    uint32_t idx = 0U;
+
+    begin();
+
+    for (idx = 0U; idx < ITERATIONS; ++idx)
+    {
+        if (nullptr != m_ctrl.readStd(Rego6xxCtrl::CMD_ID_READ_SYSTEM_REG, Rego6xxCtrl::SYSREG_ADDR_GT1))
+        {
+            m_ctrl.release();
+        }
+    }
+
+    end("writeCmd");
+}
+
+void IVTRego6xxBenchmark::benchChecksumCmd()
+{
+    uint32_t idx = 0U;
+
+    begin();
+
+    for (idx = 0U; idx < ITERATIONS; ++idx)
+    {
+        m_sink += Rego6xxUtil::calculateChecksum(CMD_PAYLOAD, sizeof(CMD_PAYLOAD));
+    }
+
+    end("calculateChecksum/6");
+}
+
+void IVTRego6xxBenchmark::benchChecksumDisplay()
+{
+    uint8_t  response[42U];
+    uint32_t idx = 0U;
+
+    (void)encodeText(response, sizeof(response), DISPLAY_ROW);
+
+    begin();
+
+    for (idx = 0U; idx < ITERATIONS; ++idx)
+    {
+        m_sink += Rego6xxUtil::calculateChecksum(&response[1U], sizeof(response) - 2U);
+    }
+
+    end("calculateChecksum/40");
+}
+
+void IVTRego6xxBenchmark::benchGetValue()
+{
+    const Rego6xxStdRsp* rsp = m_ctrl.readStd(Rego6xxCtrl::CMD_ID_READ_SYSTEM_REG, Rego6xxCtrl::SYSREG_ADDR_GT1);
+
+    if (nullptr != rsp)
+    {
+        uint32_t idx = 0U;
+
+        receive(rsp, STD_RSP, sizeof(STD_RSP));
+
+        begin();
+
+        for (idx = 0U; idx < ITERATIONS; ++idx)
+        {
+            m_sink += rsp->getValue();
+        }
+
+        end("Rego6xxStdRsp::getValue");
+
+        m_ctrl.release();
+    }
+}
+
+void IVTRego6xxBenchmark::benchGetMsg()
+{
+    const Rego6xxDisplayRsp* rsp = m_ctrl.readDisplay(Rego6xxCtrl::CMD_ID_READ_DISPLAY, Rego6xxCtrl::DISPLAY_ROW_1);
+
+    if (nullptr != rsp)
+    {
+        uint8_t  response[42U];
+        size_t   size = encodeText(response, sizeof(response), DISPLAY_ROW);
+        uint32_t idx  = 0U;
+
+        receive(rsp, response, size);
+
+        begin();
+
+        for (idx = 0U; idx < ITERATIONS; ++idx)
+        {
+            String msg = rsp->getMsg();
+
+            m_sink += msg.length();
+        }
+
+        end("Rego6xxDisplayRsp::getMsg");
+
+        m_ctrl.release();
+    }
+}
+
+void IVTRego6xxBenchmark::benchErrorRsp()
+{
+    const Rego6xxErrorRsp* rsp = m_ctrl.readLastError();
+
+    if (nullptr != rsp)
+    {
+        uint8_t  response[42U];
+        char     text[18U];
+        size_t   size = 0U;
+        uint32_t idx  = 0U;
+
+        /* The error id is encoded like a character in front of the log. */
+        text[0U] = static_cast<char>(ERROR_ID);
+        strncpy(&text[1U], ERROR_LOG, sizeof(text) - 1U);
+        text[sizeof(text) - 1U] = '\0';
+        size = encodeText(response, sizeof(response), text);
+
+        receive(rsp, response, size);
+
+        begin();
+
+        for (idx = 0U; idx < ITERATIONS; ++idx)
+        {
+            String log = rsp->getErrorLog();
+
+            m_sink += rsp->getErrorId();
+            m_sink += log.length();
+            m_sink += strlen(rsp->getErrorDescription());
+        }
+
+        end("Rego6xxErrorRsp decode");
+
+        m_ctrl.release();
+    }
+}
+
+void IVTRego6xxBenchmark::benchToFloat()
+{
+    uint32_t idx = 0U;
+
+    begin();
+
+    for (idx = 0U; idx < ITERATIONS; ++idx)
+    {
+        /* Alternate between positive and negative values. */
+        float value = m_ctrl.toFloat((0U == (idx & 1U)) ? 245U : 0xFF9CU);
+
+        m_sink += static_cast<uint32_t>(value);
+    }
+
+    end("Rego6xxCtrl::toFloat");
+}
+
+void IVTRego6xxBenchmark::benchFromFloat()
+{
+    uint32_t idx = 0U;
+
+    begin();
+
+    for (idx = 0U; idx < ITERATIONS; ++idx)
+    {
+        m_sink += m_ctrl.fromFloat((0U == (idx & 1U)) ? 24.5F : -10.0F);
+    }
+
+    end("Rego6xxCtrl::fromFloat");
+}
+
+void IVTRego6xxBenchmark::benchIso8859ToUtf8()
+{
+    uint32_t idx = 0U;
+
+    begin();
+
+    for (idx = 0U; idx < ITERATIONS; ++idx)
+    {
+        std::string output;
+
+        IVTRego6xxCtrl::iso8859_1_to_utf8(DISPLAY_ROW, output);
+
+        m_sink += output.size();
+    }
+
+    end("iso8859_1_to_utf8");
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Count a heap allocation, if it is requested by the counting task.
+ */
+static void countAlloc()
+{
+    if ((nullptr != countingTask) &&
+        (xTaskGetCurrentTaskHandle() == countingTask))
+    {
+        ++allocCounter;
+    }
+}
+
+/**
+ * Encode a text like the Rego6xx controller does in a display or error
+ * response. Every character is split up into two bytes with 4 bit each.
+ * The response is completed with the device address and checksum.
+ *
+ * @param[out] buffer   Response buffer
+ * @param[in]  size     Response buffer size in byte
+ * @param[in]  text     Text
+ *
+ * @return Response size in byte
+ */
+static size_t encodeText(uint8_t* buffer, size_t size, const char* text)
+{
+    size_t idx = 1U;
+
+    memset(buffer, 0, size);
+
+    buffer[0U] = Rego6xxCtrl::DEV_ADDR_HOST;
+
+    while (('\0' != *text) && ((idx + 2U) < size))
+    {
+        uint8_t character = static_cast<uint8_t>(*text);
+
+        buffer[idx + 0U] = (character >> 4U) & 0x0FU;
+        buffer[idx + 1U] = (character >> 0U) & 0x0FU;
+
+        idx += 2U;
+        ++text;
+    }
+
+    buffer[size - 1U] = Rego6xxUtil::calculateChecksum(&buffer[1U], size - 2U);
+
+    return size;
+}
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/**
+ * Heap allocation wrappers, activated by the linker option
+ * -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc.
+ */
+extern "C"
+{
+
+void* __wrap_malloc(size_t size)
+{
+    esphome::ivt_rego6xx_ctrl::countAlloc();
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t num, size_t size)
+{
+    esphome::ivt_rego6xx_ctrl::countAlloc();
+    return __real_calloc(num, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size)
+{
+    esphome::ivt_rego6xx_ctrl::countAlloc();
+    return __real_realloc(ptr, size);
+}
+
+}
+
+#endif /* IVT_REGO6XX_BENCHMARK */
@@ -0,0 +1,296 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Microbenchmarks of the Rego6xx frame handling
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "esphome/core/defines.h"
+
+#ifdef IVT_REGO6XX_BENCHMARK
+
+#include "Rego6xxCtrl.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * Stream, which takes the place of the heatpump during the benchmarks.
+ * Written commands are discarded and a preset response is provided.
+ */
+class IVTRego6xxBenchmarkStream : public Stream
+{
+public:
+
+    /**
+     * Constructs the benchmark stream.
+     */
+    IVTRego6xxBenchmarkStream() :
+        m_response(nullptr),
+        m_size(0U),
+        m_idx(0U)
+    {
+    }
+
+    /**
+     * Destroys the benchmark stream.
+     */
+    ~IVTRego6xxBenchmarkStream()
+    {
+    }
+
+    /**
+     * Set the response, which is provided once.
+     *
+     * @param[in] response  Response
+     * @param[in] size      Response size in byte
+     */
+    void setResponse(const uint8_t* response, size_t size)
+    {
+        m_response = response;
+        m_size     = size;
+        m_idx      = 0U;
+    }
+
+    /**
+     * Get the number of available data.
+     *
+     * @return Number of byte which are available
+     */
+    int available() override
+    {
+        return static_cast<int>(m_size - m_idx);
+    }
+
+    /**
+     * Read a single data byte.
+     *
+     * @return Single data byte or -1 if no byte is available.
+     */
+    int read() override
+    {
+        int data = -1;
+
+        if (m_size > m_idx)
+        {
+            data = m_response[m_idx];
+            ++m_idx;
+        }
+
+        return data;
+    }
+
+    /**
+     * Read a single data byte, but without increasing the internal read position.
+     *
+     * @return Single data byte or -1 if no byte is available.
+     */
+    int peek() override
+    {
+        return (m_size > m_idx) ? m_response[m_idx] : -1;
+    }
+
+    /**
+     * Write a single data byte. It is discarded.
+     *
+     * @param[in] data  Single data byte
+     *
+     * @return Number of written data byte
+     */
+    size_t write(uint8_t data) override
+    {
+        (void)data;
+        return 1U;
+    }
+
+private:
+
+    const uint8_t* m_response; /**< Response, which is provided. */
+    size_t         m_size;     /**< Response size in byte */
+    size_t         m_idx;      /**< Read index in the response. */
+};
+
+/**
+ * Microbenchmarks of the hot paths of the frame handling and value conversion.
+ * One benchmark is run per call to process(), so the main loop is not
+ * blocked for a longer time. Every result is logged as one line:
+ *
+ *      BENCH <name> <ns/op> ns/op <allocs/op> allocs/op
+ *
+ * Heap allocations are counted by wrapping malloc(), calloc() and realloc()
+ * at link time, see the benchmark option of the component.
+ */
+class IVTRego6xxBenchmark
+{
+public:
+
+    /**
+     * Constructs the microbenchmarks.
+     */
+    IVTRego6xxBenchmark() :
+        m_stream(),
+        m_ctrl(m_stream),
+        m_case(0U),
+        m_startTime(0U),
+        m_startAllocs(0U),
+        m_sink(0U)
+    {
+    }
+
+    /**
+     * Destroys the microbenchmarks.
+     */
+    ~IVTRego6xxBenchmark()
+    {
+    }
+
+    /**
+     * Run the next benchmark.
+     *
+     * @return If all benchmarks are finished, it will return true otherwise false.
+     */
+    bool process();
+
+private:
+
+    /** Number of iterations per benchmark. */
+    static const uint32_t     ITERATIONS = 10000U;
+
+    IVTRego6xxBenchmarkStream m_stream;      /**< Stream, which takes the place of the heatpump. */
+    Rego6xxCtrl               m_ctrl;        /**< Rego6xx controller under test. */
+    size_t                    m_case;        /**< Index of the next benchmark. */
+    uint32_t                  m_startTime;   /**< Start time of the measurement in us. */
+    uint32_t                  m_startAllocs; /**< Number of heap allocations at the start of the measurement. */
+    uint32_t                  m_sink;        /**< Results of the code under test are accumulated here. */
+
+    IVTRego6xxBenchmark(const IVTRego6xxBenchmark& other);
+    IVTRego6xxBenchmark& operator=(const IVTRego6xxBenchmark& other);
+
+    /**
+     * Let the controller receive the given response to the pending request.
+     *
+     * @param[in] rsp       Pending response
+     * @param[in] response  Response
+     * @param[in] size      Response size in byte
+     */
+    void receive(const Rego6xxRsp* rsp, const uint8_t* response, size_t size);
+
+    /**
+     * Start a measurement.
+     */
+    void begin();
+
+    /**
+     * Finish a measurement and log the result.
+     *
+     * @param[in] name  Benchmark name
+     */
+    void end(const char* name);
+
+    /**
+     * Benchmark the command frame construction of Rego6xxCtrl::writeCmd().
+     */
+    void benchWriteCmd();
+
+    /**
+     * Benchmark Rego6xxUtil::calculateChecksum() over a command frame.
+     */
+    void benchChecksumCmd();
+
+    /**
+     * Benchmark Rego6xxUtil::calculateChecksum() over a display response.
+     */
+    void benchChecksumDisplay();
+
+    /**
+     * Benchmark Rego6xxStdRsp::getValue().
+     */
+    void benchGetValue();
+
+    /**
+     * Benchmark Rego6xxDisplayRsp::getMsg().
+     */
+    void benchGetMsg();
+
+    /**
+     * Benchmark the decoding of a Rego6xxErrorRsp.
+     */
+    void benchErrorRsp();
+
+    /**
+     * Benchmark Rego6xxCtrl::toFloat().
+     */
+    void benchToFloat();
+
+    /**
+     * Benchmark Rego6xxCtrl::fromFloat().
+     */
+    void benchFromFloat();
+
+    /**
+     * Benchmark IVTRego6xxCtrl::iso8859_1_to_utf8().
+     */
+    void benchIso8859ToUtf8();
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+#endif /* IVT_REGO6XX_BENCHMARK */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
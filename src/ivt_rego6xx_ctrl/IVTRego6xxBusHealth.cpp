@@ -0,0 +1,363 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Health of the bus to the heatpump
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IVTRego6xxBusHealth.h"
+#include "Rego6xxCtrl.h"
+#include "SimpleTimer.hpp"
+#include "IVTRego6xxMetrics.h"
+#include <stdio.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+namespace esphome
+{
+namespace ivt_rego6xx_ctrl
+{
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Label values of the failure classes in the metrics. */
+static const char* FAILURE_LABELS[IVTRego6xxBusHealth::FAILURE_COUNT] = {
+    "timeout",
+    "invalid",
+    "wrong_destination"
+};
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool IVTRego6xxBusHealth::addEntity(const EntityBase* entity)
+{
+    bool isSuccessful = false;
+
+    if ((nullptr != entity) &&
+        (MAX_ENTITIES > m_entityCount))
+    {
+        EntityCounters& counters = m_entities[m_entityCount];
+        size_t          idx      = 0U;
+
+        counters.entity   = entity;
+        counters.requests = 0U;
+
+        for (idx = 0U; idx < FAILURE_COUNT; ++idx)
+        {
+            counters.failures[idx] = 0U;
+        }
+
+        ++m_entityCount;
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+bool IVTRego6xxBusHealth::countResponse(const EntityBase* entity, const Rego6xxRsp& rsp)
+{
+    EntityCounters* counters = findEntity(entity);
+    Failure         failure  = FAILURE_COUNT;
+
+    /* Same classification order as the response evaluation by the component. */
+    if (true == rsp.isTimeout())
+    {
+        failure = FAILURE_TIMEOUT;
+    }
+    else if (false == rsp.isValid())
+    {
+        failure = FAILURE_INVALID;
+    }
+    else if (Rego6xxCtrl::DEV_ADDR_HOST != rsp.getDevAddr())
+    {
+        failure = FAILURE_WRONG_DEST;
+    }
+    else
+    {
+        ;
+    }
+
+    ++m_requests;
+
+    if (nullptr != counters)
+    {
+        ++counters->requests;
+    }
+
+    if (FAILURE_COUNT > failure)
+    {
+        ++m_failures[failure];
+
+        if (nullptr != counters)
+        {
+            ++counters->failures[failure];
+        }
+    }
+
+    return (FAILURE_COUNT == failure);
+}
+
+void IVTRego6xxBusHealth::updateTraffic(const Rego6xxRecorder& recorder, uint32_t baudRate)
+{
+    uint32_t timestamp = SimpleTimer::now();
+    uint32_t duration  = timestamp - m_timestamp;
+    uint32_t txFrames  = recorder.getTxFrames();
+    uint32_t txBytes   = recorder.getTxBytes();
+    uint32_t rxFrames  = recorder.getRxFrames();
+    uint32_t rxBytes   = recorder.getRxBytes();
+
+    if (0U < duration)
+    {
+        float seconds = static_cast<float>(duration) / 1000.0F;
+
+        /* The counters may wrap around, but the difference is still right. */
+        m_txFrameRate = static_cast<float>(txFrames - m_txFrames) / seconds;
+        m_rxFrameRate = static_cast<float>(rxFrames - m_rxFrames) / seconds;
+        m_txByteRate  = static_cast<float>(txBytes - m_txBytes) / seconds;
+        m_rxByteRate  = static_cast<float>(rxBytes - m_rxBytes) / seconds;
+
+        /* The protocol is strictly request/response, so only one direction
+         * occupies the bus at a time.
+         */
+        if (0U < baudRate)
+        {
+            float bitRate = (m_txByteRate + m_rxByteRate) * static_cast<float>(BITS_PER_BYTE);
+
+            m_utilisation = (bitRate * 100.0F) / static_cast<float>(baudRate);
+        }
+    }
+
+    m_timestamp = timestamp;
+    m_txFrames  = txFrames;
+    m_txBytes   = txBytes;
+    m_rxFrames  = rxFrames;
+    m_rxBytes   = rxBytes;
+}
+
+float IVTRego6xxBusHealth::getMetric(IVTRego6xxBusSensor::Metric metric) const
+{
+    float value = 0.0F;
+
+    switch (metric)
+    {
+    case IVTRego6xxBusSensor::METRIC_REQUESTS:
+        value = static_cast<float>(m_requests);
+        break;
+
+    case IVTRego6xxBusSensor::METRIC_TIMEOUTS:
+        value = static_cast<float>(m_failures[FAILURE_TIMEOUT]);
+        break;
+
+    case IVTRego6xxBusSensor::METRIC_INVALID:
+        value = static_cast<float>(m_failures[FAILURE_INVALID]);
+        break;
+
+    case IVTRego6xxBusSensor::METRIC_WRONG_DEST:
+        value = static_cast<float>(m_failures[FAILURE_WRONG_DEST]);
+        break;
+
+    case IVTRego6xxBusSensor::METRIC_TX_FRAME_RATE:
+        value = m_txFrameRate;
+        break;
+
+    case IVTRego6xxBusSensor::METRIC_RX_FRAME_RATE:
+        value = m_rxFrameRate;
+        break;
+
+    case IVTRego6xxBusSensor::METRIC_TX_BYTE_RATE:
+        value = m_txByteRate;
+        break;
+
+    case IVTRego6xxBusSensor::METRIC_RX_BYTE_RATE:
+        value = m_rxByteRate;
+        break;
+
+    case IVTRego6xxBusSensor::METRIC_UTILISATION:
+        value = m_utilisation;
+        break;
+
+    default:
+        break;
+    }
+
+    return value;
+}
+
+void IVTRego6xxBusHealth::writeMetrics(std::string& out) const
+{
+    size_t part = 0U;
+
+    while (true == writeMetricsPart(out, part))
+    {
+        ++part;
+    }
+}
+
+bool IVTRego6xxBusHealth::writeMetricsPart(std::string& out, size_t part) const
+{
+    bool   isAvailable = true;
+    char   line[96];
+    size_t idx         = 0U;
+
+    /* Parts: global counters, entity requests header, a line per entity,
+     * entity failures header, the lines per entity and the bus traffic.
+     */
+    if (0U == part)
+    {
+        out += "# TYPE ivt_rego6xx_requests_total counter\n";
+        (void)snprintf(line, sizeof(line), "ivt_rego6xx_requests_total %u\n", static_cast<unsigned int>(m_requests));
+        out += line;
+
+        out += "# TYPE ivt_rego6xx_failures_total counter\n";
+        for (idx = 0U; idx < FAILURE_COUNT; ++idx)
+        {
+            (void)snprintf(line, sizeof(line), "ivt_rego6xx_failures_total{class=\"%s\"} %u\n", FAILURE_LABELS[idx], static_cast<unsigned int>(m_failures[idx]));
+            out += line;
+        }
+
+        out += "# TYPE ivt_rego6xx_entity_requests_total counter\n";
+    }
+    else if (m_entityCount >= part)
+    {
+        const EntityCounters& counters = m_entities[part - 1U];
+
+        out += "ivt_rego6xx_entity_requests_total{entity=\"";
+        appendLabelValue(out, counters.entity->get_name().c_str());
+        (void)snprintf(line, sizeof(line), "\"} %u\n", static_cast<unsigned int>(counters.requests));
+        out += line;
+    }
+    else if ((m_entityCount + 1U) == part)
+    {
+        out += "# TYPE ivt_rego6xx_entity_failures_total counter\n";
+    }
+    else if (((2U * m_entityCount) + 1U) >= part)
+    {
+        const EntityCounters& counters = m_entities[part - m_entityCount - 2U];
+
+        for (idx = 0U; idx < FAILURE_COUNT; ++idx)
+        {
+            out += "ivt_rego6xx_entity_failures_total{entity=\"";
+            appendLabelValue(out, counters.entity->get_name().c_str());
+            (void)snprintf(line, sizeof(line), "\",class=\"%s\"} %u\n", FAILURE_LABELS[idx], static_cast<unsigned int>(counters.failures[idx]));
+            out += line;
+        }
+    }
+    else if (((2U * m_entityCount) + 2U) == part)
+    {
+        out += "# TYPE ivt_rego6xx_bus_frames_total counter\n";
+        (void)snprintf(line, sizeof(line), "ivt_rego6xx_bus_frames_total{direction=\"tx\"} %u\n", static_cast<unsigned int>(m_txFrames));
+        out += line;
+        (void)snprintf(line, sizeof(line), "ivt_rego6xx_bus_frames_total{direction=\"rx\"} %u\n", static_cast<unsigned int>(m_rxFrames));
+        out += line;
+
+        out += "# TYPE ivt_rego6xx_bus_bytes_total counter\n";
+        (void)snprintf(line, sizeof(line), "ivt_rego6xx_bus_bytes_total{direction=\"tx\"} %u\n", static_cast<unsigned int>(m_txBytes));
+        out += line;
+        (void)snprintf(line, sizeof(line), "ivt_rego6xx_bus_bytes_total{direction=\"rx\"} %u\n", static_cast<unsigned int>(m_rxBytes));
+        out += line;
+
+        out += "# TYPE ivt_rego6xx_bus_frames_per_second gauge\n";
+        (void)snprintf(line, sizeof(line), "ivt_rego6xx_bus_frames_per_second{direction=\"tx\"} %.3f\n", m_txFrameRate);
+        out += line;
+        (void)snprintf(line, sizeof(line), "ivt_rego6xx_bus_frames_per_second{direction=\"rx\"} %.3f\n", m_rxFrameRate);
+        out += line;
+
+        out += "# TYPE ivt_rego6xx_bus_bytes_per_second gauge\n";
+        (void)snprintf(line, sizeof(line), "ivt_rego6xx_bus_bytes_per_second{direction=\"tx\"} %.3f\n", m_txByteRate);
+        out += line;
+        (void)snprintf(line, sizeof(line), "ivt_rego6xx_bus_bytes_per_second{direction=\"rx\"} %.3f\n", m_rxByteRate);
+        out += line;
+
+        out += "# TYPE ivt_rego6xx_bus_utilisation_percent gauge\n";
+        (void)snprintf(line, sizeof(line), "ivt_rego6xx_bus_utilisation_percent %.3f\n", m_utilisation);
+        out += line;
+    }
+    else
+    {
+        isAvailable = false;
+    }
+
+    return isAvailable;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+IVTRego6xxBusHealth::EntityCounters* IVTRego6xxBusHealth::findEntity(const EntityBase* entity)
+{
+    EntityCounters* counters = nullptr;
+    size_t          idx      = 0U;
+
+    while ((nullptr == counters) && (idx < m_entityCount))
+    {
+        if (entity == m_entities[idx].entity)
+        {
+            counters = &m_entities[idx];
+        }
+
+        ++idx;
+    }
+
+    return counters;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
@@ -0,0 +1,248 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Health of the bus to the heatpump
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "esphome/core/component.h"
+#include "Rego6xxRsp.h"
+#include "Rego6xxRecorder.h"
+#include "sensor/IVTRego6xxBusSensor.h"
+#include <string>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * Keeps monotonic counters of the responses per failure class, in total and
+ * per entity, as well as the traffic rates and the utilisation of the bus.
+ *
+ * The counters are written by the main loop and read by the webserver task.
+ * They are 32 bit wide, which is read atomically.
+ */
+class IVTRego6xxBusHealth
+{
+public:
+
+    /**
+     * Failure classes of a response.
+     */
+    enum Failure
+    {
+        FAILURE_TIMEOUT = 0U, /**< No or incomplete response in time. */
+        FAILURE_INVALID,      /**< Response with invalid checksum. */
+        FAILURE_WRONG_DEST,   /**< Response with wrong destination address. */
+        FAILURE_COUNT         /**< Number of failure classes. */
+    };
+
+    /** Maximum number of entities, which covers all kind of entities of the controller. */
+    static const size_t MAX_ENTITIES    = 39U;
+
+    /** Number of bits on the bus per data byte: start bit, 8 data bits and stop bit. */
+    static const uint32_t BITS_PER_BYTE = 10U;
+
+    /**
+     * Constructs the bus health.
+     */
+    IVTRego6xxBusHealth() :
+        m_requests(0U),
+        m_failures{ 0U },
+        m_entityCount(0U),
+        m_entities(),
+        m_timestamp(0U),
+        m_txFrames(0U),
+        m_txBytes(0U),
+        m_rxFrames(0U),
+        m_rxBytes(0U),
+        m_txFrameRate(0.0F),
+        m_rxFrameRate(0.0F),
+        m_txByteRate(0.0F),
+        m_rxByteRate(0.0F),
+        m_utilisation(0.0F)
+    {
+    }
+
+    /**
+     * Destroys the bus health.
+     */
+    ~IVTRego6xxBusHealth()
+    {
+    }
+
+    /**
+     * Add an entity, whose responses shall be counted separately.
+     *
+     * @param[in] entity    Entity
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addEntity(const EntityBase* entity);
+
+    /**
+     * Count a finished response of an entity and classify its failure.
+     *
+     * @param[in] entity    Entity, which requested the response.
+     * @param[in] rsp       Finished response
+     *
+     * @return If the response is successful, it will return true otherwise false.
+     */
+    bool countResponse(const EntityBase* entity, const Rego6xxRsp& rsp);
+
+    /**
+     * Update the traffic rates and the utilisation since the last update.
+     *
+     * @param[in] recorder  Recorder, which counts the bus traffic.
+     * @param[in] baudRate  Baud rate of the bus. 0 if unknown.
+     */
+    void updateTraffic(const Rego6xxRecorder& recorder, uint32_t baudRate);
+
+    /**
+     * Get the number of requests, which were answered or timed out.
+     *
+     * @return Number of requests
+     */
+    uint32_t getRequests() const
+    {
+        return m_requests;
+    }
+
+    /**
+     * Get the number of failed responses of a failure class.
+     *
+     * @param[in] failure   Failure class
+     *
+     * @return Number of failed responses
+     */
+    uint32_t getFailures(Failure failure) const
+    {
+        return (FAILURE_COUNT > failure) ? m_failures[failure] : 0U;
+    }
+
+    /**
+     * Get the value of a metric, like it is published by a bus health sensor.
+     *
+     * @param[in] metric    Metric
+     *
+     * @return Value of the metric
+     */
+    float getMetric(IVTRego6xxBusSensor::Metric metric) const;
+
+    /**
+     * Append all counters and rates in the Prometheus text format.
+     *
+     * @param[out] out  Output
+     */
+    void writeMetrics(std::string& out) const;
+
+    /**
+     * Append a part of the counters and rates in the Prometheus text format.
+     * Every entity line is a part of its own, so the output can be streamed
+     * with a small buffer.
+     *
+     * @param[out] out  Output
+     * @param[in]  part Part index, starting with 0.
+     *
+     * @return If the part exists, it will return true otherwise false.
+     */
+    bool writeMetricsPart(std::string& out, size_t part) const;
+
+private:
+
+    /**
+     * Response counters of a single entity.
+     */
+    struct EntityCounters
+    {
+        const EntityBase* entity;                  /**< Entity */
+        uint32_t          requests;                /**< Number of requests */
+        uint32_t          failures[FAILURE_COUNT]; /**< Number of failed responses per failure class. */
+    };
+
+    uint32_t       m_requests;                /**< Number of requests, which were answered or timed out. */
+    uint32_t       m_failures[FAILURE_COUNT]; /**< Number of failed responses per failure class. */
+    size_t         m_entityCount;             /**< Number of added entities. */
+    EntityCounters m_entities[MAX_ENTITIES];  /**< Response counters per entity. */
+    uint32_t       m_timestamp;               /**< Timestamp of the last traffic update in ms. */
+    uint32_t       m_txFrames;                /**< Number of sent frames at the last traffic update. */
+    uint32_t       m_txBytes;                 /**< Number of sent bytes at the last traffic update. */
+    uint32_t       m_rxFrames;                /**< Number of received frames at the last traffic update. */
+    uint32_t       m_rxBytes;                 /**< Number of received bytes at the last traffic update. */
+    float          m_txFrameRate;             /**< Sent frames per second. */
+    float          m_rxFrameRate;             /**< Received frames per second. */
+    float          m_txByteRate;              /**< Sent bytes per second. */
+    float          m_rxByteRate;              /**< Received bytes per second. */
+    float          m_utilisation;             /**< Bus utilisation in %. */
+
+    IVTRego6xxBusHealth(const IVTRego6xxBusHealth& other);
+    IVTRego6xxBusHealth& operator=(const IVTRego6xxBusHealth& other);
+
+    /**
+     * Find the counters of an entity.
+     *
+     * @param[in] entity    Entity
+     *
+     * @return Counters of the entity or nullptr if not found.
+     */
+    EntityCounters* findEntity(const EntityBase* entity);
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
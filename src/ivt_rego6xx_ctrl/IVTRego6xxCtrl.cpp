@@ -33,55 +33,1431 @@
  * Includes
  *****************************************************************************/
 #include "IVTRego6xxCtrl.h"
-#include "esphome/core/log.h"
+#include "IVTRego6xxLog.h"
+#include "Rego6xxTracepoint.h"
 #include <string>
 
+#ifdef USE_MQTT
+#include "esphome/components/mqtt/mqtt_client.h"
+#endif /* USE_MQTT */
+
 /******************************************************************************
  * Compiler Switches
  *****************************************************************************/
 
-/******************************************************************************
- * Macros
- *****************************************************************************/
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+namespace esphome
+{
+namespace ivt_rego6xx_ctrl
+{
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/**
+ * Logger tag of this component.
+ */
+static const char* TAG = "ivt_rego6xx_ctrl.component";
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+void IVTRego6xxCtrl::setup()
+{
+    resolveDependencies();
+    groupSensors();
+
+#ifdef IVT_REGO6XX_REPLAY
+    if (false == m_replay.begin())
+    {
+        ESP_LOGE(TAG, "Invalid replay trace!");
+        mark_failed();
+    }
+#endif /* IVT_REGO6XX_REPLAY */
+
+#ifdef IVT_REGO6XX_POLLING_BENCHMARK
+    /* The virtual clock must be active before any timer is started.
+     * The benchmark starts polling with every policy by itself.
+     */
+    m_pollingBenchmark.begin(*this);
+#else /* IVT_REGO6XX_POLLING_BENCHMARK */
+    startPolling();
+#endif /* IVT_REGO6XX_POLLING_BENCHMARK */
+
+    /* The last-known values are published at once, the polling refreshes them. */
+    if (0U < m_warmStartSaveInterval)
+    {
+        restoreValues();
+        m_warmStartTimer.start(m_warmStartSaveInterval);
+    }
+
+    if ((0U < m_latencySensorCount) ||
+        (0U < m_actionLatencySensorCount))
+    {
+        m_latencyTimer.start(LATENCY_PUBLISH_PERIOD);
+    }
+
+    /* The bus traffic rates are provided by the metrics endpoint too,
+     * therefore they are updated even without any bus health sensor.
+     */
+    m_busHealth.updateTraffic(m_recorder, getBaudRate());
+    m_busHealthTimer.start(BUS_HEALTH_PUBLISH_PERIOD);
+
+    m_staleness.begin();
+    m_stalenessTimer.start(STALENESS_CHECK_PERIOD);
+
+    m_loopCostTimer.start(LOOP_COST_PUBLISH_PERIOD);
+
+    if (0U < m_aggregation.getCount())
+    {
+        m_aggregation.begin();
+        m_aggregationTimer.start(AGGREGATION_CHECK_PERIOD);
+    }
+
+    /* The totals continue after a reboot, they are saved batched.
+     * The totals of the polling benchmark or the replay are not kept, otherwise
+     * the next production firmware would continue with them.
+     */
+    if (0U < m_derivedMetrics.getInputCount())
+    {
+#if !defined(IVT_REGO6XX_POLLING_BENCHMARK) && !defined(IVT_REGO6XX_REPLAY)
+        (void)m_derivedMetrics.load();
+
+        if (0U < m_derivedMetricsSaveInterval)
+        {
+            m_derivedMetricsSaveTimer.start(m_derivedMetricsSaveInterval);
+        }
+#endif /* !defined(IVT_REGO6XX_POLLING_BENCHMARK) && !defined(IVT_REGO6XX_REPLAY) */
+
+        m_derivedMetricsTimer.start(DERIVED_PUBLISH_PERIOD);
+    }
+
+    if (0U < m_recorderSize)
+    {
+        if (false == m_recording.allocate(m_recorderSize))
+        {
+            ESP_LOGE(TAG, "Failed to allocate %zu bytes for the UART traffic recording.", m_recorderSize);
+        }
+        else
+        {
+            m_recorder.setSink(&m_recording);
+        }
+    }
+
+    if (0U < m_frameTraceSize)
+    {
+        if (false == m_ctrl.getFrameRing().allocate(m_frameTraceSize))
+        {
+            ESP_LOGE(TAG, "Failed to allocate %zu bytes for the protocol frame trace.", m_frameTraceSize);
+        }
+    }
+
+    if (0U < m_history.getCount())
+    {
+        if (false == m_history.allocate())
+        {
+            ESP_LOGE(TAG, "Failed to allocate the sample history, only %zu bytes available.", m_history.getMemorySize());
+        }
+    }
+
+    if (0U < m_outboxSize)
+    {
+        if (false == m_outbox.allocate(m_outboxSize))
+        {
+            ESP_LOGE(TAG, "Failed to allocate %zu entries for the MQTT outbox.", m_outboxSize);
+        }
+        else
+        {
+            m_outboxReplayTimer.start(m_outboxReplayInterval);
+        }
+    }
+
+    if (0U < m_telemetryInterval)
+    {
+        m_telemetryTimer.start(m_telemetryInterval);
+    }
+
+#ifdef IVT_REGO6XX_MODBUS
+    m_modbusServer.begin(&m_telemetry);
+#endif /* IVT_REGO6XX_MODBUS */
+
+#ifdef USE_WEBSERVER
+    if (nullptr != web_server_base::global_web_server_base)
+    {
+        m_webHandler.setRecording(&m_recording);
+        m_webHandler.setFrameRing(&m_ctrl.getFrameRing());
+        m_webHandler.setBusHealth(&m_busHealth);
+        m_webHandler.setStaleness(&m_staleness);
+        m_webHandler.setActionLatency(&m_actionLatency);
+        m_webHandler.setLoopCost(&m_loopCost);
+        m_webHandler.setDeferredLog(&m_deferredLog);
+
+        if (0U < m_warmStartSaveInterval)
+        {
+            m_webHandler.setWarmStart(&m_warmStart);
+        }
+
+        if (true == m_profiles.isEnabled())
+        {
+            m_webHandler.setPollingProfiles(&m_profiles);
+        }
+
+        if (0U < m_dependencies.getCount())
+        {
+            m_webHandler.setDependencies(&m_dependencies);
+        }
+
+        if (0U < m_adaptiveSampling.getCount())
+        {
+            m_webHandler.setAdaptiveSampling(&m_adaptiveSampling);
+        }
+
+        if (0U < m_samplingGroups.getGroupCount())
+        {
+            m_webHandler.setSamplingGroups(&m_samplingGroups);
+        }
+
+        if (0U < m_derivedMetrics.getInputCount())
+        {
+            m_webHandler.setDerivedMetrics(&m_derivedMetrics);
+        }
+
+        if (0U < m_aggregation.getCount())
+        {
+            m_webHandler.setAggregation(&m_aggregation);
+        }
+
+        if (0U < m_history.getCount())
+        {
+            m_webHandler.setHistory(&m_history);
+        }
+
+        if (true == m_outbox.isEnabled())
+        {
+            m_webHandler.setOutbox(&m_outbox);
+        }
+
+        m_webHandler.setTelemetry(&m_telemetry);
+#ifdef IVT_REGO6XX_MODBUS
+        m_webHandler.setModbusServer(&m_modbusServer);
+#endif /* IVT_REGO6XX_MODBUS */
+        web_server_base::global_web_server_base->add_handler(&m_webHandler);
+    }
+#endif /* USE_WEBSERVER */
+}
+
+void IVTRego6xxCtrl::loop()
+{
+    /* The CPU time is measured, independent of the virtual clock of the polling benchmark. */
+    uint32_t loopStart = micros();
+
+#ifdef IVT_REGO6XX_POLLING_BENCHMARK
+    /* The polling runs under the virtual clock of the benchmark. The virtual
+     * clock is global and jumps over hours, therefore the periodic tasks are
+     * not processed. They would publish garbage diagnostics.
+     */
+    m_pollingBenchmark.process(*this);
+#else /* IVT_REGO6XX_POLLING_BENCHMARK */
+    processPolling();
+    processPeriodicTasks();
+#endif /* IVT_REGO6XX_POLLING_BENCHMARK */
+
+#ifdef IVT_REGO6XX_MODBUS
+    m_modbusServer.process();
+#endif /* IVT_REGO6XX_MODBUS */
+
+#ifdef IVT_REGO6XX_REPLAY
+    if ((false == m_isReplayFinished) &&
+        (true == m_replay.isFinished()))
+    {
+        ESP_LOGI(TAG, "Replay finished: %u commands, %u mismatches.",
+            static_cast<unsigned int>(m_replay.getCommandCount()),
+            static_cast<unsigned int>(m_replay.getMismatchCount()));
+        m_isReplayFinished = true;
+    }
+#endif /* IVT_REGO6XX_REPLAY */
+
+#ifdef IVT_REGO6XX_BENCHMARK
+    if (false == m_isBenchmarkFinished)
+    {
+        m_isBenchmarkFinished = m_benchmark.process();
+    }
+#endif /* IVT_REGO6XX_BENCHMARK */
+
+    m_loopCost.addLoop(micros() - loopStart);
+}
+
+void IVTRego6xxCtrl::on_shutdown()
+{
+    bool isSaved = false;
+
+    /* Keep the latest values over a reboot, e.g. after an OTA update. */
+    if (0U < m_warmStartSaveInterval)
+    {
+        isSaved = m_warmStart.save();
+    }
+
+#if !defined(IVT_REGO6XX_POLLING_BENCHMARK) && !defined(IVT_REGO6XX_REPLAY)
+    if ((0U < m_derivedMetrics.getInputCount()) &&
+        (0U < m_derivedMetricsSaveInterval))
+    {
+        isSaved = m_derivedMetrics.save() || isSaved;
+    }
+#endif /* !defined(IVT_REGO6XX_POLLING_BENCHMARK) && !defined(IVT_REGO6XX_REPLAY) */
+
+    if (true == isSaved)
+    {
+        (void)global_preferences->sync();
+    }
+}
+
+void IVTRego6xxCtrl::dump_config()
+{
+    ESP_LOGCONFIG(TAG, "IVT rego6xx controller component");
+
+    if (0U < m_recorderSize)
+    {
+        ESP_LOGCONFIG(TAG, "  UART traffic recorder: %zu bytes", m_recorderSize);
+    }
+
+    if (0U < m_frameTraceSize)
+    {
+        ESP_LOGCONFIG(TAG, "  Protocol frame trace: %zu bytes", m_frameTraceSize);
+    }
+
+    if (0U < m_warmStartSaveInterval)
+    {
+        ESP_LOGCONFIG(TAG, "  Warm start save interval: %u ms", static_cast<unsigned int>(m_warmStartSaveInterval));
+    }
+
+    if (true == m_profiles.isEnabled())
+    {
+        ESP_LOGCONFIG(TAG, "  Polling profiles: '%s' active", IVTRego6xxPollingProfiles::getName(m_profiles.getProfile()));
+    }
+
+    if (0U < m_dependencies.getCount())
+    {
+        ESP_LOGCONFIG(TAG, "  Dependent refreshes: %zu dependencies", m_dependencies.getCount());
+    }
+
+    if (0U < m_adaptiveSampling.getCount())
+    {
+        ESP_LOGCONFIG(TAG, "  Adaptive sampling: %zu sensors", m_adaptiveSampling.getCount());
+    }
+
+    if (0U < m_samplingGroups.getGroupCount())
+    {
+        ESP_LOGCONFIG(TAG, "  Sampling groups: %zu groups, %zu delta sensors", m_samplingGroups.getGroupCount(), m_deltaSensorCount);
+    }
+
+    if (0U < m_aggregation.getCount())
+    {
+        ESP_LOGCONFIG(TAG, "  Aggregation: %zu sensors, %zu aggregate sensors", m_aggregation.getCount(), m_aggregateSensorCount);
+    }
+
+    if (0U < m_history.getCount())
+    {
+        ESP_LOGCONFIG(TAG, "  History: %zu sensors, %zu bytes", m_history.getCount(), m_history.getMemorySize());
+    }
+
+    if (true == m_outbox.isEnabled())
+    {
+        ESP_LOGCONFIG(TAG, "  MQTT outbox: %zu entries, replay interval %u ms",
+            m_outbox.getCapacity(),
+            static_cast<unsigned int>(m_outboxReplayInterval));
+    }
+
+    if (0U < m_telemetryInterval)
+    {
+        ESP_LOGCONFIG(TAG, "  Telemetry: %zu entities, %s frame every %u ms",
+            m_telemetry.getCount(),
+            (true == m_isTelemetryBinary) ? "binary" : "JSON",
+            static_cast<unsigned int>(m_telemetryInterval));
+    }
+
+#ifdef IVT_REGO6XX_MODBUS
+    ESP_LOGCONFIG(TAG, "  Modbus TCP server: port %u, %zu registers",
+        static_cast<unsigned int>(m_modbusServer.getPort()),
+        m_modbusServer.getRegisterCount());
+#endif /* IVT_REGO6XX_MODBUS */
+
+#ifdef IVT_REGO6XX_REPLAY
+    ESP_LOGCONFIG(TAG, "  Replay: trace replaces the heatpump");
+#endif /* IVT_REGO6XX_REPLAY */
+
+    if (0U < m_derivedMetrics.getInputCount())
+    {
+        ESP_LOGCONFIG(TAG, "  Derived metrics: %zu inputs, %zu sensors, save interval %u ms",
+            m_derivedMetrics.getInputCount(),
+            m_derivedSensorCount,
+            static_cast<unsigned int>(m_derivedMetricsSaveInterval));
+    }
+
+    if (true == m_isBurstEnabled)
+    {
+        ESP_LOGCONFIG(TAG, "  Startup burst: %u ms initial delay, %u ms request pause, %u kinds",
+            static_cast<unsigned int>(m_burstInitialDelay),
+            static_cast<unsigned int>(m_burstRequestPause),
+            static_cast<unsigned int>(m_burstOrderCount));
+    }
+}
+
+void IVTRego6xxCtrl::addStartupBurstKind(BurstKind kind)
+{
+    State  state   = STATE_SENSORS;
+    bool   isKnown = true;
+    size_t idx     = 0U;
+
+    switch (kind)
+    {
+    case BURST_KIND_SENSORS:
+        state = STATE_SENSORS;
+        break;
+
+    case BURST_KIND_BINARY_SENSORS:
+        state = STATE_BINARY_SENSORS;
+        break;
+
+    case BURST_KIND_TEXT_SENSORS:
+        state = STATE_TEXT_SENSORS;
+        break;
+
+    case BURST_KIND_NUMBERS:
+        state = STATE_NUMBERS;
+        break;
+
+    default:
+        isKnown = false;
+        break;
+    }
+
+    /* Every kind is part of the order only once. */
+    for (idx = 0U; idx < m_burstOrderCount; ++idx)
+    {
+        if (state == m_burstOrder[idx])
+        {
+            isKnown = false;
+        }
+    }
+
+    if ((true == isKnown) && (BURST_KIND_COUNT > m_burstOrderCount))
+    {
+        m_burstOrder[m_burstOrderCount] = state;
+        ++m_burstOrderCount;
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to add kind %u to the startup burst!", static_cast<unsigned int>(kind));
+    }
+}
+
+void IVTRego6xxCtrl::registerSensor(IVTRego6xxSensor* sensor)
+{
+    if ((nullptr != sensor) && (m_sensorCount < MAX_SENSORS))
+    {
+        m_sensors[m_sensorCount] = sensor;
+        bool isAdded = m_busHealth.addEntity(sensor);
+        isAdded = m_staleness.addEntity(sensor, IVTRego6xxStaleness::KIND_SENSOR) && isAdded;
+        isAdded = m_profiles.addEntity(sensor, IVTRego6xxPollingProfiles::KIND_SENSOR) && isAdded;
+        isAdded = m_warmStart.addEntity(sensor) && isAdded;
+        isAdded = m_telemetry.addEntity(sensor, IVTRego6xxTelemetry::KIND_FIXED_POINT) && isAdded;
+#ifdef IVT_REGO6XX_MODBUS
+        isAdded = m_modbusServer.addInputRegister(sensor, sensor->getAddr()) && isAdded;
+#endif /* IVT_REGO6XX_MODBUS */
+
+        if (false == isAdded)
+        {
+            ESP_LOGE(TAG, "Failed to add sensor '%s' to the entity tables!", sensor->get_name().c_str());
+            mark_failed();
+        }
+
+        ++m_sensorCount;
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to register sensor '%s'!", sensor->get_name().c_str());
+    }
+}
+
+void IVTRego6xxCtrl::registerBinarySensor(IVTRego6xxBinarySensor* binarySensor)
+{
+    if ((nullptr != binarySensor) && (m_binarySensorCount < MAX_BINARY_SENSORS))
+    {
+        m_binarySensors[m_binarySensorCount] = binarySensor;
+        bool isAdded = m_busHealth.addEntity(binarySensor);
+        isAdded = m_staleness.addEntity(binarySensor, IVTRego6xxStaleness::KIND_BINARY_SENSOR) && isAdded;
+        isAdded = m_profiles.addEntity(binarySensor, IVTRego6xxPollingProfiles::KIND_BINARY_SENSOR) && isAdded;
+        isAdded = m_warmStart.addEntity(binarySensor) && isAdded;
+        isAdded = m_telemetry.addEntity(binarySensor, IVTRego6xxTelemetry::KIND_BOOL) && isAdded;
+#ifdef IVT_REGO6XX_MODBUS
+        isAdded = m_modbusServer.addInputRegister(binarySensor, binarySensor->getAddr()) && isAdded;
+#endif /* IVT_REGO6XX_MODBUS */
+
+        if (false == isAdded)
+        {
+            ESP_LOGE(TAG, "Failed to add binary sensor '%s' to the entity tables!", binarySensor->get_name().c_str());
+            mark_failed();
+        }
+
+        ++m_binarySensorCount;
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to register binary sensor '%s'!", binarySensor->get_name().c_str());
+    }
+}
+
+void IVTRego6xxCtrl::registerTextSensor(IVTRego6xxTextSensor* textSensor)
+{
+    if ((nullptr != textSensor) && (m_textSensorCount < MAX_TEXT_SENSORS))
+    {
+        m_textSensors[m_textSensorCount] = textSensor;
+        bool isAdded = m_busHealth.addEntity(textSensor);
+        isAdded = m_staleness.addEntity(textSensor, IVTRego6xxStaleness::KIND_TEXT_SENSOR) && isAdded;
+        isAdded = m_profiles.addEntity(textSensor, IVTRego6xxPollingProfiles::KIND_TEXT_SENSOR) && isAdded;
+
+        if (false == isAdded)
+        {
+            ESP_LOGE(TAG, "Failed to add text sensor '%s' to the entity tables!", textSensor->get_name().c_str());
+            mark_failed();
+        }
+
+        ++m_textSensorCount;
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to register text sensor '%s'!", textSensor->get_name().c_str());
+    }
+}
+
+void IVTRego6xxCtrl::registerButton(IVTRego6xxButton* button)
+{
+    if ((nullptr != button) && (m_buttonCount < MAX_BUTTONS))
+    {
+        m_buttons[m_buttonCount] = button;
+
+        if (false == m_busHealth.addEntity(button))
+        {
+            ESP_LOGE(TAG, "Failed to add button '%s' to the entity tables!", button->get_name().c_str());
+            mark_failed();
+        }
+
+        ++m_buttonCount;
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to register button '%s'!", button->get_name().c_str());
+    }
+}
+
+void IVTRego6xxCtrl::registerNumber(IVTRego6xxNumber* number)
+{
+    if ((nullptr != number) && (m_numberCount < MAX_NUMBERS))
+    {
+        m_numbers[m_numberCount] = number;
+        bool isAdded = m_busHealth.addEntity(number);
+        isAdded = m_staleness.addEntity(number, IVTRego6xxStaleness::KIND_NUMBER) && isAdded;
+        isAdded = m_profiles.addEntity(number, IVTRego6xxPollingProfiles::KIND_NUMBER) && isAdded;
+        isAdded = m_warmStart.addEntity(number) && isAdded;
+        isAdded = m_telemetry.addEntity(number, IVTRego6xxTelemetry::KIND_FIXED_POINT) && isAdded;
+#ifdef IVT_REGO6XX_MODBUS
+        isAdded = m_modbusServer.addHoldingRegister(number) && isAdded;
+#endif /* IVT_REGO6XX_MODBUS */
+
+        if (false == isAdded)
+        {
+            ESP_LOGE(TAG, "Failed to add number '%s' to the entity tables!", number->get_name().c_str());
+            mark_failed();
+        }
+
+        ++m_numberCount;
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to register number '%s'!", number->get_name().c_str());
+    }
+}
+
+void IVTRego6xxCtrl::registerLatencySensor(IVTRego6xxLatencySensor* sensor)
+{
+    if ((nullptr != sensor) && (m_latencySensorCount < MAX_LATENCY_SENSORS))
+    {
+        m_latencySensors[m_latencySensorCount] = sensor;
+
+        ++m_latencySensorCount;
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to register latency sensor '%s'!", sensor->get_name().c_str());
+    }
+}
+
+void IVTRego6xxCtrl::registerActionLatencySensor(IVTRego6xxActionLatencySensor* sensor)
+{
+    if ((nullptr != sensor) && (m_actionLatencySensorCount < MAX_ACTION_LATENCY_SENSORS))
+    {
+        m_actionLatencySensors[m_actionLatencySensorCount] = sensor;
+
+        ++m_actionLatencySensorCount;
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to register user action latency sensor '%s'!", sensor->get_name().c_str());
+    }
+}
+
+void IVTRego6xxCtrl::registerBusSensor(IVTRego6xxBusSensor* sensor)
+{
+    if ((nullptr != sensor) && (m_busSensorCount < MAX_BUS_SENSORS))
+    {
+        m_busSensors[m_busSensorCount] = sensor;
+
+        ++m_busSensorCount;
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to register bus health sensor '%s'!", sensor->get_name().c_str());
+    }
+}
+
+void IVTRego6xxCtrl::registerSlaBinarySensor(IVTRego6xxSlaBinarySensor* binarySensor)
+{
+    if ((nullptr != binarySensor) && (nullptr == m_slaBinarySensor))
+    {
+        m_slaBinarySensor = binarySensor;
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to register service level binary sensor '%s'!", binarySensor->get_name().c_str());
+    }
+}
+
+void IVTRego6xxCtrl::registerLoopSensor(IVTRego6xxLoopSensor* sensor)
+{
+    if ((nullptr != sensor) && (m_loopSensorCount < MAX_LOOP_SENSORS))
+    {
+        m_loopSensors[m_loopSensorCount] = sensor;
+
+        ++m_loopSensorCount;
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to register main loop cost sensor '%s'!", sensor->get_name().c_str());
+    }
+}
+
+void IVTRego6xxCtrl::registerDeltaSensor(IVTRego6xxDeltaSensor* sensor)
+{
+    if ((nullptr != sensor) && (m_deltaSensorCount < MAX_DELTA_SENSORS))
+    {
+        m_deltaSensors[m_deltaSensorCount] = sensor;
+
+        ++m_deltaSensorCount;
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to register delta sensor '%s'!", sensor->get_name().c_str());
+    }
+}
+
+void IVTRego6xxCtrl::addSamplingGroup(const char* name)
+{
+    if (false == m_samplingGroups.addGroup(name))
+    {
+        ESP_LOGE(TAG, "Failed to add the sampling group '%s'!", name);
+    }
+}
+
+void IVTRego6xxCtrl::addSamplingGroupMember(IVTRego6xxSensor* sensor)
+{
+    if (false == m_samplingGroups.addMember(sensor))
+    {
+        ESP_LOGE(TAG, "Failed to add '%s' to the sampling group!", sensor->get_name().c_str());
+    }
+}
+
+void IVTRego6xxCtrl::registerDerivedSensor(IVTRego6xxDerivedSensor* sensor)
+{
+    if ((nullptr != sensor) && (m_derivedSensorCount < MAX_DERIVED_SENSORS))
+    {
+        m_derivedSensors[m_derivedSensorCount] = sensor;
+
+        ++m_derivedSensorCount;
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to register derived metric sensor '%s'!", sensor->get_name().c_str());
+    }
+}
+
+void IVTRego6xxCtrl::setDerivedMetricsInput(IVTRego6xxDerivedMetrics::Input input, const EntityBase* entity)
+{
+    if (false == m_derivedMetrics.setInput(input, entity))
+    {
+        ESP_LOGE(TAG, "Failed to set the derived metrics input %u!", static_cast<unsigned int>(input));
+    }
+}
+
+void IVTRego6xxCtrl::setPollPeriod(const EntityBase* entity, IVTRego6xxPollingProfiles::Profile profile, uint32_t period)
+{
+    if (false == m_profiles.setPeriod(entity, profile, period))
+    {
+        ESP_LOGE(TAG, "Failed to set the poll period of '%s'!", entity->get_name().c_str());
+    }
+}
+
+void IVTRego6xxCtrl::setAdaptiveSampling(const EntityBase* entity, uint32_t minPeriod, uint32_t maxPeriod, float tolerance)
+{
+    if ((false == m_adaptiveSampling.addSensor(entity, minPeriod, maxPeriod, tolerance)) ||
+        (false == m_profiles.setAdaptivePeriod(entity, m_adaptiveSampling.getPeriod(entity))))
+    {
+        ESP_LOGE(TAG, "Failed to set the adaptive sampling of '%s'!", entity->get_name().c_str());
+    }
+}
+
+void IVTRego6xxCtrl::setAggregation(const EntityBase* entity, uint32_t window, bool isSamplePublished)
+{
+    if (false == m_aggregation.addSensor(entity, window, isSamplePublished))
+    {
+        ESP_LOGE(TAG, "Failed to set the aggregation of '%s'!", entity->get_name().c_str());
+    }
+}
+
+void IVTRego6xxCtrl::registerAggregateSensor(IVTRego6xxAggregateSensor* sensor)
+{
+    if ((nullptr != sensor) && (m_aggregateSensorCount < MAX_AGGREGATE_SENSORS))
+    {
+        m_aggregateSensors[m_aggregateSensorCount] = sensor;
+
+        ++m_aggregateSensorCount;
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to register aggregate sensor '%s'!", sensor->get_name().c_str());
+    }
+}
+
+void IVTRego6xxCtrl::setHistory(const EntityBase* entity, size_t size)
+{
+    if (false == m_history.addSensor(entity, size))
+    {
+        ESP_LOGE(TAG, "Failed to set the history of '%s'!", entity->get_name().c_str());
+    }
+}
+
+void IVTRego6xxCtrl::addDependency(const EntityBase* trigger, const EntityBase* target, uint32_t within)
+{
+    if (false == m_dependencies.addDependency(trigger, target, within))
+    {
+        ESP_LOGE(TAG, "Failed to add the dependency of '%s' on '%s'!", target->get_name().c_str(), trigger->get_name().c_str());
+    }
+}
+
+void IVTRego6xxCtrl::setMaxAge(const EntityBase* entity, uint32_t maxAge)
+{
+    if (false == m_staleness.setMaxAge(entity, maxAge))
+    {
+        ESP_LOGE(TAG, "Failed to set maximum age of '%s'!", entity->get_name().c_str());
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void IVTRego6xxCtrl::publishLatencies()
+{
+    size_t idx = 0U;
+
+    for (idx = 0U; idx < m_latencySensorCount; ++idx)
+    {
+        IVTRego6xxLatencySensor*       sensor  = m_latencySensors[idx];
+        const Rego6xxCtrl::CmdLatency* latency = m_ctrl.getLatency(sensor->getCmdId());
+
+        if (nullptr == latency)
+        {
+            ESP_LOGW(TAG, "No latencies for command 0x%02X available.", sensor->getCmdId());
+        }
+        else
+        {
+            const Rego6xxCtrl::LatencyHistogram& histogram = (IVTRego6xxLatencySensor::STAGE_FIRST_BYTE == sensor->getStage()) ? latency->firstByte : latency->complete;
+
+            /* No response received yet, keep the sensor unknown. */
+            if (0U < histogram.getCount())
+            {
+                uint32_t value = (IVTRego6xxLatencySensor::PERCENTILE_MAX <= sensor->getPercentile()) ? histogram.getMax() : histogram.getPercentile(sensor->getPercentile());
+
+                sensor->publish_state(static_cast<float>(value) / 1000.0F);
+            }
+        }
+    }
+
+    for (idx = 0U; idx < m_actionLatencySensorCount; ++idx)
+    {
+        IVTRego6xxActionLatencySensor*                   sensor    = m_actionLatencySensors[idx];
+        const IVTRego6xxActionLatency::LatencyHistogram* histogram = m_actionLatency.getLatency(sensor->getAction(), sensor->getStage());
+
+        /* No user action finished yet, keep the sensor unknown. */
+        if ((nullptr != histogram) &&
+            (0U < histogram->getCount()))
+        {
+            uint32_t value = (IVTRego6xxActionLatencySensor::PERCENTILE_MAX <= sensor->getPercentile()) ? histogram->getMax() : histogram->getPercentile(sensor->getPercentile());
+
+            sensor->publish_state(static_cast<float>(value));
+        }
+    }
+}
+
+void IVTRego6xxCtrl::publishBusHealth()
+{
+    size_t idx = 0U;
+
+    m_busHealth.updateTraffic(m_recorder, getBaudRate());
+
+    for (idx = 0U; idx < m_busSensorCount; ++idx)
+    {
+        IVTRego6xxBusSensor* sensor = m_busSensors[idx];
+
+        sensor->publish_state(m_busHealth.getMetric(sensor->getMetric()));
+    }
+}
+
+void IVTRego6xxCtrl::publishLoopCost()
+{
+    size_t idx = 0U;
+
+    m_loopCost.update(m_busHealth.getRequests());
+
+    for (idx = 0U; idx < m_loopSensorCount; ++idx)
+    {
+        IVTRego6xxLoopSensor* sensor = m_loopSensors[idx];
+
+        sensor->publish_state(m_loopCost.getMetric(sensor->getMetric()));
+    }
+}
+
+void IVTRego6xxCtrl::publishDerivedMetrics()
+{
+    size_t idx = 0U;
+
+    for (idx = 0U; idx < m_derivedSensorCount; ++idx)
+    {
+        IVTRego6xxDerivedSensor* sensor = m_derivedSensors[idx];
+        float                    value  = 0.0F;
+
+        if (true == m_derivedMetrics.getMetric(sensor->getMetric(), value))
+        {
+            sensor->publish_state(value);
+        }
+    }
+}
+
+void IVTRego6xxCtrl::publishAggregates()
+{
+    if (true == m_aggregation.process())
+    {
+        size_t idx = 0U;
+
+        for (idx = 0U; idx < m_aggregateSensorCount; ++idx)
+        {
+            IVTRego6xxAggregateSensor* sensor = m_aggregateSensors[idx];
+            float                      value  = 0.0F;
+
+            if (true == m_aggregation.getResult(sensor->getSource(), sensor->getStatistic(), value))
+            {
+                sensor->publish_state(value);
+                bufferState(sensor, value);
+            }
+        }
+    }
+}
+
+void IVTRego6xxCtrl::bufferState(const EntityBase* entity, float value)
+{
+#ifdef USE_MQTT
+    if ((true == m_outbox.isEnabled()) &&
+        (nullptr != mqtt::global_mqtt_client) &&
+        (false == mqtt::global_mqtt_client->is_connected()))
+    {
+        m_outbox.add(entity, value);
+    }
+#else  /* USE_MQTT */
+    (void)entity;
+    (void)value;
+#endif /* USE_MQTT */
+}
+
+void IVTRego6xxCtrl::replayOutbox()
+{
+#ifdef USE_MQTT
+    IVTRego6xxOutbox::Entry entry;
+
+    /* Only one value per interval, so the replay doesn't flood the broker after a reconnect. */
+    if ((nullptr != mqtt::global_mqtt_client) &&
+        (true == mqtt::global_mqtt_client->is_connected()) &&
+        (true == m_outbox.peek(entry)))
+    {
+        std::string topic   = mqtt::global_mqtt_client->get_topic_prefix() + "/replay/" + entry.entity->get_object_id();
+        uint32_t    age     = (SimpleTimer::now() - entry.timestamp) / 1000U;
+        char        payload[80];
+        int         length  = snprintf(payload, sizeof(payload), "{\"value\":%.1f,\"age\":%u}",
+                                       static_cast<double>(entry.value),
+                                       static_cast<unsigned int>(age));
+
+#ifdef USE_TIME
+        if (nullptr != m_outboxTime)
+        {
+            ESPTime now = m_outboxTime->now();
+
+            /* The original timestamp is only known with a synchronized time source. */
+            if (true == now.is_valid())
+            {
+                length = snprintf(payload, sizeof(payload), "{\"value\":%.1f,\"age\":%u,\"timestamp\":%u}",
+                                  static_cast<double>(entry.value),
+                                  static_cast<unsigned int>(age),
+                                  static_cast<unsigned int>(static_cast<uint32_t>(now.timestamp) - age));
+            }
+        }
+#endif /* USE_TIME */
+
+        if ((0 < length) &&
+            (sizeof(payload) > static_cast<size_t>(length)))
+        {
+            /* A failed publish is retried with the next interval. */
+            if (true == mqtt::global_mqtt_client->publish(topic, payload, static_cast<size_t>(length), 0U, false))
+            {
+                m_outbox.pop();
+            }
+        }
+        else
+        {
+            m_outbox.pop();
+        }
+    }
+#endif /* USE_MQTT */
+}
+
+void IVTRego6xxCtrl::publishTelemetry()
+{
+#ifdef USE_MQTT
+    if ((true == m_telemetry.isChanged()) &&
+        (nullptr != mqtt::global_mqtt_client) &&
+        (true == mqtt::global_mqtt_client->is_connected()))
+    {
+        std::string frame;
+
+        if (true == m_isTelemetryBinary)
+        {
+            m_telemetry.writeBinary(frame, true);
+        }
+        else
+        {
+            m_telemetry.writeJson(frame, true);
+        }
+
+        if (true == mqtt::global_mqtt_client->publish(mqtt::global_mqtt_client->get_topic_prefix() + "/telemetry", frame, 0U, false))
+        {
+            m_telemetry.commit();
+        }
+    }
+#endif /* USE_MQTT */
+}
+
+uint32_t IVTRego6xxCtrl::getBaudRate() const
+{
+    uint32_t baudRate = 0U;
+
+    if (nullptr != parent_)
+    {
+        baudRate = parent_->get_baud_rate();
+    }
+
+    return baudRate;
+}
+
+void IVTRego6xxCtrl::startPause()
+{
+    /* The startup burst reads with its minimal pause. */
+    m_pause = (0U != m_burstRounds) ? m_burstRequestPause : m_policy.requestPause;
+
+    m_pauseTimer.start(m_pause);
+    EVENT_TRACE_BEGIN(Rego6xxTracepoint::ID_PAUSE, static_cast<uint16_t>(m_pause));
+}
+
+SimpleTimer* IVTRego6xxCtrl::getReadTimer(State state)
+{
+    SimpleTimer* timer = nullptr;
+
+    switch (state)
+    {
+    case STATE_SENSORS:
+        timer = &m_sensorTimer;
+        break;
+
+    case STATE_BINARY_SENSORS:
+        timer = &m_binarySensorTimer;
+        break;
+
+    case STATE_TEXT_SENSORS:
+        timer = &m_textSensorTimer;
+        break;
+
+    case STATE_NUMBERS:
+        timer = &m_numberTimer;
+        break;
+
+    default:
+        break;
+    }
+
+    return timer;
+}
+
+size_t IVTRego6xxCtrl::getEntityCount(State state) const
+{
+    size_t count = 0U;
+
+    switch (state)
+    {
+    case STATE_SENSORS:
+        count = m_sensorCount;
+        break;
+
+    case STATE_BINARY_SENSORS:
+        count = m_binarySensorCount;
+        break;
+
+    case STATE_TEXT_SENSORS:
+        count = m_textSensorCount;
+        break;
+
+    case STATE_NUMBERS:
+        count = m_numberCount;
+        break;
+
+    default:
+        break;
+    }
+
+    return count;
+}
+
+void IVTRego6xxCtrl::startBurstRound(uint32_t delay)
+{
+    bool isStarted = false;
+
+    /* Only the timer of the current kind runs, so the kinds are read strictly in the burst order. */
+    while ((false == isStarted) && (m_burstOrderCount > m_burstOrderIndex))
+    {
+        State state = m_burstOrder[m_burstOrderIndex];
+
+        if (0U != (m_burstRounds & static_cast<uint8_t>(1U << state)))
+        {
+            getReadTimer(state)->start(delay);
+            isStarted = true;
+        }
+        else
+        {
+            /* Kind without entities. */
+            ++m_burstOrderIndex;
+        }
+    }
+
+    if (false == isStarted)
+    {
+        const State states[]    = { STATE_SENSORS, STATE_BINARY_SENSORS, STATE_TEXT_SENSORS, STATE_NUMBERS };
+        uint16_t    entityCount = 0U;
+        size_t      idx         = 0U;
+
+        for (idx = 0U; idx < m_burstOrderCount; ++idx)
+        {
+            entityCount += static_cast<uint16_t>(getEntityCount(m_burstOrder[idx]));
+        }
+
+        /* The kinds outside the burst order start now. */
+        for (State state : states)
+        {
+            SimpleTimer* timer = getReadTimer(state);
+
+            if ((false == timer->isTimerRunning()) &&
+                (0U < getEntityCount(state)))
+            {
+                timer->start(0U);
+            }
+        }
+
+        m_snapshotDuration = SimpleTimer::now() - m_pollingStart;
+
+        ESP_LOGI(TAG, "Initial snapshot complete: %u entities after %u ms, continue with request pause.",
+            static_cast<unsigned int>(entityCount),
+            static_cast<unsigned int>(m_snapshotDuration));
+        EVENT_TRACE_INSTANT(Rego6xxTracepoint::ID_INITIAL_SNAPSHOT, entityCount);
+    }
+}
+
+void IVTRego6xxCtrl::completeRound(State state)
+{
+    uint8_t round = static_cast<uint8_t>(1U << state);
+
+    m_refreshRounds &= static_cast<uint8_t>(~round);
+
+    if (0U != (m_burstRounds & round))
+    {
+        m_burstRounds &= static_cast<uint8_t>(~round);
+
+        /* Continue with the next kind at once. */
+        ++m_burstOrderIndex;
+        startBurstRound(0U);
+    }
+}
+
+void IVTRego6xxCtrl::applyPollingProfile()
+{
+    const State states[] = { STATE_SENSORS, STATE_BINARY_SENSORS, STATE_TEXT_SENSORS, STATE_NUMBERS };
+    const IVTRego6xxPollingProfiles::Kind kinds[] =
+    {
+        IVTRego6xxPollingProfiles::KIND_SENSOR,
+        IVTRego6xxPollingProfiles::KIND_BINARY_SENSOR,
+        IVTRego6xxPollingProfiles::KIND_TEXT_SENSOR,
+        IVTRego6xxPollingProfiles::KIND_NUMBER
+    };
+    const uint32_t kindPeriods[] =
+    {
+        m_policy.sensorReadPeriod,
+        m_policy.binarySensorReadPeriod,
+        m_policy.textSensorReadPeriod,
+        m_policy.numberReadPeriod
+    };
+    size_t idx = 0U;
+
+    /* The startup burst controls the timers until the initial snapshot is complete. */
+    if (0U == m_burstRounds)
+    {
+        for (idx = 0U; idx < (sizeof(states) / sizeof(states[0])); ++idx)
+        {
+            SimpleTimer* timer       = getReadTimer(states[idx]);
+            uint32_t     roundPeriod = m_profiles.getRoundPeriod(kinds[idx], kindPeriods[idx]);
+
+            if ((true == timer->isTimerRunning()) &&
+                (roundPeriod < timer->getRemaining()))
+            {
+                timer->start(0U);
+            }
+        }
+    }
+}
+
+void IVTRego6xxCtrl::adaptSampling(const IVTRego6xxSensor* sensor, float value)
+{
+    uint32_t prevPeriod = m_adaptiveSampling.getPeriod(sensor);
+    uint32_t period     = m_adaptiveSampling.update(sensor, value);
+
+    if (prevPeriod != period)
+    {
+        IVT_REGO6XX_POLL_LOGD(TAG, "Sensor '%s' read period adapted from %u ms to %u ms.",
+            sensor->get_name().c_str(),
+            static_cast<unsigned int>(prevPeriod),
+            static_cast<unsigned int>(period));
+
+        (void)m_profiles.setAdaptivePeriod(sensor, period);
+
+        if (period < prevPeriod)
+        {
+            applyPollingProfile();
+        }
+    }
+}
+
+void IVTRego6xxCtrl::groupSensors()
+{
+    IVTRego6xxSensor* sensors[MAX_SENSORS];
+    size_t            count        = 0U;
+    uint8_t           placedGroups = 0U;
+    size_t            idx          = 0U;
+
+    for (idx = 0U; idx < m_sensorCount; ++idx)
+    {
+        size_t group = m_samplingGroups.getGroup(m_sensors[idx]);
+
+        if (IVTRego6xxSamplingGroups::NO_GROUP == group)
+        {
+            sensors[count] = m_sensors[idx];
+            ++count;
+        }
+        /* The first member takes the other members of its group along. */
+        else if (0U == (placedGroups & static_cast<uint8_t>(1U << group)))
+        {
+            size_t memberIdx = 0U;
+
+            for (memberIdx = idx; memberIdx < m_sensorCount; ++memberIdx)
+            {
+                if (group == m_samplingGroups.getGroup(m_sensors[memberIdx]))
+                {
+                    sensors[count] = m_sensors[memberIdx];
+                    ++count;
+                }
+            }
+
+            placedGroups |= static_cast<uint8_t>(1U << group);
+        }
+        else
+        {
+            /* Already placed with its group. */
+            ;
+        }
+    }
+
+    for (idx = 0U; idx < count; ++idx)
+    {
+        m_sensors[idx] = sensors[idx];
+    }
+}
+
+void IVTRego6xxCtrl::publishDeltas(size_t group)
+{
+    size_t idx = 0U;
+
+    for (idx = 0U; idx < m_deltaSensorCount; ++idx)
+    {
+        IVTRego6xxDeltaSensor* deltaSensor = m_deltaSensors[idx];
+        float                  minuend     = 0.0F;
+        float                  subtrahend  = 0.0F;
+
+        /* Only values of the same pass are coherent. */
+        if ((group == m_samplingGroups.getGroup(deltaSensor->getMinuend())) &&
+            (group == m_samplingGroups.getGroup(deltaSensor->getSubtrahend())) &&
+            (true == m_samplingGroups.getValue(deltaSensor->getMinuend(), minuend)) &&
+            (true == m_samplingGroups.getValue(deltaSensor->getSubtrahend(), subtrahend)))
+        {
+            IVT_REGO6XX_POLL_LOGD(TAG, "Delta sensor '%s' sampled at %u ms.",
+                deltaSensor->get_name().c_str(),
+                static_cast<unsigned int>(m_samplingGroups.getTimestamp(group)));
+
+            deltaSensor->publish_state(minuend - subtrahend);
+            bufferState(deltaSensor, minuend - subtrahend);
+        }
+    }
+}
+
+void IVTRego6xxCtrl::resolveDependencies()
+{
+    size_t idx = 0U;
+
+    for (idx = 0U; idx < m_sensorCount; ++idx)
+    {
+        m_dependencies.setKind(m_sensors[idx], IVTRego6xxPollingProfiles::KIND_SENSOR);
+    }
+
+    for (idx = 0U; idx < m_binarySensorCount; ++idx)
+    {
+        m_dependencies.setKind(m_binarySensors[idx], IVTRego6xxPollingProfiles::KIND_BINARY_SENSOR);
+    }
+
+    for (idx = 0U; idx < m_textSensorCount; ++idx)
+    {
+        m_dependencies.setKind(m_textSensors[idx], IVTRego6xxPollingProfiles::KIND_TEXT_SENSOR);
+    }
+
+    for (idx = 0U; idx < m_numberCount; ++idx)
+    {
+        m_dependencies.setKind(m_numbers[idx], IVTRego6xxPollingProfiles::KIND_NUMBER);
+    }
+}
+
+bool IVTRego6xxCtrl::startRefreshRound(State state)
+{
+    bool                            isStarted = false;
+    IVTRego6xxPollingProfiles::Kind kind      = IVTRego6xxPollingProfiles::KIND_COUNT;
+    SimpleTimer*                    timer     = getReadTimer(state);
+    uint32_t                        timeLeft  = 0U;
+
+    switch (state)
+    {
+    case STATE_SENSORS:
+        kind = IVTRego6xxPollingProfiles::KIND_SENSOR;
+        break;
+
+    case STATE_BINARY_SENSORS:
+        kind = IVTRego6xxPollingProfiles::KIND_BINARY_SENSOR;
+        break;
+
+    case STATE_TEXT_SENSORS:
+        kind = IVTRego6xxPollingProfiles::KIND_TEXT_SENSOR;
+        break;
+
+    case STATE_NUMBERS:
+        kind = IVTRego6xxPollingProfiles::KIND_NUMBER;
+        break;
+
+    default:
+        break;
+    }
+
+    /* The startup burst reads every entity anyway. */
+    if ((0U == m_burstRounds) &&
+        (nullptr != timer) &&
+        (true == timer->isTimerRunning()) &&
+        (true == m_dependencies.getTimeLeft(kind, timeLeft)))
+    {
+        /* A regular round, which starts before the deadline, refreshes the pending entities too. */
+        if (timeLeft < timer->getRemaining())
+        {
+            m_refreshRounds |= static_cast<uint8_t>(1U << state);
+            EVENT_TRACE_INSTANT(Rego6xxTracepoint::ID_DEPENDENT_REFRESH, state);
+            isStarted = true;
+        }
+    }
+
+    return isStarted;
+}
 
-namespace esphome
+bool IVTRego6xxCtrl::isReadDue(State state, const EntityBase* entity, uint32_t kindPeriod) const
 {
-namespace ivt_rego6xx_ctrl
+    bool   isDue = isEntityDue(state, entity, kindPeriod);
+    size_t group = m_samplingGroups.getGroup(entity);
+
+    /* The members of a group are read as one unit, which starts with the first member. */
+    if ((false == isDue) &&
+        (IVTRego6xxSamplingGroups::NO_GROUP != group))
+    {
+        if (true == m_samplingGroups.isInPass(entity))
+        {
+            isDue = true;
+        }
+        else
+        {
+            size_t idx = 0U;
+
+            for (idx = 0U; idx < m_samplingGroups.getMemberCount(); ++idx)
+            {
+                const EntityBase* member = m_samplingGroups.getMember(idx);
+
+                if ((group == m_samplingGroups.getGroup(member)) &&
+                    (true == isEntityDue(state, member, kindPeriod)))
+                {
+                    isDue = true;
+                }
+            }
+        }
+    }
+
+    return isDue;
+}
+
+bool IVTRego6xxCtrl::isEntityDue(State state, const EntityBase* entity, uint32_t kindPeriod) const
 {
+    bool isDue = m_dependencies.isPending(entity);
 
-/******************************************************************************
- * Types and classes
- *****************************************************************************/
+    if ((false == isDue) &&
+        (false == isRefreshRound(state)))
+    {
+        isDue = m_profiles.isDue(entity, kindPeriod);
+    }
 
-/******************************************************************************
- * Prototypes
- *****************************************************************************/
+    return isDue;
+}
 
-/******************************************************************************
- * Local Variables
- *****************************************************************************/
+void IVTRego6xxCtrl::restoreValues()
+{
+    size_t idx = 0U;
 
-/**
- * Logger tag of this component.
- */
-static const char* TAG = "ivt_rego6xx_ctrl.component";
+    if (0U < m_warmStart.load())
+    {
+        uint32_t value = 0U;
 
-/******************************************************************************
- * Public Methods
- *****************************************************************************/
+        for (idx = 0U; idx < m_sensorCount; ++idx)
+        {
+            if (true == m_warmStart.getRestoredValue(m_sensors[idx], value))
+            {
+                m_sensors[idx]->publish_state(m_ctrl.toFloat(value));
+            }
+        }
 
-void IVTRego6xxCtrl::setup()
+        for (idx = 0U; idx < m_binarySensorCount; ++idx)
+        {
+            if (true == m_warmStart.getRestoredValue(m_binarySensors[idx], value))
+            {
+                m_binarySensors[idx]->publish_state(m_ctrl.toBool(value));
+            }
+        }
+
+        for (idx = 0U; idx < m_numberCount; ++idx)
+        {
+            if (true == m_warmStart.getRestoredValue(m_numbers[idx], value))
+            {
+                m_numbers[idx]->publish_state(m_ctrl.toFloat(value));
+            }
+        }
+    }
+}
+
+void IVTRego6xxCtrl::startPolling()
 {
-    /* Start all timers responsible for reading from heatpump.
-     * The exact order will be determined by the state machine.
-     */
-    m_sensorTimer.start(SENSOR_READ_INITIAL);
-    m_binarySensorTimer.start(SENSOR_READ_INITIAL);
-    m_textSensorTimer.start(SENSOR_READ_INITIAL);
-    m_numberTimer.start(SENSOR_READ_INITIAL);
+    m_state                    = STATE_BUTTONS;
+    m_currentSensorIndex       = MAX_SENSORS;
+    m_currentBinarySensorIndex = MAX_BINARY_SENSORS;
+    m_currentTextSensorIndex   = MAX_TEXT_SENSORS;
+    m_currentButtonIndex       = MAX_BUTTONS;
+    m_currentNumberIndex       = MAX_NUMBERS;
+    m_currentNumberUpdateIndex = MAX_NUMBERS;
+    m_pauseTimer.stop();
+    m_burstOrderIndex          = 0U;
+    m_burstRounds              = 0U;
+    m_refreshRounds            = 0U;
+    m_samplingGroups.abortPass();
+    m_pollingStart             = SimpleTimer::now();
+    m_snapshotDuration         = 0U;
+
+    if (true == m_isBurstEnabled)
+    {
+        size_t idx = 0U;
+
+        for (idx = 0U; idx < m_burstOrderCount; ++idx)
+        {
+            if (0U < getEntityCount(m_burstOrder[idx]))
+            {
+                m_burstRounds |= static_cast<uint8_t>(1U << m_burstOrder[idx]);
+            }
+        }
+
+        /* The kinds are started one after another by the startup burst. */
+        m_sensorTimer.stop();
+        m_binarySensorTimer.stop();
+        m_textSensorTimer.stop();
+        m_numberTimer.stop();
+
+        startBurstRound(m_burstInitialDelay);
+    }
+    else
+    {
+        /* Start all timers responsible for reading from heatpump.
+         * The exact order will be determined by the state machine.
+         */
+        m_sensorTimer.start(SENSOR_READ_INITIAL);
+        m_binarySensorTimer.start(SENSOR_READ_INITIAL);
+        m_textSensorTimer.start(SENSOR_READ_INITIAL);
+        m_numberTimer.start(SENSOR_READ_INITIAL);
+    }
 }
 
-void IVTRego6xxCtrl::loop()
+void IVTRego6xxCtrl::processPolling()
 {
     /* Between each heatpump command/response there shall be a pause to avoid
      * the Rego6xx controller to be overloaded.
@@ -92,12 +1468,17 @@ void IVTRego6xxCtrl::loop()
         if (true == m_pauseTimer.isTimeout())
         {
             m_pauseTimer.stop();
+            EVENT_TRACE_END(Rego6xxTracepoint::ID_PAUSE, static_cast<uint16_t>(m_pause));
 
             /* Check buttons first and numbers as second whether there are updates required.
              * This gurantees that the user can press a button or change a number and it will
              * be processed immediately.
              */
-            m_state = STATE_BUTTONS;
+            if ((true == m_policy.isButtonPreemptive) &&
+                (false == m_samplingGroups.isPassActive()))
+            {
+                m_state = STATE_BUTTONS;
+            }
         }
     }
 
@@ -108,91 +1489,99 @@ void IVTRego6xxCtrl::loop()
 
     /* Process the heatpump Rego6xx controller. */
     m_ctrl.process();
-}
-
-void IVTRego6xxCtrl::dump_config()
-{
-    ESP_LOGCONFIG(TAG, "IVT rego6xx controller component");
-}
 
-void IVTRego6xxCtrl::registerSensor(IVTRego6xxSensor* sensor)
-{
-    if ((nullptr != sensor) && (m_sensorCount < MAX_SENSORS))
+    /* The response is detected once per main loop, which runs every 16 ms by default.
+     * A response takes only a few ms on the wire, therefore the main loop runs at
+     * high frequency while a response is pending. Otherwise the latencies would
+     * measure the main loop interval instead of the heatpump.
+     */
+    if (true == m_ctrl.isPending())
     {
-        m_sensors[m_sensorCount] = sensor;
-
-        ++m_sensorCount;
+        m_highFrequencyLoop.start();
     }
     else
     {
-        ESP_LOGE(TAG, "Failed to register sensor '%s'!", sensor->get_name().c_str());
+        m_highFrequencyLoop.stop();
+    }
+
+    /* The response of a user action is evaluated by the state machine, not before the next loop. */
+    if ((nullptr != m_confirmRsp) &&
+        (true == m_confirmRsp->isUsed()) &&
+        (false == m_confirmRsp->isPending()))
+    {
+        m_actionLatency.receive();
     }
 }
 
-void IVTRego6xxCtrl::registerBinarySensor(IVTRego6xxBinarySensor* binarySensor)
+void IVTRego6xxCtrl::processPeriodicTasks()
 {
-    if ((nullptr != binarySensor) && (m_binarySensorCount < MAX_BINARY_SENSORS))
+    if (true == m_latencyTimer.isTimeout())
     {
-        m_binarySensors[m_binarySensorCount] = binarySensor;
-
-        ++m_binarySensorCount;
+        publishLatencies();
+        m_latencyTimer.restart();
     }
-    else
+
+    if (true == m_busHealthTimer.isTimeout())
     {
-        ESP_LOGE(TAG, "Failed to register binary sensor '%s'!", binarySensor->get_name().c_str());
+        publishBusHealth();
+        m_busHealthTimer.restart();
     }
-}
 
-void IVTRego6xxCtrl::registerTextSensor(IVTRego6xxTextSensor* textSensor)
-{
-    if ((nullptr != textSensor) && (m_textSensorCount < MAX_TEXT_SENSORS))
+    if (true == m_stalenessTimer.isTimeout())
     {
-        m_textSensors[m_textSensorCount] = textSensor;
+        bool isViolated = m_staleness.check();
 
-        ++m_textSensorCount;
+        if (nullptr != m_slaBinarySensor)
+        {
+            m_slaBinarySensor->publish_state(isViolated);
+        }
+
+        m_stalenessTimer.restart();
     }
-    else
+
+    if (true == m_loopCostTimer.isTimeout())
     {
-        ESP_LOGE(TAG, "Failed to register text sensor '%s'!", textSensor->get_name().c_str());
+        publishLoopCost();
+        m_loopCostTimer.restart();
     }
-}
 
-void IVTRego6xxCtrl::registerButton(IVTRego6xxButton* button)
-{
-    if ((nullptr != button) && (m_buttonCount < MAX_BUTTONS))
+    if (true == m_warmStartTimer.isTimeout())
     {
-        m_buttons[m_buttonCount] = button;
+        (void)m_warmStart.save();
+        m_warmStartTimer.restart();
+    }
 
-        ++m_buttonCount;
+    if (true == m_aggregationTimer.isTimeout())
+    {
+        publishAggregates();
+        m_aggregationTimer.restart();
     }
-    else
+
+    if (true == m_derivedMetricsTimer.isTimeout())
     {
-        ESP_LOGE(TAG, "Failed to register button '%s'!", button->get_name().c_str());
+        publishDerivedMetrics();
+        m_derivedMetricsTimer.restart();
     }
-}
 
-void IVTRego6xxCtrl::registerNumber(IVTRego6xxNumber* number)
-{
-    if ((nullptr != number) && (m_numberCount < MAX_NUMBERS))
+    if (true == m_derivedMetricsSaveTimer.isTimeout())
     {
-        m_numbers[m_numberCount] = number;
+        (void)m_derivedMetrics.save();
+        m_derivedMetricsSaveTimer.restart();
+    }
 
-        ++m_numberCount;
+    if (true == m_outboxReplayTimer.isTimeout())
+    {
+        replayOutbox();
+        m_outboxReplayTimer.restart();
     }
-    else
+
+    if (true == m_telemetryTimer.isTimeout())
     {
-        ESP_LOGE(TAG, "Failed to register number '%s'!", number->get_name().c_str());
+        publishTelemetry();
+        m_telemetryTimer.restart();
     }
 }
 
-/******************************************************************************
- * Protected Methods
- *****************************************************************************/
-
-/******************************************************************************
- * Private Methods
- *****************************************************************************/
-
 IVTRego6xxCtrl::State IVTRego6xxCtrl::getPendingState(IVTRego6xxCtrl::State currentState)
 {
     State prevState = currentState;
@@ -227,7 +1616,8 @@ IVTRego6xxCtrl::State IVTRego6xxCtrl::getPendingState(IVTRego6xxCtrl::State curr
 
 void IVTRego6xxCtrl::processStateMachine()
 {
-    State nextState = m_state;
+    State    nextState    = m_state;
+    uint32_t handlerStart = micros();
 
     switch (m_state)
     {
@@ -287,6 +1677,14 @@ void IVTRego6xxCtrl::processStateMachine()
         break;
     }
 
+    /* The handlers have the same order as the states. */
+    m_loopCost.addHandler(static_cast<IVTRego6xxLoopCost::Handler>(m_state), micros() - handlerStart);
+
+    if (m_state != nextState)
+    {
+        EVENT_TRACE_INSTANT(Rego6xxTracepoint::ID_STATE, nextState);
+    }
+
     m_state = nextState;
 }
 
@@ -318,15 +1716,18 @@ bool IVTRego6xxCtrl::processButtons()
                 uint16_t addr  = currentButton->getAddr();
                 uint32_t value = currentButton->getValue();
 
-                ESP_LOGI(TAG, "Write button '%s' 0x%06X with 0x%02X (cmd id) at 0x%04X ...", currentButton->get_name().c_str(), value, cmdId, addr);
+                IVT_REGO6XX_WRITE_LOGD(TAG, "Write button '%s' 0x%06X with 0x%02X (cmd id) at 0x%04X ...", currentButton->get_name().c_str(), value, cmdId, addr);
                 m_confirmRsp = m_ctrl.writeStd(cmdId, addr, value);
 
                 if (nullptr == m_confirmRsp)
                 {
-                    ESP_LOGE(TAG, "Failed to write button '%s' 0x%04X with 0x%02X (cmd id) at 0x%04X!", currentButton->get_name().c_str(), value, cmdId, addr);
+                    IVT_REGO6XX_WRITE_LOGE(TAG, "Failed to write button '%s' 0x%04X with 0x%02X (cmd id) at 0x%04X!", currentButton->get_name().c_str(), value, cmdId, addr);
+                    m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_REQUEST_FAILED, currentButton, cmdId, addr, value);
                 }
                 else
                 {
+                    m_actionLatency.beginWrite(IVTRego6xxActionLatency::ACTION_BUTTON, currentButton, currentButton->getPressTimestamp());
+
                     /* Force text sensor update with display information. */
                     m_textSensorTimer.start(0U);
                     break;
@@ -341,22 +1742,36 @@ bool IVTRego6xxCtrl::processButtons()
              (false == m_confirmRsp->isPending()))
     {
         IVTRego6xxButton* currentButton = m_buttons[m_currentButtonIndex];
+        bool              isSuccessful  = m_busHealth.countResponse(currentButton, *m_confirmRsp);
+
+        m_actionLatency.confirm(IVTRego6xxActionLatency::ACTION_BUTTON, isSuccessful);
+
+        /* Without text sensors, there is no display to refresh. */
+        if (0U == m_textSensorCount)
+        {
+            m_actionLatency.beginDisplayRefresh();
+            m_actionLatency.publish(IVTRego6xxActionLatency::ACTION_BUTTON, currentButton, true);
+        }
 
         if (true == m_confirmRsp->isTimeout())
         {
-            ESP_LOGW(TAG, "Write button '%s' response timeout.", currentButton->get_name().c_str());
+            IVT_REGO6XX_WRITE_LOGW(TAG, "Write button '%s' response timeout.", currentButton->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_TIMEOUT, currentButton, currentButton->getCmdId(), currentButton->getAddr(), 0U);
         }
         else if (false == m_confirmRsp->isValid())
         {
-            ESP_LOGW(TAG, "Write button '%s' response invalid.", currentButton->get_name().c_str());
+            IVT_REGO6XX_WRITE_LOGW(TAG, "Write button '%s' response invalid.", currentButton->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_INVALID, currentButton, currentButton->getCmdId(), currentButton->getAddr(), 0U);
         }
         else if (Rego6xxCtrl::DEV_ADDR_HOST != m_confirmRsp->getDevAddr())
         {
-            ESP_LOGW(TAG, "Write button '%s' response has wrong destination.", currentButton->get_name().c_str());
+            IVT_REGO6XX_WRITE_LOGW(TAG, "Write button '%s' response has wrong destination.", currentButton->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_WRONG_DESTINATION, currentButton, currentButton->getCmdId(), currentButton->getAddr(), 0U);
         }
         else
         {
-            ESP_LOGI(TAG, "Write button '%s' successful.", currentButton->get_name().c_str());
+            IVT_REGO6XX_WRITE_LOGI(TAG, "Write button '%s' successful.", currentButton->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_SUCCESSFUL, currentButton, currentButton->getCmdId(), currentButton->getAddr(), currentButton->getValue());
         }
 
         m_ctrl.release();
@@ -365,7 +1780,7 @@ bool IVTRego6xxCtrl::processButtons()
         ++m_currentButtonIndex;
 
         /* Pause until next sensor will be read. */
-        m_pauseTimer.start(REGO6xx_REQ_PAUSE);
+        startPause();
     }
     else
     /* Wait for pending command response. */
@@ -411,15 +1826,20 @@ bool IVTRego6xxCtrl::processNumberUpdates()
                 uint16_t addr  = currentNumber->getAddr();
                 uint32_t value = m_ctrl.fromFloat(currentNumber->getValue());
 
-                ESP_LOGI(TAG, "Write number '%s' 0x%04X with 0x%02X (cmd id) at 0x%04X ...", currentNumber->get_name().c_str(), value, cmdId, addr);
+                IVT_REGO6XX_WRITE_LOGD(TAG, "Write number '%s' 0x%04X with 0x%02X (cmd id) at 0x%04X ...", currentNumber->get_name().c_str(), value, cmdId, addr);
                 m_confirmRsp = m_ctrl.writeStd(cmdId, addr, value);
 
                 if (nullptr == m_confirmRsp)
                 {
-                    ESP_LOGE(TAG, "Failed to write number '%s' 0x%04X with 0x%02X (cmd id) at 0x%04X!", currentNumber->get_name().c_str(), value, cmdId, addr);
+                    IVT_REGO6XX_WRITE_LOGE(TAG, "Failed to write number '%s' 0x%04X with 0x%02X (cmd id) at 0x%04X!", currentNumber->get_name().c_str(), value, cmdId, addr);
+                    m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_REQUEST_FAILED, currentNumber, cmdId, addr, value);
+#ifdef IVT_REGO6XX_MODBUS
+                    m_modbusServer.confirmWrite(currentNumber, false);
+#endif /* IVT_REGO6XX_MODBUS */
                 }
                 else
                 {
+                    m_actionLatency.beginWrite(IVTRego6xxActionLatency::ACTION_NUMBER, currentNumber, currentNumber->getUpdateTimestamp());
                     break;
                 }
             }
@@ -432,31 +1852,42 @@ bool IVTRego6xxCtrl::processNumberUpdates()
              (false == m_confirmRsp->isPending()))
     {
         IVTRego6xxNumber* currentNumber = m_numbers[m_currentNumberUpdateIndex];
+        bool              isSuccessful  = m_busHealth.countResponse(currentNumber, *m_confirmRsp);
+
+        m_actionLatency.confirm(IVTRego6xxActionLatency::ACTION_NUMBER, isSuccessful);
 
         if (true == m_confirmRsp->isTimeout())
         {
-            ESP_LOGW(TAG, "Write number '%s' response timeout.", currentNumber->get_name().c_str());
+            IVT_REGO6XX_WRITE_LOGW(TAG, "Write number '%s' response timeout.", currentNumber->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_TIMEOUT, currentNumber, currentNumber->getWriteCmdId(), currentNumber->getAddr(), 0U);
         }
         else if (false == m_confirmRsp->isValid())
         {
-            ESP_LOGW(TAG, "Write number '%s' response invalid.", currentNumber->get_name().c_str());
+            IVT_REGO6XX_WRITE_LOGW(TAG, "Write number '%s' response invalid.", currentNumber->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_INVALID, currentNumber, currentNumber->getWriteCmdId(), currentNumber->getAddr(), 0U);
         }
         else if (Rego6xxCtrl::DEV_ADDR_HOST != m_confirmRsp->getDevAddr())
         {
-            ESP_LOGW(TAG, "Write number '%s' response has wrong destination.", currentNumber->get_name().c_str());
+            IVT_REGO6XX_WRITE_LOGW(TAG, "Write number '%s' response has wrong destination.", currentNumber->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_WRONG_DESTINATION, currentNumber, currentNumber->getWriteCmdId(), currentNumber->getAddr(), 0U);
         }
         else
         {
-            ESP_LOGI(TAG, "Write number '%s' successful.", currentNumber->get_name().c_str());
+            IVT_REGO6XX_WRITE_LOGI(TAG, "Write number '%s' successful.", currentNumber->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_SUCCESSFUL, currentNumber, currentNumber->getWriteCmdId(), currentNumber->getAddr(), m_ctrl.fromFloat(currentNumber->getValue()));
         }
 
+#ifdef IVT_REGO6XX_MODBUS
+        m_modbusServer.confirmWrite(currentNumber, isSuccessful);
+#endif /* IVT_REGO6XX_MODBUS */
+
         m_ctrl.release();
         m_confirmRsp = nullptr;
 
         ++m_currentNumberUpdateIndex;
 
         /* Pause until next sensor will be read. */
-        m_pauseTimer.start(REGO6xx_REQ_PAUSE);
+        startPause();
     }
     else
     /* Wait for pending command response. */
@@ -484,6 +1915,10 @@ bool IVTRego6xxCtrl::processSensors()
     {
         readSensors();
     }
+    else if (true == startRefreshRound(STATE_SENSORS))
+    {
+        readSensors();
+    }
 
     if (m_sensorCount > m_currentSensorIndex)
     {
@@ -504,6 +1939,10 @@ bool IVTRego6xxCtrl::processBinarySensors()
     {
         readBinarySensors();
     }
+    else if (true == startRefreshRound(STATE_BINARY_SENSORS))
+    {
+        readBinarySensors();
+    }
 
     if (m_binarySensorCount > m_currentBinarySensorIndex)
     {
@@ -524,6 +1963,10 @@ bool IVTRego6xxCtrl::processTextSensors()
     {
         readTextSensors();
     }
+    else if (true == startRefreshRound(STATE_TEXT_SENSORS))
+    {
+        readTextSensors();
+    }
 
     if (m_textSensorCount > m_currentTextSensorIndex)
     {
@@ -544,6 +1987,10 @@ bool IVTRego6xxCtrl::processNumbers()
     {
         readNumbers();
     }
+    else if (true == startRefreshRound(STATE_NUMBERS))
+    {
+        readNumbers();
+    }
 
     if (m_numberCount > m_currentNumberIndex)
     {
@@ -566,21 +2013,43 @@ void IVTRego6xxCtrl::readSensors()
         {
             m_currentSensorIndex = 0U;
 
-            /* Start timer for next sensor read immediately to keep the cycle. */
-            m_sensorTimer.start(SENSOR_READ_PERIOD);
+            /* Start timer for next sensor read immediately to keep the cycle.
+             * A targeted round of dependent entities keeps the cycle as it is.
+             */
+            if (false == isRefreshRound(STATE_SENSORS))
+            {
+                m_sensorTimer.start(m_profiles.getRoundPeriod(IVTRego6xxPollingProfiles::KIND_SENSOR, m_policy.sensorReadPeriod));
+            }
+        }
+
+        /* Skip the sensors, which are not due in this round. */
+        while ((m_sensorCount > m_currentSensorIndex) &&
+               (false == isReadDue(STATE_SENSORS, m_sensors[m_currentSensorIndex], m_policy.sensorReadPeriod)))
+        {
+            ++m_currentSensorIndex;
         }
 
+        if (m_sensorCount <= m_currentSensorIndex)
+        {
+            /* The remaining sensors are skipped, the round is complete. */
+            completeRound(STATE_SENSORS);
+        }
+        else
         {
             IVTRego6xxSensor* currentSensor = m_sensors[m_currentSensorIndex];
             uint8_t           cmdId         = currentSensor->getCmdId();
             uint16_t          addr          = currentSensor->getAddr();
 
-            ESP_LOGI(TAG, "Read sensor '%s' with 0x%02X (cmd id) at 0x%04X ...", currentSensor->get_name().c_str(), cmdId, addr);
+            IVT_REGO6XX_POLL_LOGD(TAG, "Read sensor '%s' with 0x%02X (cmd id) at 0x%04X ...", currentSensor->get_name().c_str(), cmdId, addr);
             m_rego6xxRsp = m_ctrl.readStd(cmdId, addr);
+            m_profiles.markRead(currentSensor);
+            m_samplingGroups.markRequested(currentSensor);
+            m_dependencies.markRead(currentSensor);
 
             if (nullptr == m_rego6xxRsp)
             {
-                ESP_LOGE(TAG, "Failed to read sensor '%s' with 0x%02X (cmd id) at 0x%04X!", currentSensor->get_name().c_str(), cmdId, addr);
+                IVT_REGO6XX_POLL_LOGE(TAG, "Failed to read sensor '%s' with 0x%02X (cmd id) at 0x%04X!", currentSensor->get_name().c_str(), cmdId, addr);
+                m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_REQUEST_FAILED, currentSensor, cmdId, addr, 0U);
                 nextSensor = true;
             }
         }
@@ -591,25 +2060,61 @@ void IVTRego6xxCtrl::readSensors()
     {
         IVTRego6xxSensor* currentSensor = m_sensors[m_currentSensorIndex];
 
+        m_busHealth.countResponse(currentSensor, *m_rego6xxRsp);
+
         if (true == m_rego6xxRsp->isTimeout())
         {
-            ESP_LOGW(TAG, "Read sensor '%s' response timeout.", currentSensor->get_name().c_str());
+            IVT_REGO6XX_POLL_LOGW(TAG, "Read sensor '%s' response timeout.", currentSensor->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_TIMEOUT, currentSensor, currentSensor->getCmdId(), currentSensor->getAddr(), 0U);
         }
         else if (false == m_rego6xxRsp->isValid())
         {
-            ESP_LOGW(TAG, "Read sensor '%s' response invalid.", currentSensor->get_name().c_str());
+            IVT_REGO6XX_POLL_LOGW(TAG, "Read sensor '%s' response invalid.", currentSensor->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_INVALID, currentSensor, currentSensor->getCmdId(), currentSensor->getAddr(), 0U);
         }
         else if (Rego6xxCtrl::DEV_ADDR_HOST != m_rego6xxRsp->getDevAddr())
         {
-            ESP_LOGW(TAG, "Read sensor '%s' response has wrong destination.", currentSensor->get_name().c_str());
+            IVT_REGO6XX_POLL_LOGW(TAG, "Read sensor '%s' response has wrong destination.", currentSensor->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_WRONG_DESTINATION, currentSensor, currentSensor->getCmdId(), currentSensor->getAddr(), 0U);
         }
         else
         {
             float value = m_ctrl.toFloat(m_rego6xxRsp->getValue());
 
-            currentSensor->publish_state(value);
+            /* An aggregated sensor may publish only the statistics of its windows. */
+            if (true == m_aggregation.isSamplePublished(currentSensor))
+            {
+                bool isChanged = (false == currentSensor->has_state()) || (value != currentSensor->raw_state);
+
+                EVENT_TRACE_BEGIN(Rego6xxTracepoint::ID_PUBLISH_SENSOR, m_currentSensorIndex);
+                currentSensor->publish_state(value);
+                EVENT_TRACE_END(Rego6xxTracepoint::ID_PUBLISH_SENSOR, m_currentSensorIndex);
+
+                /* Only the changes are buffered, otherwise an outage fills the outbox with the same values. */
+                if (true == isChanged)
+                {
+                    bufferState(currentSensor, value);
+                }
+            }
+
+            m_aggregation.update(currentSensor, value);
+            m_history.add(currentSensor, static_cast<int16_t>(m_rego6xxRsp->getValue()));
+            m_staleness.refresh(currentSensor);
+            m_warmStart.update(currentSensor, m_rego6xxRsp->getValue());
+            m_telemetry.update(currentSensor, m_rego6xxRsp->getValue());
+            (void)m_dependencies.update(currentSensor, m_rego6xxRsp->getValue());
+            m_derivedMetrics.update(currentSensor, value);
+
+            if (true == m_profiles.update(currentSensor->getCmdId(), currentSensor->getAddr(), m_rego6xxRsp->getValue()))
+            {
+                applyPollingProfile();
+            }
+
+            adaptSampling(currentSensor, value);
+            m_samplingGroups.setValue(currentSensor, value);
 
-            ESP_LOGI(TAG, "Read sensor '%s' successful: %0.2F (0x%06X)", currentSensor->get_name().c_str(), value, m_rego6xxRsp->getValue());
+            IVT_REGO6XX_POLL_LOGI(TAG, "Read sensor '%s' successful: %0.2F (0x%06X)", currentSensor->get_name().c_str(), value, m_rego6xxRsp->getValue());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_SUCCESSFUL, currentSensor, currentSensor->getCmdId(), currentSensor->getAddr(), m_rego6xxRsp->getValue());
         }
 
         m_ctrl.release();
@@ -626,10 +2131,22 @@ void IVTRego6xxCtrl::readSensors()
 
     if (true == nextSensor)
     {
+        IVTRego6xxSensor* currentSensor = m_sensors[m_currentSensorIndex];
+
+        if (true == m_samplingGroups.markDone(currentSensor))
+        {
+            publishDeltas(m_samplingGroups.getGroup(currentSensor));
+        }
+
         ++m_currentSensorIndex;
 
+        if (m_sensorCount <= m_currentSensorIndex)
+        {
+            completeRound(STATE_SENSORS);
+        }
+
         /* Pause until next sensor will be read. */
-        m_pauseTimer.start(REGO6xx_REQ_PAUSE);
+        startPause();
     }
 }
 
@@ -645,21 +2162,42 @@ void IVTRego6xxCtrl::readBinarySensors()
         {
             m_currentBinarySensorIndex = 0U;
 
-            /* Start timer for next binary sensor read immediately to keep the cycle. */
-            m_binarySensorTimer.start(BINARY_SENSOR_READ_PERIOD);
+            /* Start timer for next binary sensor read immediately to keep the cycle.
+             * A targeted round of dependent entities keeps the cycle as it is.
+             */
+            if (false == isRefreshRound(STATE_BINARY_SENSORS))
+            {
+                m_binarySensorTimer.start(m_profiles.getRoundPeriod(IVTRego6xxPollingProfiles::KIND_BINARY_SENSOR, m_policy.binarySensorReadPeriod));
+            }
+        }
+
+        /* Skip the binary sensors, which are not due in this round. */
+        while ((m_binarySensorCount > m_currentBinarySensorIndex) &&
+               (false == isReadDue(STATE_BINARY_SENSORS, m_binarySensors[m_currentBinarySensorIndex], m_policy.binarySensorReadPeriod)))
+        {
+            ++m_currentBinarySensorIndex;
         }
 
+        if (m_binarySensorCount <= m_currentBinarySensorIndex)
+        {
+            /* The remaining binary sensors are skipped, the round is complete. */
+            completeRound(STATE_BINARY_SENSORS);
+        }
+        else
         {
             IVTRego6xxBinarySensor* currentBinarySensor = m_binarySensors[m_currentBinarySensorIndex];
             uint8_t                 cmdId               = currentBinarySensor->getCmdId();
             uint16_t                addr                = currentBinarySensor->getAddr();
 
-            ESP_LOGI(TAG, "Read binary sensor '%s' with 0x%02X (cmd id) at 0x%04X ...", currentBinarySensor->get_name().c_str(), cmdId, addr);
+            IVT_REGO6XX_POLL_LOGD(TAG, "Read binary sensor '%s' with 0x%02X (cmd id) at 0x%04X ...", currentBinarySensor->get_name().c_str(), cmdId, addr);
             m_rego6xxRsp = m_ctrl.readStd(cmdId, addr);
+            m_profiles.markRead(currentBinarySensor);
+            m_dependencies.markRead(currentBinarySensor);
 
             if (nullptr == m_rego6xxRsp)
             {
-                ESP_LOGE(TAG, "Failed to read binary sensor '%s' with 0x%02X (cmd id) at 0x%04X!", currentBinarySensor->get_name().c_str(), cmdId, addr);
+                IVT_REGO6XX_POLL_LOGE(TAG, "Failed to read binary sensor '%s' with 0x%02X (cmd id) at 0x%04X!", currentBinarySensor->get_name().c_str(), cmdId, addr);
+                m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_REQUEST_FAILED, currentBinarySensor, cmdId, addr, 0U);
                 nextSensor = true;
             }
         }
@@ -670,25 +2208,50 @@ void IVTRego6xxCtrl::readBinarySensors()
     {
         IVTRego6xxBinarySensor* currentBinarySensor = m_binarySensors[m_currentBinarySensorIndex];
 
+        m_busHealth.countResponse(currentBinarySensor, *m_rego6xxRsp);
+
         if (true == m_rego6xxRsp->isTimeout())
         {
-            ESP_LOGW(TAG, "Read binary sensor '%s' response timeout.", currentBinarySensor->get_name().c_str());
+            IVT_REGO6XX_POLL_LOGW(TAG, "Read binary sensor '%s' response timeout.", currentBinarySensor->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_TIMEOUT, currentBinarySensor, currentBinarySensor->getCmdId(), currentBinarySensor->getAddr(), 0U);
         }
         else if (false == m_rego6xxRsp->isValid())
         {
-            ESP_LOGW(TAG, "Read binary sensor '%s' response invalid.", currentBinarySensor->get_name().c_str());
+            IVT_REGO6XX_POLL_LOGW(TAG, "Read binary sensor '%s' response invalid.", currentBinarySensor->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_INVALID, currentBinarySensor, currentBinarySensor->getCmdId(), currentBinarySensor->getAddr(), 0U);
         }
         else if (Rego6xxCtrl::DEV_ADDR_HOST != m_rego6xxRsp->getDevAddr())
         {
-            ESP_LOGW(TAG, "Read binary sensor '%s' response has wrong destination.", currentBinarySensor->get_name().c_str());
+            IVT_REGO6XX_POLL_LOGW(TAG, "Read binary sensor '%s' response has wrong destination.", currentBinarySensor->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_WRONG_DESTINATION, currentBinarySensor, currentBinarySensor->getCmdId(), currentBinarySensor->getAddr(), 0U);
         }
         else
         {
-            bool state = m_ctrl.toBool(m_rego6xxRsp->getValue());
+            bool state     = m_ctrl.toBool(m_rego6xxRsp->getValue());
+            bool isChanged = (false == currentBinarySensor->has_state()) || (state != currentBinarySensor->state);
 
+            EVENT_TRACE_BEGIN(Rego6xxTracepoint::ID_PUBLISH_BINARY_SENSOR, m_currentBinarySensorIndex);
             currentBinarySensor->publish_state(state);
+            EVENT_TRACE_END(Rego6xxTracepoint::ID_PUBLISH_BINARY_SENSOR, m_currentBinarySensorIndex);
+
+            /* A binary sensor publishes only its changes. */
+            if (true == isChanged)
+            {
+                bufferState(currentBinarySensor, (false == state) ? 0.0F : 1.0F);
+            }
+            m_staleness.refresh(currentBinarySensor);
+            m_warmStart.update(currentBinarySensor, m_rego6xxRsp->getValue());
+            m_telemetry.update(currentBinarySensor, m_rego6xxRsp->getValue());
+            (void)m_dependencies.update(currentBinarySensor, m_rego6xxRsp->getValue());
+            m_derivedMetrics.update(currentBinarySensor, (false == state) ? 0.0F : 1.0F);
+
+            if (true == m_profiles.update(currentBinarySensor->getCmdId(), currentBinarySensor->getAddr(), m_rego6xxRsp->getValue()))
+            {
+                applyPollingProfile();
+            }
 
-            ESP_LOGI(TAG, "Read binary sensor '%s' successful: %s (0x%06X)", currentBinarySensor->get_name().c_str(), (false == state) ? "false" : "true", m_rego6xxRsp->getValue());
+            IVT_REGO6XX_POLL_LOGI(TAG, "Read binary sensor '%s' successful: %s (0x%06X)", currentBinarySensor->get_name().c_str(), (false == state) ? "false" : "true", m_rego6xxRsp->getValue());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_SUCCESSFUL, currentBinarySensor, currentBinarySensor->getCmdId(), currentBinarySensor->getAddr(), m_rego6xxRsp->getValue());
         }
 
         m_ctrl.release();
@@ -707,8 +2270,13 @@ void IVTRego6xxCtrl::readBinarySensors()
     {
         ++m_currentBinarySensorIndex;
 
+        if (m_binarySensorCount <= m_currentBinarySensorIndex)
+        {
+            completeRound(STATE_BINARY_SENSORS);
+        }
+
         /* Pause until next binary sensor will be read. */
-        m_pauseTimer.start(REGO6xx_REQ_PAUSE);
+        startPause();
     }
 }
 
@@ -724,21 +2292,45 @@ void IVTRego6xxCtrl::readTextSensors()
         {
             m_currentTextSensorIndex = 0U;
 
-            /* Start timer for next text sensor read immediately to keep the cycle. */
-            m_textSensorTimer.start(TEXT_SENSOR_READ_PERIOD);
+            /* A new cycle reads the whole display after a button press.
+             * A targeted round of dependent entities keeps the cycle as it is.
+             */
+            if (false == isRefreshRound(STATE_TEXT_SENSORS))
+            {
+                m_actionLatency.beginDisplayRefresh();
+
+                /* Start timer for next text sensor read immediately to keep the cycle. */
+                m_textSensorTimer.start(m_profiles.getRoundPeriod(IVTRego6xxPollingProfiles::KIND_TEXT_SENSOR, m_policy.textSensorReadPeriod));
+            }
+        }
+
+        /* Skip the text sensors, which are not due in this round. */
+        while ((m_textSensorCount > m_currentTextSensorIndex) &&
+               (false == isReadDue(STATE_TEXT_SENSORS, m_textSensors[m_currentTextSensorIndex], m_policy.textSensorReadPeriod)))
+        {
+            ++m_currentTextSensorIndex;
         }
 
+        if (m_textSensorCount <= m_currentTextSensorIndex)
+        {
+            /* The remaining text sensors are skipped, the round is complete. */
+            completeRound(STATE_TEXT_SENSORS);
+        }
+        else
         {
             IVTRego6xxTextSensor* currentTextSensor = m_textSensors[m_currentTextSensorIndex];
             uint8_t               cmdId             = currentTextSensor->getCmdId();
             uint16_t              addr              = currentTextSensor->getAddr();
 
-            ESP_LOGI(TAG, "Read text sensor '%s' with 0x%02X (cmd id) at 0x%04X ...", currentTextSensor->get_name().c_str(), cmdId, addr);
+            IVT_REGO6XX_POLL_LOGD(TAG, "Read text sensor '%s' with 0x%02X (cmd id) at 0x%04X ...", currentTextSensor->get_name().c_str(), cmdId, addr);
             m_displayRsp = m_ctrl.readDisplay(cmdId, addr);
+            m_profiles.markRead(currentTextSensor);
+            m_dependencies.markRead(currentTextSensor);
 
             if (nullptr == m_displayRsp)
             {
-                ESP_LOGE(TAG, "Failed to read text sensor '%s' with 0x%02X (cmd id) at 0x%04X!", currentTextSensor->get_name().c_str(), cmdId, addr);
+                IVT_REGO6XX_POLL_LOGE(TAG, "Failed to read text sensor '%s' with 0x%02X (cmd id) at 0x%04X!", currentTextSensor->get_name().c_str(), cmdId, addr);
+                m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_REQUEST_FAILED, currentTextSensor, cmdId, addr, 0U);
                 nextSensor = true;
             }
         }
@@ -749,17 +2341,22 @@ void IVTRego6xxCtrl::readTextSensors()
     {
         IVTRego6xxTextSensor* currentTextSensor = m_textSensors[m_currentTextSensorIndex];
 
+        m_busHealth.countResponse(currentTextSensor, *m_displayRsp);
+
         if (true == m_displayRsp->isTimeout())
         {
-            ESP_LOGW(TAG, "Read text sensor '%s' response timeout.", currentTextSensor->get_name().c_str());
+            IVT_REGO6XX_POLL_LOGW(TAG, "Read text sensor '%s' response timeout.", currentTextSensor->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_TIMEOUT, currentTextSensor, currentTextSensor->getCmdId(), currentTextSensor->getAddr(), 0U);
         }
         else if (false == m_displayRsp->isValid())
         {
-            ESP_LOGW(TAG, "Read text sensor '%s' response invalid.", currentTextSensor->get_name().c_str());
+            IVT_REGO6XX_POLL_LOGW(TAG, "Read text sensor '%s' response invalid.", currentTextSensor->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_INVALID, currentTextSensor, currentTextSensor->getCmdId(), currentTextSensor->getAddr(), 0U);
         }
         else if (Rego6xxCtrl::DEV_ADDR_HOST != m_displayRsp->getDevAddr())
         {
-            ESP_LOGW(TAG, "Read text sensor '%s' response has wrong destination.", currentTextSensor->get_name().c_str());
+            IVT_REGO6XX_POLL_LOGW(TAG, "Read text sensor '%s' response has wrong destination.", currentTextSensor->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_WRONG_DESTINATION, currentTextSensor, currentTextSensor->getCmdId(), currentTextSensor->getAddr(), 0U);
         }
         else
         {
@@ -767,9 +2364,14 @@ void IVTRego6xxCtrl::readTextSensors()
             std::string msgUtf8;
 
             iso8859_1_to_utf8(msg.c_str(), msgUtf8);
+            EVENT_TRACE_BEGIN(Rego6xxTracepoint::ID_PUBLISH_TEXT_SENSOR, m_currentTextSensorIndex);
             currentTextSensor->publish_state(msgUtf8);
+            EVENT_TRACE_END(Rego6xxTracepoint::ID_PUBLISH_TEXT_SENSOR, m_currentTextSensorIndex);
+            m_staleness.refresh(currentTextSensor);
+            m_actionLatency.publish(IVTRego6xxActionLatency::ACTION_BUTTON, currentTextSensor, (m_textSensorCount <= (m_currentTextSensorIndex + 1U)));
 
-            ESP_LOGI(TAG, "Read text sensor '%s' successful.", currentTextSensor->get_name().c_str());
+            IVT_REGO6XX_POLL_LOGI(TAG, "Read text sensor '%s' successful.", currentTextSensor->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_SUCCESSFUL, currentTextSensor, currentTextSensor->getCmdId(), currentTextSensor->getAddr(), 0U);
         }
 
         m_ctrl.release();
@@ -788,8 +2390,13 @@ void IVTRego6xxCtrl::readTextSensors()
     {
         ++m_currentTextSensorIndex;
 
+        if (m_textSensorCount <= m_currentTextSensorIndex)
+        {
+            completeRound(STATE_TEXT_SENSORS);
+        }
+
         /* Pause until next binary sensor will be read. */
-        m_pauseTimer.start(REGO6xx_REQ_PAUSE);
+        startPause();
     }
 }
 
@@ -805,21 +2412,42 @@ void IVTRego6xxCtrl::readNumbers()
         {
             m_currentNumberIndex = 0U;
 
-            /* Start timer for next number read immediately to keep the cycle. */
-            m_numberTimer.start(NUMBER_READ_PERIOD);
+            /* Start timer for next number read immediately to keep the cycle.
+             * A targeted round of dependent entities keeps the cycle as it is.
+             */
+            if (false == isRefreshRound(STATE_NUMBERS))
+            {
+                m_numberTimer.start(m_profiles.getRoundPeriod(IVTRego6xxPollingProfiles::KIND_NUMBER, m_policy.numberReadPeriod));
+            }
+        }
+
+        /* Skip the numbers, which are not due in this round. */
+        while ((m_numberCount > m_currentNumberIndex) &&
+               (false == isReadDue(STATE_NUMBERS, m_numbers[m_currentNumberIndex], m_policy.numberReadPeriod)))
+        {
+            ++m_currentNumberIndex;
         }
 
+        if (m_numberCount <= m_currentNumberIndex)
+        {
+            /* The remaining numbers are skipped, the round is complete. */
+            completeRound(STATE_NUMBERS);
+        }
+        else
         {
             IVTRego6xxNumber* currentNumber = m_numbers[m_currentNumberIndex];
             uint8_t           cmdId         = currentNumber->getReadCmdId();
             uint16_t          addr          = currentNumber->getAddr();
 
-            ESP_LOGI(TAG, "Read number '%s' with 0x%02X (cmd id) at 0x%04X ...", currentNumber->get_name().c_str(), cmdId, addr);
+            IVT_REGO6XX_POLL_LOGD(TAG, "Read number '%s' with 0x%02X (cmd id) at 0x%04X ...", currentNumber->get_name().c_str(), cmdId, addr);
             m_rego6xxRsp = m_ctrl.readStd(cmdId, addr);
+            m_profiles.markRead(currentNumber);
+            m_dependencies.markRead(currentNumber);
 
             if (nullptr == m_rego6xxRsp)
             {
-                ESP_LOGE(TAG, "Failed to read number '%s' with 0x%02X (cmd id) at 0x%04X!", currentNumber->get_name().c_str(), cmdId, addr);
+                IVT_REGO6XX_POLL_LOGE(TAG, "Failed to read number '%s' with 0x%02X (cmd id) at 0x%04X!", currentNumber->get_name().c_str(), cmdId, addr);
+                m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_REQUEST_FAILED, currentNumber, cmdId, addr, 0U);
                 nextSensor = true;
             }
         }
@@ -830,25 +2458,47 @@ void IVTRego6xxCtrl::readNumbers()
     {
         IVTRego6xxNumber* currentNumber = m_numbers[m_currentNumberIndex];
 
+        m_busHealth.countResponse(currentNumber, *m_rego6xxRsp);
+
         if (true == m_rego6xxRsp->isTimeout())
         {
-            ESP_LOGW(TAG, "Read number '%s' response timeout.", currentNumber->get_name().c_str());
+            IVT_REGO6XX_POLL_LOGW(TAG, "Read number '%s' response timeout.", currentNumber->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_TIMEOUT, currentNumber, currentNumber->getReadCmdId(), currentNumber->getAddr(), 0U);
         }
         else if (false == m_rego6xxRsp->isValid())
         {
-            ESP_LOGW(TAG, "Read number '%s' response invalid.", currentNumber->get_name().c_str());
+            IVT_REGO6XX_POLL_LOGW(TAG, "Read number '%s' response invalid.", currentNumber->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_INVALID, currentNumber, currentNumber->getReadCmdId(), currentNumber->getAddr(), 0U);
         }
         else if (Rego6xxCtrl::DEV_ADDR_HOST != m_rego6xxRsp->getDevAddr())
         {
-            ESP_LOGW(TAG, "Read number '%s' response has wrong destination.", currentNumber->get_name().c_str());
+            IVT_REGO6XX_POLL_LOGW(TAG, "Read number '%s' response has wrong destination.", currentNumber->get_name().c_str());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_WRONG_DESTINATION, currentNumber, currentNumber->getReadCmdId(), currentNumber->getAddr(), 0U);
         }
         else
         {
-            float value = m_ctrl.toFloat(m_rego6xxRsp->getValue());
+            float value     = m_ctrl.toFloat(m_rego6xxRsp->getValue());
+            bool  isChanged = (false == currentNumber->has_state()) || (value != currentNumber->state);
 
+            EVENT_TRACE_BEGIN(Rego6xxTracepoint::ID_PUBLISH_NUMBER, m_currentNumberIndex);
             currentNumber->publish_state(value);
+            EVENT_TRACE_END(Rego6xxTracepoint::ID_PUBLISH_NUMBER, m_currentNumberIndex);
 
-            ESP_LOGI(TAG, "Read number '%s' successful: %0.2F (0x%06X)", currentNumber->get_name().c_str(), value, m_rego6xxRsp->getValue());
+            /* Only the changes are buffered, otherwise an outage fills the outbox with the same values. */
+            if (true == isChanged)
+            {
+                bufferState(currentNumber, value);
+            }
+
+            m_staleness.refresh(currentNumber);
+            m_warmStart.update(currentNumber, m_rego6xxRsp->getValue());
+            m_telemetry.update(currentNumber, m_rego6xxRsp->getValue());
+            (void)m_dependencies.update(currentNumber, m_rego6xxRsp->getValue());
+            m_derivedMetrics.update(currentNumber, value);
+            m_actionLatency.publish(IVTRego6xxActionLatency::ACTION_NUMBER, currentNumber, true);
+
+            IVT_REGO6XX_POLL_LOGI(TAG, "Read number '%s' successful: %0.2F (0x%06X)", currentNumber->get_name().c_str(), value, m_rego6xxRsp->getValue());
+            m_deferredLog.add(IVTRego6xxDeferredLog::EVENT_SUCCESSFUL, currentNumber, currentNumber->getReadCmdId(), currentNumber->getAddr(), m_rego6xxRsp->getValue());
         }
 
         m_ctrl.release();
@@ -866,8 +2516,13 @@ void IVTRego6xxCtrl::readNumbers()
     {
         ++m_currentNumberIndex;
 
+        if (m_numberCount <= m_currentNumberIndex)
+        {
+            completeRound(STATE_NUMBERS);
+        }
+
         /* Pause until next number will be read. */
-        m_pauseTimer.start(REGO6xx_REQ_PAUSE);
+        startPause();
     }
 }
 
@@ -43,18 +43,55 @@
  * Includes
  *****************************************************************************/
 
+#include "esphome/core/defines.h"
 #include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
 #include "esphome/components/uart/uart.h"
 #include "Rego6xxCtrl.h"
+#include "Rego6xxRecorder.h"
+#include "Rego6xxReplay.h"
+#include "Rego6xxTraceBuffer.h"
 
 #include "SimpleTimer.hpp"
 #include "StreamUartDevAdapter.h"
+#include "IVTRego6xxWebHandler.h"
+#include "IVTRego6xxBenchmark.h"
+#include "IVTRego6xxPollingPolicy.h"
+#include "IVTRego6xxPollingBenchmark.h"
+#include "IVTRego6xxBusHealth.h"
+#include "IVTRego6xxStaleness.h"
+#include "IVTRego6xxActionLatency.h"
+#include "IVTRego6xxLoopCost.h"
+#include "IVTRego6xxDeferredLog.h"
+#include "IVTRego6xxWarmStart.h"
+#include "IVTRego6xxPollingProfiles.h"
+#include "IVTRego6xxDependencies.h"
+#include "IVTRego6xxAdaptiveSampling.h"
+#include "IVTRego6xxSamplingGroups.h"
+#include "IVTRego6xxDerivedMetrics.h"
+#include "IVTRego6xxAggregation.h"
+#include "IVTRego6xxHistory.h"
+#include "IVTRego6xxOutbox.h"
+#include "IVTRego6xxTelemetry.h"
+#include "IVTRego6xxModbusServer.h"
 #include "sensor/IVTRego6xxSensor.h"
+#include "sensor/IVTRego6xxLatencySensor.h"
+#include "sensor/IVTRego6xxBusSensor.h"
+#include "sensor/IVTRego6xxActionLatencySensor.h"
+#include "sensor/IVTRego6xxLoopSensor.h"
+#include "sensor/IVTRego6xxDeltaSensor.h"
+#include "sensor/IVTRego6xxDerivedSensor.h"
+#include "sensor/IVTRego6xxAggregateSensor.h"
 #include "binary_sensor/IVTRego6xxBinarySensor.h"
+#include "binary_sensor/IVTRego6xxSlaBinarySensor.h"
 #include "text_sensor/IVTRego6xxTextSensor.h"
 #include "button/IVTRego6xxButton.h"
 #include "number/IVTRego6xxNumber.h"
 
+#ifdef USE_TIME
+#include "esphome/components/time/real_time_clock.h"
+#endif /* USE_TIME */
+
 /******************************************************************************
  * Macros
  *****************************************************************************/
@@ -78,17 +115,52 @@ class IVTRego6xxCtrl : public uart::UARTDevice, public Component
 {
 public:
 
+    /**
+     * Kinds of entities, which can be part of the startup burst.
+     */
+    enum BurstKind
+    {
+        BURST_KIND_SENSORS = 0U,   /**< Sensors */
+        BURST_KIND_BINARY_SENSORS, /**< Binary sensors */
+        BURST_KIND_TEXT_SENSORS,   /**< Text sensors */
+        BURST_KIND_NUMBERS,        /**< Numbers */
+        BURST_KIND_COUNT           /**< Number of kinds */
+    };
+
     /**
      * Constructs the IVT rego6xx controller component.
      */
     IVTRego6xxCtrl() :
+#ifdef IVT_REGO6XX_POLLING_BENCHMARK
+        m_pollingBenchmark(),
+#endif /* IVT_REGO6XX_POLLING_BENCHMARK */
+#ifdef IVT_REGO6XX_REPLAY
+        m_replay(nullptr, 0U),
+        m_isReplayFinished(false),
+#endif /* IVT_REGO6XX_REPLAY */
         m_adapter(),
-        m_ctrl(m_adapter),
+#if defined(IVT_REGO6XX_POLLING_BENCHMARK)
+        m_recorder(m_pollingBenchmark.getStream()),
+#elif defined(IVT_REGO6XX_REPLAY)
+        m_recorder(m_replay),
+#else
+        m_recorder(m_adapter),
+#endif
+        m_recording(),
+        m_recorderSize(0U),
+        m_frameTraceSize(0U),
+#ifdef USE_WEBSERVER
+        m_webHandler(),
+#endif /* USE_WEBSERVER */
+        m_ctrl(m_recorder),
+        m_policy(),
         m_state(STATE_BUTTONS),
         m_pauseTimer(),
+        m_pause(0U),
         m_rego6xxRsp(nullptr),
         m_displayRsp(nullptr),
         m_confirmRsp(nullptr),
+        m_highFrequencyLoop(),
 
         m_sensorTimer(),
         m_sensorCount(0U),
@@ -113,7 +185,91 @@ public:
         m_numberCount(0U),
         m_numbers{ nullptr },
         m_currentNumberIndex(MAX_NUMBERS),
-        m_currentNumberUpdateIndex(MAX_NUMBERS)
+        m_currentNumberUpdateIndex(MAX_NUMBERS),
+
+        m_latencyTimer(),
+        m_latencySensorCount(0U),
+        m_latencySensors{ nullptr },
+        m_actionLatency(),
+        m_actionLatencySensorCount(0U),
+        m_actionLatencySensors{ nullptr },
+
+        m_busHealth(),
+        m_busHealthTimer(),
+        m_busSensorCount(0U),
+        m_busSensors{ nullptr },
+
+        m_staleness(),
+        m_stalenessTimer(),
+        m_slaBinarySensor(nullptr),
+
+        m_loopCost(),
+        m_loopCostTimer(),
+        m_loopSensorCount(0U),
+        m_loopSensors{ nullptr },
+
+        m_deferredLog(),
+
+        m_warmStart(),
+        m_warmStartTimer(),
+        m_warmStartSaveInterval(0U),
+
+        m_profiles(),
+
+        m_dependencies(),
+        m_refreshRounds(0U),
+
+        m_adaptiveSampling(),
+
+        m_samplingGroups(),
+        m_deltaSensorCount(0U),
+        m_deltaSensors{ nullptr },
+
+        m_derivedMetrics(),
+        m_derivedMetricsTimer(),
+        m_derivedMetricsSaveTimer(),
+        m_derivedMetricsSaveInterval(0U),
+        m_derivedSensorCount(0U),
+        m_derivedSensors{ nullptr },
+
+        m_aggregation(),
+        m_aggregationTimer(),
+        m_aggregateSensorCount(0U),
+        m_aggregateSensors{ nullptr },
+
+        m_history(),
+
+        m_outbox(),
+        m_outboxSize(0U),
+        m_outboxReplayInterval(0U),
+        m_outboxReplayTimer(),
+#ifdef USE_TIME
+        m_outboxTime(nullptr),
+#endif /* USE_TIME */
+
+        m_telemetry(),
+        m_telemetryInterval(0U),
+        m_telemetryTimer(),
+        m_isTelemetryBinary(false),
+
+#ifdef IVT_REGO6XX_MODBUS
+        m_modbusServer(),
+#endif /* IVT_REGO6XX_MODBUS */
+
+        m_isBurstEnabled(false),
+        m_burstInitialDelay(SENSOR_READ_INITIAL),
+        m_burstRequestPause(0U),
+        m_burstOrder{ STATE_SENSORS },
+        m_burstOrderCount(0U),
+        m_burstOrderIndex(0U),
+        m_burstRounds(0U),
+        m_pollingStart(0U),
+        m_snapshotDuration(0U)
+#ifdef IVT_REGO6XX_BENCHMARK
+        ,
+        m_benchmark(),
+        m_isBenchmarkFinished(false)
+#endif /* IVT_REGO6XX_BENCHMARK */
     {
         m_adapter.setUartDevice(this);
     }
@@ -135,6 +291,11 @@ public:
      */
     void loop() override;
 
+    /**
+     * Save the last-known entity values before a reboot.
+     */
+    void on_shutdown() override;
+
     /**
      * Dump the configuration of the component.
      */
@@ -180,6 +341,392 @@ public:
      */
     void registerNumber(IVTRego6xxNumber* number);
 
+    /**
+     * Register a latency sensor.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] sensor    The latency sensor to register.
+     */
+    void registerLatencySensor(IVTRego6xxLatencySensor* sensor);
+
+    /**
+     * Register a user action latency sensor.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] sensor    The user action latency sensor to register.
+     */
+    void registerActionLatencySensor(IVTRego6xxActionLatencySensor* sensor);
+
+    /**
+     * Register a bus health sensor.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] sensor    The bus health sensor to register.
+     */
+    void registerBusSensor(IVTRego6xxBusSensor* sensor);
+
+    /**
+     * Register the service level binary sensor, which is on as long as
+     * at least one entity exceeds its maximum age.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] binarySensor  The service level binary sensor to register.
+     */
+    void registerSlaBinarySensor(IVTRego6xxSlaBinarySensor* binarySensor);
+
+    /**
+     * Register a main loop cost sensor.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] sensor    The main loop cost sensor to register.
+     */
+    void registerLoopSensor(IVTRego6xxLoopSensor* sensor);
+
+    /**
+     * Register a delta sensor.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] sensor    The delta sensor to register.
+     */
+    void registerDeltaSensor(IVTRego6xxDeltaSensor* sensor);
+
+    /**
+     * Add a sampling group, whose members are read back to back as one unit.
+     * The following members are added to it.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] name  Name of the group
+     */
+    void addSamplingGroup(const char* name);
+
+    /**
+     * Add a registered sensor to the last added sampling group.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] sensor    The registered sensor.
+     */
+    void addSamplingGroupMember(IVTRego6xxSensor* sensor);
+
+    /**
+     * Register a derived metric sensor.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] sensor    The derived metric sensor to register.
+     */
+    void registerDerivedSensor(IVTRego6xxDerivedSensor* sensor);
+
+    /**
+     * Set the registered entity, which feeds an input of the derived metrics.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] input     Input of the derived metrics
+     * @param[in] entity    The sensor, binary sensor or number.
+     */
+    void setDerivedMetricsInput(IVTRego6xxDerivedMetrics::Input input, const EntityBase* entity);
+
+    /**
+     * Set the interval for saving the totals of the derived metrics to the preferences.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] interval  Save interval in ms. 0 disables saving.
+     */
+    void setDerivedMetricsSaveInterval(uint32_t interval)
+    {
+        m_derivedMetricsSaveInterval = interval;
+    }
+
+    /**
+     * Set the maximum age of the value of a registered entity.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] entity    The registered sensor, binary sensor, text sensor or number.
+     * @param[in] maxAge    Maximum age in ms. 0 disables the check.
+     */
+    void setMaxAge(const EntityBase* entity, uint32_t maxAge);
+
+    /**
+     * Enable the polling profiles, which are selected by the operating mode
+     * of the heatpump.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] holdTime  Time in ms, a new operating mode shall be detected until its profile is activated.
+     */
+    void setPollingProfiles(uint32_t holdTime)
+    {
+        m_profiles.enable(holdTime);
+    }
+
+    /**
+     * Set the read period of a registered entity in a polling profile.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] entity    The registered sensor, binary sensor, text sensor or number.
+     * @param[in] profile   Polling profile
+     * @param[in] period    Read period in ms. 0 uses the period of its kind.
+     */
+    void setPollPeriod(const EntityBase* entity, IVTRego6xxPollingProfiles::Profile profile, uint32_t period);
+
+    /**
+     * Adapt the read period of a registered sensor to the rate of change of
+     * its value.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] entity    The registered sensor.
+     * @param[in] minPeriod Minimum read period in ms
+     * @param[in] maxPeriod Maximum read period in ms
+     * @param[in] tolerance Change of the value, which is tolerated between two reads.
+     */
+    void setAdaptiveSampling(const EntityBase* entity, uint32_t minPeriod, uint32_t maxPeriod, float tolerance);
+
+    /**
+     * Aggregate the values of a registered sensor over consecutive windows.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] entity            The registered sensor.
+     * @param[in] window            Window duration in ms
+     * @param[in] isSamplePublished Shall every read value still be published by the sensor?
+     */
+    void setAggregation(const EntityBase* entity, uint32_t window, bool isSamplePublished);
+
+    /**
+     * Register an aggregate sensor.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] sensor    The aggregate sensor to register.
+     */
+    void registerAggregateSensor(IVTRego6xxAggregateSensor* sensor);
+
+    /**
+     * Keep the read values of a registered sensor compressed in RAM.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] entity    The registered sensor.
+     * @param[in] size      Memory size in byte
+     */
+    void setHistory(const EntityBase* entity, size_t size);
+
+    /**
+     * Buffer the published entity values while the MQTT broker is not
+     * reachable and replay them after the connection is back.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] size              Maximum number of buffered values
+     * @param[in] replayInterval    Interval in ms between two replayed values
+     */
+    void setMqttOutbox(size_t size, uint32_t replayInterval)
+    {
+        m_outboxSize           = size;
+        m_outboxReplayInterval = replayInterval;
+    }
+
+    /**
+     * Publish the changed entity values combined in a single telemetry frame
+     * per interval and provide the snapshot of all values.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] interval  Interval in ms between two frames
+     * @param[in] isBinary  Shall the frames be published in the binary format instead of JSON?
+     */
+    void setTelemetry(uint32_t interval, bool isBinary)
+    {
+        m_telemetryInterval = interval;
+        m_isTelemetryBinary = isBinary;
+    }
+
+#ifdef IVT_REGO6XX_MODBUS
+    /**
+     * Set the TCP port of the Modbus TCP server, which provides the entity
+     * values as registers.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] port  TCP port
+     */
+    void setModbusPort(uint16_t port)
+    {
+        m_modbusServer.setPort(port);
+    }
+#endif /* IVT_REGO6XX_MODBUS */
+
+#ifdef IVT_REGO6XX_REPLAY
+    /**
+     * Set the recorded trace, which takes the place of the heatpump.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] trace Recorded trace, incl. file header.
+     * @param[in] size  Trace size in byte
+     * @param[in] speed Speed factor, 0 provides every response immediately.
+     */
+    void setReplay(const uint8_t* trace, size_t size, uint8_t speed)
+    {
+        m_replay.setTrace(trace, size);
+        m_replay.setSpeed(speed);
+    }
+#endif /* IVT_REGO6XX_REPLAY */
+
+#ifdef USE_TIME
+    /**
+     * Set the time source, which provides the original timestamp of the
+     * replayed values.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] time  Time source
+     */
+    void setMqttOutboxTime(time::RealTimeClock* time)
+    {
+        m_outboxTime = time;
+    }
+#endif /* USE_TIME */
+
+    /**
+     * Add a dependency between two registered entities: if the value of the
+     * trigger changes, the target shall be read within the given time.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] trigger   The sensor, binary sensor or number, which value change triggers the refresh.
+     * @param[in] target    The sensor, binary sensor, text sensor or number, which shall be refreshed.
+     * @param[in] within    Time in ms, the target shall be read after the change.
+     */
+    void addDependency(const EntityBase* trigger, const EntityBase* target, uint32_t within);
+
+    /**
+     * Set the size of the UART traffic recording buffer.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] size  Buffer size in byte. 0 disables the recorder.
+     */
+    void setRecorderSize(size_t size)
+    {
+        m_recorderSize = size;
+    }
+
+    /**
+     * Set the interval for saving the last-known entity values to the preferences.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] interval  Save interval in ms. 0 disables the warm start.
+     */
+    void setWarmStartSaveInterval(uint32_t interval)
+    {
+        m_warmStartSaveInterval = interval;
+    }
+
+    /**
+     * Enable the startup burst, which reads every entity once in the burst
+     * order with a minimal request pause after the start.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] initialDelay  Delay in ms until the burst starts.
+     * @param[in] requestPause  Pause between every request of the burst in ms.
+     */
+    void setStartupBurst(uint32_t initialDelay, uint32_t requestPause)
+    {
+        m_isBurstEnabled    = true;
+        m_burstInitialDelay = initialDelay;
+        m_burstRequestPause = requestPause;
+    }
+
+    /**
+     * Append a kind of entities to the startup burst order. The first added
+     * kind is read first. Kinds, which are not added, are read after the
+     * initial snapshot is complete.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] kind  Kind of entities
+     */
+    void addStartupBurstKind(BurstKind kind);
+
+    /**
+     * Set the size of the protocol frame ring.
+     * This will be called during setup() by the code generated by ESPHome.
+     *
+     * @param[in] size  Ring size in byte. 0 disables the frame trace.
+     */
+    void setFrameTraceSize(size_t size)
+    {
+        m_frameTraceSize = size;
+    }
+
+    /**
+     * Set the polling policy. Set it before setup, otherwise it takes
+     * effect with the next read cycle.
+     *
+     * @param[in] policy    Polling policy
+     */
+    void setPollingPolicy(const IVTRego6xxPollingPolicy& policy)
+    {
+        m_policy = policy;
+    }
+
+#ifdef IVT_REGO6XX_POLLING_BENCHMARK
+    /**
+     * Set the virtual duration of the polling benchmark.
+     *
+     * @param[in] duration  Duration in ms
+     */
+    void setPollingBenchmarkDuration(uint32_t duration)
+    {
+        m_pollingBenchmark.setDuration(duration);
+    }
+
+    /**
+     * Set the virtual interval between two scripted button presses of the
+     * polling benchmark.
+     *
+     * @param[in] interval  Interval in ms. 0 disables the button presses.
+     */
+    void setPollingBenchmarkPressInterval(uint32_t interval)
+    {
+        m_pollingBenchmark.setPressInterval(interval);
+    }
+
+    /**
+     * Set the virtual interval, after which the scripted alarm of the
+     * polling benchmark is raised or cleared.
+     *
+     * @param[in] interval  Interval in ms. 0 disables the alarms.
+     */
+    void setPollingBenchmarkAlarmInterval(uint32_t interval)
+    {
+        m_pollingBenchmark.setAlarmInterval(interval);
+    }
+
+    /**
+     * Set the virtual interval between two scripted temperature changes
+     * of the polling benchmark.
+     *
+     * @param[in] interval  Interval in ms. 0 disables the temperature changes.
+     */
+    void setPollingBenchmarkTemperatureInterval(uint32_t interval)
+    {
+        m_pollingBenchmark.setTemperatureInterval(interval);
+    }
+
+    /**
+     * Add a polling policy, which shall be compared by the polling benchmark.
+     *
+     * @param[in] name                      Name of the policy
+     * @param[in] sensorReadPeriod          Period in ms for reading sensors.
+     * @param[in] binarySensorReadPeriod    Period in ms for reading binary sensors.
+     * @param[in] textSensorReadPeriod      Period in ms for reading text sensors.
+     * @param[in] numberReadPeriod          Period in ms for reading numbers.
+     * @param[in] requestPause              Pause between every request in ms.
+     * @param[in] isButtonPreemptive        Are buttons handled after every request?
+     */
+    void addPollingBenchmarkPolicy(const char* name, uint32_t sensorReadPeriod, uint32_t binarySensorReadPeriod, uint32_t textSensorReadPeriod, uint32_t numberReadPeriod, uint32_t requestPause, bool isButtonPreemptive)
+    {
+        IVTRego6xxPollingPolicy policy;
+
+        policy.sensorReadPeriod       = sensorReadPeriod;
+        policy.binarySensorReadPeriod = binarySensorReadPeriod;
+        policy.textSensorReadPeriod   = textSensorReadPeriod;
+        policy.numberReadPeriod       = numberReadPeriod;
+        policy.requestPause           = requestPause;
+        policy.isButtonPreemptive     = isButtonPreemptive;
+
+        m_pollingBenchmark.addPolicy(name, policy);
+    }
+#endif /* IVT_REGO6XX_POLLING_BENCHMARK */
+
 private:
 
     /**
@@ -199,7 +746,7 @@ private:
     static const size_t MAX_SENSORS                 = 11U;
 
     /** Maximum number of binary sensors. */
-    static const size_t MAX_BINARY_SENSORS          = 5U;
+    static const size_t MAX_BINARY_SENSORS          = 10U;
 
     /** Maximum number of text sensors. */
     static const size_t MAX_TEXT_SENSORS            = 4U;
@@ -210,34 +757,98 @@ private:
     /** Maximum number of numbers. */
     static const size_t MAX_NUMBERS                 = 8U;
 
+    /** Maximum number of latency sensors, which covers p50/p95/max of both stages for 7 commands. */
+    static const size_t MAX_LATENCY_SENSORS         = 42U;
+
+    /** Maximum number of user action latency sensors, which covers p50/p95/max of every stage for both action types. */
+    static const size_t MAX_ACTION_LATENCY_SENSORS  = 30U;
+
+    /** Period in ms for publishing the latency sensors. */
+    static const uint32_t LATENCY_PUBLISH_PERIOD    = SIMPLE_TIMER_SECONDS(60U);
+
+    /** Maximum number of bus health sensors, which covers every metric once. */
+    static const size_t MAX_BUS_SENSORS             = 9U;
+
+    /** Period in ms for updating the bus traffic rates and publishing the bus health sensors. */
+    static const uint32_t BUS_HEALTH_PUBLISH_PERIOD = SIMPLE_TIMER_SECONDS(60U);
+
+    /** Period in ms for checking the maximum age of the entity values. */
+    static const uint32_t STALENESS_CHECK_PERIOD    = SIMPLE_TIMER_SECONDS(1U);
+
+    /** Maximum number of main loop cost sensors, which covers every metric once. */
+    static const size_t MAX_LOOP_SENSORS            = 6U;
+
+    /** Maximum number of delta sensors. */
+    static const size_t MAX_DELTA_SENSORS           = 4U;
+
+    /** Maximum number of derived metric sensors, which covers every metric once. */
+    static const size_t MAX_DERIVED_SENSORS         = 10U;
+
+    /** Period in ms for publishing the derived metric sensors. */
+    static const uint32_t DERIVED_PUBLISH_PERIOD    = SIMPLE_TIMER_SECONDS(60U);
+
+    /** Maximum number of aggregate sensors. */
+    static const size_t MAX_AGGREGATE_SENSORS       = 16U;
+
+    /** Period in ms for closing the elapsed aggregation windows. */
+    static const uint32_t AGGREGATION_CHECK_PERIOD  = SIMPLE_TIMER_SECONDS(1U);
+
+    /** Period in ms for closing the main loop cost window and publishing its sensors. */
+    static const uint32_t LOOP_COST_PUBLISH_PERIOD  = SIMPLE_TIMER_SECONDS(60U);
+
     /**
      * Duration in ms after the first time all kind of sensors are read.
      * After about 10s the webserver is up and running, as well as the MQTT client connected.
      */
     static const uint32_t SENSOR_READ_INITIAL       = SIMPLE_TIMER_SECONDS(10U);
 
-    /** Period in ms for reading sensors from heatpump. */
-    static const uint32_t SENSOR_READ_PERIOD        = SIMPLE_TIMER_MINUTES(2U);
-
-    /** Period in ms for reading binary sensors from heatpump. */
-    static const uint32_t BINARY_SENSOR_READ_PERIOD = SIMPLE_TIMER_SECONDS(30U);
+    /* The entity tables of the modules must cover exactly the entities, which are registered to them. */
+    static_assert(IVTRego6xxBusHealth::MAX_ENTITIES == (MAX_SENSORS + MAX_BINARY_SENSORS + MAX_TEXT_SENSORS + MAX_BUTTONS + MAX_NUMBERS),
+        "Bus health capacity doesn't match the number of entities.");
+    static_assert(IVTRego6xxStaleness::MAX_ENTITIES == (MAX_SENSORS + MAX_BINARY_SENSORS + MAX_TEXT_SENSORS + MAX_NUMBERS),
+        "Staleness capacity doesn't match the number of reading entities.");
+    static_assert(IVTRego6xxPollingProfiles::MAX_ENTITIES == (MAX_SENSORS + MAX_BINARY_SENSORS + MAX_TEXT_SENSORS + MAX_NUMBERS),
+        "Polling profiles capacity doesn't match the number of reading entities.");
+    static_assert(IVTRego6xxWarmStart::MAX_ENTITIES == (MAX_SENSORS + MAX_BINARY_SENSORS + MAX_NUMBERS),
+        "Warm start capacity doesn't match the number of sensors, binary sensors and numbers.");
+    static_assert(IVTRego6xxTelemetry::MAX_ENTITIES == (MAX_SENSORS + MAX_BINARY_SENSORS + MAX_NUMBERS),
+        "Telemetry capacity doesn't match the number of sensors, binary sensors and numbers.");
+    static_assert(IVTRego6xxHistory::MAX_SENSORS == MAX_SENSORS,
+        "History capacity doesn't match the number of sensors.");
+    static_assert(IVTRego6xxAggregation::MAX_SENSORS == MAX_SENSORS,
+        "Aggregation capacity doesn't match the number of sensors.");
+    static_assert(IVTRego6xxAdaptiveSampling::MAX_SENSORS == MAX_SENSORS,
+        "Adaptive sampling capacity doesn't match the number of sensors.");
+    static_assert(IVTRego6xxSamplingGroups::MAX_MEMBERS == MAX_SENSORS,
+        "Sampling group capacity doesn't match the number of sensors.");
 
-    /** Period in ms for reading text sensors from heatpump. */
-    static const uint32_t TEXT_SENSOR_READ_PERIOD   = SIMPLE_TIMER_SECONDS(30U);
+#ifdef IVT_REGO6XX_POLLING_BENCHMARK
+    IVTRego6xxPollingBenchmark m_pollingBenchmark; /**< Polling benchmark, which replaces the heatpump by the simulator. */
+#endif /* IVT_REGO6XX_POLLING_BENCHMARK */
 
-    /** Period in ms for reading numbers from heatpump. */
-    static const uint32_t NUMBER_READ_PERIOD        = SIMPLE_TIMER_SECONDS(60U);
+#ifdef IVT_REGO6XX_REPLAY
+    Rego6xxReplay              m_replay;           /**< Replay of a recorded trace, which replaces the heatpump. */
+    bool                       m_isReplayFinished; /**< Is the whole trace replayed? */
+#endif /* IVT_REGO6XX_REPLAY */
 
-    /** Pause between every request to the heatpump controller in ms. */
-    static const uint32_t    REGO6xx_REQ_PAUSE      = 100U;
+    StreamUartDevAdapter     m_adapter;        /**< Stream to UART device adapter. */
+    Rego6xxRecorder          m_recorder;       /**< UART traffic recorder, placed between adapter and controller. */
+    Rego6xxTraceBuffer       m_recording;      /**< UART traffic recording. */
+    size_t                   m_recorderSize;   /**< Size of the UART traffic recording buffer in byte. */
+    size_t                   m_frameTraceSize; /**< Size of the protocol frame ring in byte. */
+#ifdef USE_WEBSERVER
+    IVTRego6xxWebHandler     m_webHandler;     /**< Web handler for diagnostic downloads. */
+#endif /* USE_WEBSERVER */
+    Rego6xxCtrl              m_ctrl;        /**< IVT rego6xx controller. */
+    IVTRego6xxPollingPolicy  m_policy;      /**< Polling policy */
+    State                    m_state;       /**< State machine of the IVT rego6xx controller. */
+    SimpleTimer              m_pauseTimer;  /**< Timer used to pause between each heatpump request. This shall avoid problems with the Rego6xx controller. */
+    uint32_t                 m_pause;       /**< Duration of the current pause in ms. */
+    const Rego6xxStdRsp*     m_rego6xxRsp;  /**< Pending Rego6xx response, used to read sensors and binary sensors. */
+    const Rego6xxDisplayRsp* m_displayRsp;  /**< Pending Rego6xx display response, used to read text sensors. */
+    const Rego6xxConfirmRsp* m_confirmRsp;  /**< Pending Rego6xx confirmation response, used to write buttons. */
 
-    StreamUartDevAdapter     m_adapter;    /**< Stream to UART device adapter. */
-    Rego6xxCtrl              m_ctrl;       /**< IVT rego6xx controller. */
-    State                    m_state;      /**< State machine of the IVT rego6xx controller. */
-    SimpleTimer              m_pauseTimer; /**< Timer used to pause between each heatpump request. This shall avoid problems with the Rego6xx controller. */
-    const Rego6xxStdRsp*     m_rego6xxRsp; /**< Pending Rego6xx response, used to read sensors and binary sensors. */
-    const Rego6xxDisplayRsp* m_displayRsp; /**< Pending Rego6xx display response, used to read text sensors. */
-    const Rego6xxConfirmRsp* m_confirmRsp; /**< Pending Rego6xx confirmation response, used to write buttons. */
+    HighFrequencyLoopRequester m_highFrequencyLoop; /**< Requests the high frequency main loop, while a response is pending. */
 
     SimpleTimer              m_sensorTimer;          /**< Timer used to read cyclic all registered sensors values from the heatpump. */
     size_t                   m_sensorCount;          /**< Number of registered sensors. */
@@ -264,6 +875,290 @@ private:
     size_t                   m_currentNumberIndex;       /**< Index of the current number to read. */
     size_t                   m_currentNumberUpdateIndex; /**< Index of the current number to update. */
 
+    SimpleTimer              m_latencyTimer;                        /**< Timer used to publish the latency sensors cyclic. */
+    size_t                   m_latencySensorCount;                  /**< Number of registered latency sensors. */
+    IVTRego6xxLatencySensor* m_latencySensors[MAX_LATENCY_SENSORS]; /**< List of registered latency sensors. */
+
+    IVTRego6xxActionLatency        m_actionLatency;                                     /**< End-to-end latency of user actions. */
+    size_t                         m_actionLatencySensorCount;                          /**< Number of registered user action latency sensors. */
+    IVTRego6xxActionLatencySensor* m_actionLatencySensors[MAX_ACTION_LATENCY_SENSORS]; /**< List of registered user action latency sensors. */
+
+    IVTRego6xxBusHealth      m_busHealth;                   /**< Health of the bus to the heatpump. */
+    SimpleTimer              m_busHealthTimer;              /**< Timer used to update the bus traffic rates and publish the bus health sensors cyclic. */
+    size_t                   m_busSensorCount;              /**< Number of registered bus health sensors. */
+    IVTRego6xxBusSensor*     m_busSensors[MAX_BUS_SENSORS]; /**< List of registered bus health sensors. */
+
+    IVTRego6xxStaleness        m_staleness;       /**< Staleness of the entity values. */
+    SimpleTimer                m_stalenessTimer;  /**< Timer used to check the maximum age of the entity values cyclic. */
+    IVTRego6xxSlaBinarySensor* m_slaBinarySensor; /**< Registered service level binary sensor. */
+
+    IVTRego6xxLoopCost       m_loopCost;                      /**< CPU time, which the component takes from the main loop. */
+    SimpleTimer              m_loopCostTimer;                 /**< Timer used to close the main loop cost window and publish its sensors cyclic. */
+    size_t                   m_loopSensorCount;               /**< Number of registered main loop cost sensors. */
+    IVTRego6xxLoopSensor*    m_loopSensors[MAX_LOOP_SENSORS]; /**< List of registered main loop cost sensors. */
+
+    IVTRego6xxDeferredLog    m_deferredLog; /**< Deferred log of the request results. */
+
+    IVTRego6xxWarmStart      m_warmStart;             /**< Last-known entity values, which are restored after a reboot. */
+    SimpleTimer              m_warmStartTimer;        /**< Timer used to save the last-known entity values cyclic. */
+    uint32_t                 m_warmStartSaveInterval; /**< Interval in ms for saving the last-known entity values. 0 disables the warm start. */
+
+    IVTRego6xxPollingProfiles m_profiles; /**< Polling profiles, which are selected by the operating mode. */
+
+    IVTRego6xxDependencies   m_dependencies;  /**< Entities, which are refreshed if another entity changes. */
+    uint8_t                  m_refreshRounds; /**< Kinds of entities (bit per state), which are in a targeted round of dependent entities. */
+
+    IVTRego6xxAdaptiveSampling m_adaptiveSampling; /**< Read periods of the sensors, which follow the rate of change. */
+
+    IVTRego6xxSamplingGroups m_samplingGroups;                  /**< Groups of sensors, which are read back to back as one unit. */
+    size_t                   m_deltaSensorCount;                /**< Number of registered delta sensors. */
+    IVTRego6xxDeltaSensor*   m_deltaSensors[MAX_DELTA_SENSORS]; /**< List of registered delta sensors. */
+
+    IVTRego6xxDerivedMetrics m_derivedMetrics;                      /**< Metrics, which are derived from the read entity values. */
+    SimpleTimer              m_derivedMetricsTimer;                 /**< Timer used to publish the derived metric sensors cyclic. */
+    SimpleTimer              m_derivedMetricsSaveTimer;             /**< Timer used to save the totals of the derived metrics cyclic. */
+    uint32_t                 m_derivedMetricsSaveInterval;          /**< Interval in ms for saving the totals of the derived metrics. 0 disables saving. */
+    size_t                   m_derivedSensorCount;                  /**< Number of registered derived metric sensors. */
+    IVTRego6xxDerivedSensor* m_derivedSensors[MAX_DERIVED_SENSORS]; /**< List of registered derived metric sensors. */
+
+    IVTRego6xxAggregation      m_aggregation;                             /**< Windowed aggregation of the sensor values. */
+    SimpleTimer                m_aggregationTimer;                        /**< Timer used to close the elapsed aggregation windows cyclic. */
+    size_t                     m_aggregateSensorCount;                    /**< Number of registered aggregate sensors. */
+    IVTRego6xxAggregateSensor* m_aggregateSensors[MAX_AGGREGATE_SENSORS]; /**< List of registered aggregate sensors. */
+
+    IVTRego6xxHistory        m_history;                       /**< Compressed history of the read sensor values. */
+
+    IVTRego6xxOutbox         m_outbox;                        /**< Published values, which are buffered during a MQTT outage. */
+    size_t                   m_outboxSize;                    /**< Maximum number of buffered values. 0 disables the outbox. */
+    uint32_t                 m_outboxReplayInterval;          /**< Interval in ms between two replayed values. */
+    SimpleTimer              m_outboxReplayTimer;             /**< Timer used to limit the replay rate. */
+#ifdef USE_TIME
+    time::RealTimeClock*     m_outboxTime;                    /**< Time source for the original timestamp of the replayed values. */
+#endif /* USE_TIME */
+
+    IVTRego6xxTelemetry      m_telemetry;                     /**< Entity values, which are combined to telemetry frames. */
+    uint32_t                 m_telemetryInterval;             /**< Interval in ms between two telemetry frames. 0 disables the telemetry. */
+    SimpleTimer              m_telemetryTimer;                /**< Timer used to publish the telemetry frames cyclic. */
+    bool                     m_isTelemetryBinary;             /**< Are the telemetry frames published in the binary format? */
+
+#ifdef IVT_REGO6XX_MODBUS
+    IVTRego6xxModbusServer   m_modbusServer;                  /**< Modbus TCP server, which serves the cached entity values. */
+#endif /* IVT_REGO6XX_MODBUS */
+
+    bool                     m_isBurstEnabled;                /**< Is the startup burst enabled? */
+    uint32_t                 m_burstInitialDelay;             /**< Delay in ms until the startup burst starts. */
+    uint32_t                 m_burstRequestPause;             /**< Pause between every request of the startup burst in ms. */
+    State                    m_burstOrder[BURST_KIND_COUNT];  /**< Order of the kinds of entities (their states) in the startup burst. */
+    size_t                   m_burstOrderCount;               /**< Number of kinds of entities in the startup burst order. */
+    size_t                   m_burstOrderIndex;               /**< Index of the current kind of entities in the startup burst order. */
+    uint8_t                  m_burstRounds;                   /**< Kinds of entities (bit per state), whose first refresh of the startup burst is pending. */
+    uint32_t                 m_pollingStart;                  /**< Time in ms, when the polling started. */
+    uint32_t                 m_snapshotDuration;              /**< Time in ms from the start of the polling until the initial snapshot was complete. */
+
+#ifdef IVT_REGO6XX_BENCHMARK
+    IVTRego6xxBenchmark      m_benchmark;           /**< Microbenchmarks, which run once after startup. */
+    bool                     m_isBenchmarkFinished; /**< Are all microbenchmarks finished? */
+#endif /* IVT_REGO6XX_BENCHMARK */
+
+    /**
+     * Start polling from the beginning, i.e. all kind of entities are read
+     * the first time after the initial delay.
+     */
+    void startPolling();
+
+    /**
+     * Process the communication with the heatpump.
+     */
+    void processPolling();
+
+    /**
+     * Process the periodic tasks, e.g. publishing the diagnostics, saving the
+     * values and replaying the outbox.
+     */
+    void processPeriodicTasks();
+
+    /**
+     * Publish the latency sensors.
+     */
+    void publishLatencies();
+
+    /**
+     * Update the bus traffic rates and publish the bus health sensors.
+     */
+    void publishBusHealth();
+
+    /**
+     * Close the main loop cost window and publish the main loop cost sensors.
+     */
+    void publishLoopCost();
+
+    /**
+     * Publish the derived metric sensors.
+     */
+    void publishDerivedMetrics();
+
+    /**
+     * Close the elapsed aggregation windows and publish their aggregate sensors.
+     */
+    void publishAggregates();
+
+    /**
+     * Buffer a published entity value in the outbox, if the MQTT broker is
+     * not reachable.
+     *
+     * @param[in] entity    Entity
+     * @param[in] value     Published value
+     */
+    void bufferState(const EntityBase* entity, float value);
+
+    /**
+     * Replay the oldest buffered value, if the MQTT broker is reachable again.
+     */
+    void replayOutbox();
+
+    /**
+     * Publish the changed entity values as telemetry frame, if the MQTT
+     * broker is reachable. Otherwise the changes are kept for the next frame.
+     */
+    void publishTelemetry();
+
+    /**
+     * Get the baud rate of the UART to the heatpump.
+     *
+     * @return Baud rate or 0 if unknown.
+     */
+    uint32_t getBaudRate() const;
+
+    /**
+     * Start the pause after a request to the heatpump.
+     */
+    void startPause();
+
+    /**
+     * Get the timer, which triggers reading a kind of entities.
+     *
+     * @param[in] state State, which handles the kind of entities.
+     *
+     * @return Timer or nullptr, if the state reads no entities.
+     */
+    SimpleTimer* getReadTimer(State state);
+
+    /**
+     * Get the number of registered entities of a kind.
+     *
+     * @param[in] state State, which handles the kind of entities.
+     *
+     * @return Number of entities
+     */
+    size_t getEntityCount(State state) const;
+
+    /**
+     * Start the next round of the startup burst, which is the next kind of
+     * entities in the burst order. After the last round, the initial
+     * snapshot is complete and the kinds outside the burst order start.
+     *
+     * @param[in] delay Delay in ms until the round starts.
+     */
+    void startBurstRound(uint32_t delay);
+
+    /**
+     * Complete the round of a kind of entities. This completes a targeted
+     * round and the first refresh of the kind in the startup burst.
+     *
+     * @param[in] state State, which handles the kind of entities.
+     */
+    void completeRound(State state);
+
+    /**
+     * Adapt the read period of a sensor to its new value. A moving sensor
+     * may shorten the round period of the sensors.
+     *
+     * @param[in] sensor    Read sensor
+     * @param[in] value     Read value
+     */
+    void adaptSampling(const IVTRego6xxSensor* sensor, float value);
+
+    /**
+     * Set the kinds of the dependent entities, which are known after all
+     * entities are registered.
+     */
+    void resolveDependencies();
+
+    /**
+     * Start a targeted round of a kind of entities, if dependent entities of
+     * this kind are pending. If the next regular round starts before their
+     * deadline, it refreshes them instead.
+     *
+     * @param[in] state State, which handles the kind of entities.
+     *
+     * @return If a targeted round started, it will return true otherwise false.
+     */
+    bool startRefreshRound(State state);
+
+    /**
+     * Is a kind of entities in a targeted round of dependent entities?
+     *
+     * @param[in] state State, which handles the kind of entities.
+     *
+     * @return If in a targeted round, it will return true otherwise false.
+     */
+    bool isRefreshRound(State state) const
+    {
+        return (0U != (m_refreshRounds & static_cast<uint8_t>(1U << state)));
+    }
+
+    /**
+     * Shall an entity be read in the current round of its kind? A targeted
+     * round reads only the pending dependent entities, a regular round the
+     * due ones of the active polling profile and the pending dependent ones.
+     * If a member of a sampling group shall be read, all members are read.
+     *
+     * @param[in] state         State, which handles the kind of entities.
+     * @param[in] entity        Entity
+     * @param[in] kindPeriod    Period in ms of its kind from the polling policy.
+     *
+     * @return If the entity shall be read, it will return true otherwise false.
+     */
+    bool isReadDue(State state, const EntityBase* entity, uint32_t kindPeriod) const;
+
+    /**
+     * Shall an entity be read in the current round of its kind, without
+     * considering its sampling group?
+     *
+     * @param[in] state         State, which handles the kind of entities.
+     * @param[in] entity        Entity
+     * @param[in] kindPeriod    Period in ms of its kind from the polling policy.
+     *
+     * @return If the entity shall be read, it will return true otherwise false.
+     */
+    bool isEntityDue(State state, const EntityBase* entity, uint32_t kindPeriod) const;
+
+    /**
+     * Reorder the sensors, so the members of a sampling group follow each
+     * other in the order of the first member.
+     */
+    void groupSensors();
+
+    /**
+     * Publish the delta sensors, whose sensors are members of a sampling
+     * group, which completed its pass.
+     *
+     * @param[in] group Group index
+     */
+    void publishDeltas(size_t group);
+
+    /**
+     * Apply the round periods of the activated polling profile. A kind of
+     * entities, whose next round is later than its new round period, starts
+     * its round at once.
+     */
+    void applyPollingProfile();
+
+    /**
+     * Restore the last-known entity values and publish them.
+     */
+    void restoreValues();
+
     /**
      * Get the pending state.
      *
@@ -352,7 +1247,15 @@ private:
      * @param[in] input The string to convert.
      * @param[out] output The converted string.
      */
-    void iso8859_1_to_utf8(const char* input, std::string& output);
+    static void iso8859_1_to_utf8(const char* input, std::string& output);
+
+#ifdef IVT_REGO6XX_BENCHMARK
+    friend IVTRego6xxBenchmark;
+#endif /* IVT_REGO6XX_BENCHMARK */
+
+#ifdef IVT_REGO6XX_POLLING_BENCHMARK
+    friend IVTRego6xxPollingBenchmark;
+#endif /* IVT_REGO6XX_POLLING_BENCHMARK */
 };
 
 } /* namespace ivt_rego6xx_ctrl */
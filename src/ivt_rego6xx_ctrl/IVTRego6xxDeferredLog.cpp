@@ -0,0 +1,180 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Deferred log of the request results
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IVTRego6xxDeferredLog.h"
+#include <stdio.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+namespace esphome
+{
+namespace ivt_rego6xx_ctrl
+{
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Text of the request results in the export. */
+static const char* EVENT_TEXTS[IVTRego6xxDeferredLog::EVENT_COUNT] = {
+    "request failed",
+    "response timeout",
+    "response invalid",
+    "response has wrong destination",
+    "successful"
+};
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+uint32_t IVTRego6xxDeferredLog::getFirstSeq() const
+{
+    uint32_t firstSeq = 0U;
+
+#ifdef IVT_REGO6XX_DEFERRED_LOG_SIZE
+    uint32_t written  = m_written;
+
+    /* The slot of the oldest record is overwritten by the next added record. */
+    if (IVT_REGO6XX_DEFERRED_LOG_SIZE <= written)
+    {
+        firstSeq = written - IVT_REGO6XX_DEFERRED_LOG_SIZE + 1U;
+    }
+#endif /* IVT_REGO6XX_DEFERRED_LOG_SIZE */
+
+    return firstSeq;
+}
+
+bool IVTRego6xxDeferredLog::getRecord(uint32_t seq, Record& record) const
+{
+    bool isAvailable = false;
+
+#ifdef IVT_REGO6XX_DEFERRED_LOG_SIZE
+    if ((seq < m_written) && (seq >= getFirstSeq()))
+    {
+        record = m_records[seq % IVT_REGO6XX_DEFERRED_LOG_SIZE];
+
+        /* The writer may have overwritten the record during the copy. */
+        if ((seq + IVT_REGO6XX_DEFERRED_LOG_SIZE) > m_written)
+        {
+            isAvailable = true;
+        }
+    }
+#else  /* IVT_REGO6XX_DEFERRED_LOG_SIZE */
+    (void)seq;
+    (void)record;
+#endif /* IVT_REGO6XX_DEFERRED_LOG_SIZE */
+
+    return isAvailable;
+}
+
+size_t IVTRego6xxDeferredLog::exportText(char* buffer, size_t size, uint32_t& seq) const
+{
+    size_t written = 0U;
+    bool   isFull  = false;
+
+    while ((false == isFull) && (seq < m_written))
+    {
+        Record record;
+
+        /* Skip the records, which were overwritten meanwhile. */
+        if (seq < getFirstSeq())
+        {
+            seq = getFirstSeq();
+        }
+        else if (true == getRecord(seq, record))
+        {
+            size_t      available = size - written;
+            const char* name      = (nullptr != record.entity) ? record.entity->get_name().c_str() : "";
+            const char* text      = (EVENT_COUNT > record.event) ? EVENT_TEXTS[record.event] : "unknown";
+            int         len       = snprintf(&buffer[written], available, "%10u ms '%.40s' 0x%02X (cmd id) at 0x%04X: %s (0x%06X)\n",
+                                        static_cast<unsigned int>(record.timestamp),
+                                        name,
+                                        static_cast<unsigned int>(record.cmdId),
+                                        static_cast<unsigned int>(record.addr),
+                                        text,
+                                        static_cast<unsigned int>(record.value));
+
+            if ((0 > len) || (static_cast<size_t>(len) >= available))
+            {
+                isFull = true;
+            }
+            else
+            {
+                written += static_cast<size_t>(len);
+                ++seq;
+            }
+        }
+        else
+        {
+            /* The record was overwritten during the copy, the next loop skips it. */
+            ;
+        }
+    }
+
+    return written;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
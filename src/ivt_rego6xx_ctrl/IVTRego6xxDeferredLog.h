@@ -0,0 +1,233 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Deferred log of the request results
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <Arduino.h>
+#include "esphome/core/defines.h"
+#include "esphome/core/component.h"
+#include "SimpleTimer.hpp"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * Deferred log, which keeps the results of the latest requests as binary
+ * records with fixed fields in a RAM ring buffer. A record is added without
+ * any formatting or name lookup. It is formatted to text only when the log
+ * is exported, e.g. by the web server task while logging continues.
+ *
+ * The ring buffer exists only if IVT_REGO6XX_DEFERRED_LOG_SIZE is defined
+ * with the number of records, otherwise adding a record costs nothing.
+ */
+class IVTRego6xxDeferredLog
+{
+public:
+
+    /**
+     * Request result.
+     */
+    enum Event : uint8_t
+    {
+        EVENT_REQUEST_FAILED = 0U,  /**< Request couldn't be sent. */
+        EVENT_TIMEOUT,              /**< Response timeout */
+        EVENT_INVALID,              /**< Response invalid */
+        EVENT_WRONG_DESTINATION,    /**< Response has wrong destination. */
+        EVENT_SUCCESSFUL,           /**< Request successful */
+        EVENT_COUNT                 /**< Number of events */
+    };
+
+    /**
+     * A single log record.
+     */
+    struct Record
+    {
+        uint32_t          timestamp; /**< Timestamp in ms */
+        const EntityBase* entity;    /**< Entity, which requested. */
+        uint32_t          value;     /**< Read or written raw value */
+        uint16_t          addr;      /**< Register address */
+        uint8_t           cmdId;     /**< Command id */
+        uint8_t           event;     /**< Request result */
+    };
+
+    /**
+     * Constructs the deferred log.
+     */
+    IVTRego6xxDeferredLog() :
+#ifdef IVT_REGO6XX_DEFERRED_LOG_SIZE
+        m_records(),
+#endif /* IVT_REGO6XX_DEFERRED_LOG_SIZE */
+        m_written(0U)
+    {
+    }
+
+    /**
+     * Destroys the deferred log.
+     */
+    ~IVTRego6xxDeferredLog()
+    {
+    }
+
+    /**
+     * Is the deferred log enabled?
+     *
+     * @return If enabled, it will return true otherwise false.
+     */
+    static constexpr bool isEnabled()
+    {
+#ifdef IVT_REGO6XX_DEFERRED_LOG_SIZE
+        return true;
+#else  /* IVT_REGO6XX_DEFERRED_LOG_SIZE */
+        return false;
+#endif /* IVT_REGO6XX_DEFERRED_LOG_SIZE */
+    }
+
+    /**
+     * Add a record. The oldest record is overwritten, if the ring buffer is full.
+     *
+     * @param[in] event     Request result
+     * @param[in] entity    Entity, which requested.
+     * @param[in] cmdId     Command id
+     * @param[in] addr      Register address
+     * @param[in] value     Read or written raw value
+     */
+    void add(Event event, const EntityBase* entity, uint8_t cmdId, uint16_t addr, uint32_t value)
+    {
+#ifdef IVT_REGO6XX_DEFERRED_LOG_SIZE
+        uint32_t seq    = m_written;
+        Record&  record = m_records[seq % IVT_REGO6XX_DEFERRED_LOG_SIZE];
+
+        record.timestamp = SimpleTimer::now();
+        record.entity    = entity;
+        record.value     = value;
+        record.addr      = addr;
+        record.cmdId     = cmdId;
+        record.event     = event;
+
+        /* The record becomes visible to a reader not before it is complete. */
+        m_written        = seq + 1U;
+#else  /* IVT_REGO6XX_DEFERRED_LOG_SIZE */
+        (void)event;
+        (void)entity;
+        (void)cmdId;
+        (void)addr;
+        (void)value;
+#endif /* IVT_REGO6XX_DEFERRED_LOG_SIZE */
+    }
+
+    /**
+     * Get the number of records, which were added since the start.
+     *
+     * @return Number of records
+     */
+    uint32_t getWritten() const
+    {
+        return m_written;
+    }
+
+    /**
+     * Get the sequence number of the oldest record, which can be read.
+     *
+     * @return Sequence number of the oldest record
+     */
+    uint32_t getFirstSeq() const;
+
+    /**
+     * Get a copy of a record by its sequence number.
+     *
+     * @param[in]  seq      Sequence number
+     * @param[out] record   Record
+     *
+     * @return If the record is available, it will return true otherwise false.
+     */
+    bool getRecord(uint32_t seq, Record& record) const;
+
+    /**
+     * Export the next records as text lines, starting with the given
+     * sequence number. Only whole lines are written, therefore the buffer
+     * shall provide at least EXPORT_MIN_SIZE bytes. Records, which are
+     * overwritten meanwhile, are skipped.
+     *
+     * @param[out]    buffer    Buffer, which to fill
+     * @param[in]     size      Buffer size in byte
+     * @param[in,out] seq       Sequence number of the next record
+     *
+     * @return Number of written bytes. If all records are exported, it will return 0.
+     */
+    size_t exportText(char* buffer, size_t size, uint32_t& seq) const;
+
+    /** Minimum buffer size for a piece of the export in byte. */
+    static const size_t EXPORT_MIN_SIZE = 128U;
+
+private:
+
+#ifdef IVT_REGO6XX_DEFERRED_LOG_SIZE
+    Record            m_records[IVT_REGO6XX_DEFERRED_LOG_SIZE]; /**< Ring buffer */
+#endif /* IVT_REGO6XX_DEFERRED_LOG_SIZE */
+    volatile uint32_t m_written;                                /**< Number of added records */
+
+    IVTRego6xxDeferredLog(const IVTRego6xxDeferredLog& other);
+    IVTRego6xxDeferredLog& operator=(const IVTRego6xxDeferredLog& other);
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
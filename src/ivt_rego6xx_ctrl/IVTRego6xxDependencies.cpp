@@ -0,0 +1,333 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Event-triggered refreshes of dependent entities
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IVTRego6xxDependencies.h"
+#include "SimpleTimer.hpp"
+#include "esphome/core/log.h"
+#include <stdio.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+namespace esphome
+{
+namespace ivt_rego6xx_ctrl
+{
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/**
+ * Logger tag of this component.
+ */
+static const char* TAG = "ivt_rego6xx_ctrl.dependencies";
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool IVTRego6xxDependencies::addDependency(const EntityBase* trigger, const EntityBase* target, uint32_t within)
+{
+    bool isSuccessful = false;
+
+    if ((nullptr != trigger) &&
+        (nullptr != target) &&
+        (trigger != target) &&
+        (MAX_DEPENDENCIES > m_dependencyCount))
+    {
+        size_t triggerIdx = provideTrigger(trigger);
+        size_t targetIdx  = provideTarget(target);
+
+        if ((MAX_TRIGGERS > triggerIdx) &&
+            (MAX_TARGETS > targetIdx))
+        {
+            Dependency& dependency = m_dependencies[m_dependencyCount];
+
+            dependency.triggerIdx = static_cast<uint8_t>(triggerIdx);
+            dependency.targetIdx  = static_cast<uint8_t>(targetIdx);
+            dependency.within     = within;
+
+            ++m_dependencyCount;
+            isSuccessful = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+void IVTRego6xxDependencies::setKind(const EntityBase* entity, IVTRego6xxPollingProfiles::Kind kind)
+{
+    size_t idx = findTarget(entity);
+
+    if (MAX_TARGETS > idx)
+    {
+        m_targets[idx].kind = kind;
+    }
+}
+
+bool IVTRego6xxDependencies::update(const EntityBase* entity, uint32_t value)
+{
+    bool   isTriggered = false;
+    size_t triggerIdx  = 0U;
+
+    while ((triggerIdx < m_triggerCount) && (entity != m_triggers[triggerIdx].entity))
+    {
+        ++triggerIdx;
+    }
+
+    if (triggerIdx < m_triggerCount)
+    {
+        Trigger& trigger = m_triggers[triggerIdx];
+
+        if ((true == trigger.isValid) &&
+            (value != trigger.value))
+        {
+            uint32_t now = SimpleTimer::now();
+            size_t   idx = 0U;
+
+            ESP_LOGD(TAG, "'%s' changed, refresh its dependent entities.", entity->get_name().c_str());
+
+            for (idx = 0U; idx < m_dependencyCount; ++idx)
+            {
+                if (triggerIdx == m_dependencies[idx].triggerIdx)
+                {
+                    Target&  target   = m_targets[m_dependencies[idx].targetIdx];
+                    uint32_t deadline = now + m_dependencies[idx].within;
+
+                    if (false == target.isPending)
+                    {
+                        target.isPending = true;
+                        target.deadline  = deadline;
+                    }
+                    else
+                    {
+                        /* The pending refresh serves this trigger too, only its deadline may be earlier. */
+                        if (0 > static_cast<int32_t>(deadline - target.deadline))
+                        {
+                            target.deadline = deadline;
+                        }
+
+                        ++m_coalesced;
+                    }
+                }
+            }
+
+            ++m_changes;
+            isTriggered = true;
+        }
+
+        trigger.value   = value;
+        trigger.isValid = true;
+    }
+
+    return isTriggered;
+}
+
+bool IVTRego6xxDependencies::isPending(const EntityBase* entity) const
+{
+    size_t idx = findTarget(entity);
+
+    return (MAX_TARGETS > idx) ? m_targets[idx].isPending : false;
+}
+
+bool IVTRego6xxDependencies::getTimeLeft(IVTRego6xxPollingProfiles::Kind kind, uint32_t& timeLeft) const
+{
+    bool     isPending = false;
+    uint32_t now       = SimpleTimer::now();
+    size_t   idx       = 0U;
+
+    timeLeft = UINT32_MAX;
+
+    for (idx = 0U; idx < m_targetCount; ++idx)
+    {
+        const Target& target = m_targets[idx];
+
+        if ((true == target.isPending) &&
+            (kind == target.kind))
+        {
+            int32_t  diff = static_cast<int32_t>(target.deadline - now);
+            uint32_t left = (0 > diff) ? 0U : static_cast<uint32_t>(diff);
+
+            if (timeLeft > left)
+            {
+                timeLeft = left;
+            }
+
+            isPending = true;
+        }
+    }
+
+    if (false == isPending)
+    {
+        timeLeft = 0U;
+    }
+
+    return isPending;
+}
+
+void IVTRego6xxDependencies::markRead(const EntityBase* entity)
+{
+    size_t idx = findTarget(entity);
+
+    if ((MAX_TARGETS > idx) &&
+        (true == m_targets[idx].isPending))
+    {
+        Target& target = m_targets[idx];
+
+        if (0 < static_cast<int32_t>(SimpleTimer::now() - target.deadline))
+        {
+            ++m_late;
+        }
+
+        target.isPending = false;
+        ++m_refreshes;
+    }
+}
+
+void IVTRego6xxDependencies::writeMetrics(std::string& out) const
+{
+    char line[80];
+
+    out += "# TYPE ivt_rego6xx_dependency_changes_total counter\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_dependency_changes_total %u\n", static_cast<unsigned int>(m_changes));
+    out += line;
+
+    out += "# TYPE ivt_rego6xx_dependency_refreshes_total counter\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_dependency_refreshes_total %u\n", static_cast<unsigned int>(m_refreshes));
+    out += line;
+
+    out += "# TYPE ivt_rego6xx_dependency_coalesced_total counter\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_dependency_coalesced_total %u\n", static_cast<unsigned int>(m_coalesced));
+    out += line;
+
+    out += "# TYPE ivt_rego6xx_dependency_late_total counter\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_dependency_late_total %u\n", static_cast<unsigned int>(m_late));
+    out += line;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+size_t IVTRego6xxDependencies::provideTrigger(const EntityBase* entity)
+{
+    size_t idx = 0U;
+
+    while ((idx < m_triggerCount) && (entity != m_triggers[idx].entity))
+    {
+        ++idx;
+    }
+
+    if (idx == m_triggerCount)
+    {
+        if (MAX_TRIGGERS > m_triggerCount)
+        {
+            m_triggers[idx].entity  = entity;
+            m_triggers[idx].value   = 0U;
+            m_triggers[idx].isValid = false;
+
+            ++m_triggerCount;
+        }
+        else
+        {
+            idx = MAX_TRIGGERS;
+        }
+    }
+
+    return idx;
+}
+
+size_t IVTRego6xxDependencies::provideTarget(const EntityBase* entity)
+{
+    size_t idx = findTarget(entity);
+
+    if (MAX_TARGETS == idx)
+    {
+        if (MAX_TARGETS > m_targetCount)
+        {
+            idx = m_targetCount;
+
+            /* The kind is set, when the entity is registered. */
+            m_targets[idx].entity    = entity;
+            m_targets[idx].kind      = IVTRego6xxPollingProfiles::KIND_COUNT;
+            m_targets[idx].isPending = false;
+            m_targets[idx].deadline  = 0U;
+
+            ++m_targetCount;
+        }
+    }
+
+    return idx;
+}
+
+size_t IVTRego6xxDependencies::findTarget(const EntityBase* entity) const
+{
+    size_t idx = 0U;
+
+    while ((idx < m_targetCount) && (entity != m_targets[idx].entity))
+    {
+        ++idx;
+    }
+
+    return (idx < m_targetCount) ? idx : MAX_TARGETS;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
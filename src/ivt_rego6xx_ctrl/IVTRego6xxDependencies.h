@@ -0,0 +1,274 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Event-triggered refreshes of dependent entities
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <stdint.h>
+#include "esphome/core/component.h"
+#include "IVTRego6xxPollingProfiles.h"
+#include <string>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * Dependency graph between entities: if the value of a trigger entity
+ * changes, its target entities shall be read within a given time.
+ *
+ * A change marks the targets as pending with the earliest deadline of all
+ * triggers. A pending target is read only once, no matter how many triggers
+ * changed meanwhile, and a regular read of a target refreshes it as well.
+ * The polling engine serves the pending targets of a kind by a targeted
+ * round, which reads only them.
+ */
+class IVTRego6xxDependencies
+{
+public:
+
+    /** Maximum number of dependencies (edges in the graph). */
+    static const size_t MAX_DEPENDENCIES = 32U;
+
+    /** Maximum number of trigger entities. */
+    static const size_t MAX_TRIGGERS = 8U;
+
+    /** Maximum number of target entities. */
+    static const size_t MAX_TARGETS = 16U;
+
+    /**
+     * Constructs the dependencies.
+     */
+    IVTRego6xxDependencies() :
+        m_dependencyCount(0U),
+        m_dependencies(),
+        m_triggerCount(0U),
+        m_triggers(),
+        m_targetCount(0U),
+        m_targets(),
+        m_changes(0U),
+        m_refreshes(0U),
+        m_coalesced(0U),
+        m_late(0U)
+    {
+    }
+
+    /**
+     * Destroys the dependencies.
+     */
+    ~IVTRego6xxDependencies()
+    {
+    }
+
+    /**
+     * Add a dependency.
+     *
+     * @param[in] trigger   Entity, which value change triggers the refresh.
+     * @param[in] target    Entity, which shall be refreshed.
+     * @param[in] within    Time in ms, the target shall be read after the change.
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addDependency(const EntityBase* trigger, const EntityBase* target, uint32_t within);
+
+    /**
+     * Get the number of dependencies.
+     *
+     * @return Number of dependencies
+     */
+    size_t getCount() const
+    {
+        return m_dependencyCount;
+    }
+
+    /**
+     * Set the kind of a target entity. The kind is unknown when the
+     * dependency is added, because the entities are registered later.
+     * Entities, which are no target, are ignored.
+     *
+     * @param[in] entity    Entity
+     * @param[in] kind      Kind of entity
+     */
+    void setKind(const EntityBase* entity, IVTRego6xxPollingProfiles::Kind kind);
+
+    /**
+     * Update the value of a read entity. If the entity is a trigger and its
+     * value changed, its targets become pending. The first value after the
+     * start triggers nothing.
+     *
+     * @param[in] entity    Entity
+     * @param[in] value     Read raw value
+     *
+     * @return If targets became pending, it will return true otherwise false.
+     */
+    bool update(const EntityBase* entity, uint32_t value);
+
+    /**
+     * Is a target entity pending for a refresh?
+     *
+     * @param[in] entity    Entity
+     *
+     * @return If pending, it will return true otherwise false.
+     */
+    bool isPending(const EntityBase* entity) const;
+
+    /**
+     * Get the time until the earliest deadline of the pending targets of a kind.
+     *
+     * @param[in] kind          Kind of entity
+     * @param[out] timeLeft     Time in ms until the earliest deadline, 0 if already missed.
+     *
+     * @return If a target of this kind is pending, it will return true otherwise false.
+     */
+    bool getTimeLeft(IVTRego6xxPollingProfiles::Kind kind, uint32_t& timeLeft) const;
+
+    /**
+     * Mark an entity as read, independent of the result. A pending target
+     * is refreshed by it.
+     *
+     * @param[in] entity    Entity
+     */
+    void markRead(const EntityBase* entity);
+
+    /**
+     * Append the number of triggering changes, refreshes, coalesced triggers
+     * and late refreshes in the Prometheus text format.
+     *
+     * @param[out] out  Output
+     */
+    void writeMetrics(std::string& out) const;
+
+private:
+
+    /**
+     * Trigger entity with its last value.
+     */
+    struct Trigger
+    {
+        const EntityBase* entity;   /**< Entity */
+        uint32_t          value;    /**< Last read raw value */
+        bool              isValid;  /**< Is the last value valid? */
+    };
+
+    /**
+     * Target entity with its pending refresh.
+     */
+    struct Target
+    {
+        const EntityBase*               entity;     /**< Entity */
+        IVTRego6xxPollingProfiles::Kind kind;       /**< Kind of entity */
+        bool                            isPending;  /**< Is a refresh pending? */
+        uint32_t                        deadline;   /**< Timestamp in ms, until the pending refresh shall be read. */
+    };
+
+    /**
+     * Dependency between a trigger and a target.
+     */
+    struct Dependency
+    {
+        uint8_t  triggerIdx;    /**< Index of the trigger */
+        uint8_t  targetIdx;     /**< Index of the target */
+        uint32_t within;        /**< Time in ms, the target shall be read after the change. */
+    };
+
+    size_t     m_dependencyCount;                   /**< Number of dependencies */
+    Dependency m_dependencies[MAX_DEPENDENCIES];    /**< Dependencies */
+    size_t     m_triggerCount;                      /**< Number of triggers */
+    Trigger    m_triggers[MAX_TRIGGERS];            /**< Triggers */
+    size_t     m_targetCount;                       /**< Number of targets */
+    Target     m_targets[MAX_TARGETS];              /**< Targets */
+    uint32_t   m_changes;                           /**< Number of triggering value changes */
+    uint32_t   m_refreshes;                         /**< Number of refreshed pending targets */
+    uint32_t   m_coalesced;                         /**< Number of triggers for already pending targets */
+    uint32_t   m_late;                              /**< Number of refreshes after their deadline */
+
+    IVTRego6xxDependencies(const IVTRego6xxDependencies& other);
+    IVTRego6xxDependencies& operator=(const IVTRego6xxDependencies& other);
+
+    /**
+     * Find a trigger or add it, if not found.
+     *
+     * @param[in] entity    Entity
+     *
+     * @return Index of the trigger or MAX_TRIGGERS if full.
+     */
+    size_t provideTrigger(const EntityBase* entity);
+
+    /**
+     * Find a target or add it, if not found.
+     *
+     * @param[in] entity    Entity
+     *
+     * @return Index of the target or MAX_TARGETS if full.
+     */
+    size_t provideTarget(const EntityBase* entity);
+
+    /**
+     * Find a target.
+     *
+     * @param[in] entity    Entity
+     *
+     * @return Index of the target or MAX_TARGETS if not found.
+     */
+    size_t findTarget(const EntityBase* entity) const;
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
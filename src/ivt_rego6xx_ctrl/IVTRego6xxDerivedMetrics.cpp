@@ -0,0 +1,499 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  IVT rego6xx controller derived metrics
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IVTRego6xxDerivedMetrics.h"
+#include "SimpleTimer.hpp"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+#include <stdio.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+namespace esphome
+{
+namespace ivt_rego6xx_ctrl
+{
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/**
+ * Logger tag of this component.
+ */
+static const char* TAG = "ivt_rego6xx_ctrl.derived_metrics";
+
+/** Names of the metrics, used as label value. */
+static const char* METRIC_NAMES[IVTRego6xxDerivedMetrics::METRIC_COUNT] = {
+    "compressor_duty_cycle",
+    "compressor_starts_per_hour",
+    "compressor_starts",
+    "compressor_on_time",
+    "add_heat_3kw_on_time",
+    "add_heat_6kw_on_time",
+    "add_heat_energy",
+    "hot_water_cycle_duration",
+    "hot_water_cycles",
+    "heat_curve_deviation"
+};
+
+/** Number of ms per hour. */
+static const float MS_PER_HOUR = 3600000.0F;
+
+/** Number of ms per minute. */
+static const float MS_PER_MINUTE = 60000.0F;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool IVTRego6xxDerivedMetrics::setInput(Input input, const EntityBase* entity)
+{
+    bool isSuccessful = false;
+
+    if ((INPUT_COUNT > input) &&
+        (nullptr != entity) &&
+        (nullptr == m_inputs[input].entity))
+    {
+        InputValue& inputValue = m_inputs[input];
+
+        inputValue.entity    = entity;
+        inputValue.value     = 0.0F;
+        inputValue.timestamp = 0U;
+        inputValue.isValid   = false;
+
+        ++m_inputCount;
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+bool IVTRego6xxDerivedMetrics::load()
+{
+    bool   isRestored = false;
+    Totals totals;
+
+    m_pref = global_preferences->make_preference<Totals>(fnv1_hash("ivt_rego6xx_derived_metrics"));
+
+    if ((true == m_pref.load(&totals)) &&
+        (VERSION == totals.version))
+    {
+        m_totals   = totals;
+        isRestored = true;
+
+        ESP_LOGI(TAG, "Restored totals of %u compressor starts and %u hot water cycles.",
+            static_cast<unsigned int>(m_totals.compressorStarts),
+            static_cast<unsigned int>(m_totals.hotWaterCycles));
+    }
+    else
+    {
+        memset(&m_totals, 0, sizeof(m_totals));
+        m_totals.version = VERSION;
+
+        ESP_LOGI(TAG, "No totals to restore.");
+    }
+
+    return isRestored;
+}
+
+void IVTRego6xxDerivedMetrics::update(const EntityBase* entity, float value)
+{
+    uint32_t now        = SimpleTimer::now();
+    bool     isUpdated  = false;
+    bool     isCurveHit = false;
+    size_t   idx        = 0U;
+
+    /* An entity may feed several inputs. */
+    for (idx = 0U; idx < INPUT_COUNT; ++idx)
+    {
+        if ((nullptr != entity) &&
+            (entity == m_inputs[idx].entity))
+        {
+            if (false == isUpdated)
+            {
+                advanceWindow(now);
+                isUpdated = true;
+            }
+
+            updateInput(static_cast<Input>(idx), value, now);
+
+            if ((INPUT_HEAT_CURVE_ACTUAL == idx) ||
+                (INPUT_HEAT_CURVE_TARGET == idx))
+            {
+                isCurveHit = true;
+            }
+        }
+    }
+
+    if (true == isCurveHit)
+    {
+        updateDeviation(now);
+    }
+}
+
+bool IVTRego6xxDerivedMetrics::getMetric(Metric metric, float& value) const
+{
+    bool     isAvailable    = true;
+    uint32_t compressorOn   = 0U;
+    uint32_t compressorTime = 0U;
+    uint32_t starts         = 0U;
+    float    deviationSum   = 0.0F;
+    uint32_t deviationTime  = 0U;
+    size_t   idx            = 0U;
+
+    for (idx = 0U; idx < BUCKET_COUNT; ++idx)
+    {
+        const Bucket& bucket = m_buckets[idx];
+
+        compressorOn   += bucket.compressorOnTime;
+        compressorTime += bucket.compressorTime;
+        starts         += bucket.compressorStarts;
+        deviationSum   += bucket.deviationSum;
+        deviationTime  += bucket.deviationTime;
+    }
+
+    switch (metric)
+    {
+    case METRIC_COMPRESSOR_DUTY_CYCLE:
+        if (0U == compressorTime)
+        {
+            isAvailable = false;
+        }
+        else
+        {
+            value = (100.0F * static_cast<float>(compressorOn)) / static_cast<float>(compressorTime);
+        }
+        break;
+
+    case METRIC_COMPRESSOR_STARTS_PER_HOUR:
+        if (0U == compressorTime)
+        {
+            isAvailable = false;
+        }
+        else
+        {
+            value = static_cast<float>(starts);
+        }
+        break;
+
+    case METRIC_COMPRESSOR_STARTS:
+        value = static_cast<float>(m_totals.compressorStarts);
+        break;
+
+    case METRIC_COMPRESSOR_ON_TIME:
+        value = static_cast<float>(m_totals.compressorOnTime) / MS_PER_HOUR;
+        break;
+
+    case METRIC_ADD_HEAT_3KW_ON_TIME:
+        value = static_cast<float>(m_totals.addHeat3kwOnTime) / MS_PER_HOUR;
+        break;
+
+    case METRIC_ADD_HEAT_6KW_ON_TIME:
+        value = static_cast<float>(m_totals.addHeat6kwOnTime) / MS_PER_HOUR;
+        break;
+
+    case METRIC_ADD_HEAT_ENERGY:
+        value  = ADD_HEAT_3KW_POWER * static_cast<float>(m_totals.addHeat3kwOnTime) / MS_PER_HOUR;
+        value += ADD_HEAT_6KW_POWER * static_cast<float>(m_totals.addHeat6kwOnTime) / MS_PER_HOUR;
+        break;
+
+    case METRIC_HOT_WATER_CYCLE_DURATION:
+        if (0U == m_totals.hotWaterCycleDuration)
+        {
+            isAvailable = false;
+        }
+        else
+        {
+            value = static_cast<float>(m_totals.hotWaterCycleDuration) / MS_PER_MINUTE;
+        }
+        break;
+
+    case METRIC_HOT_WATER_CYCLES:
+        value = static_cast<float>(m_totals.hotWaterCycles);
+        break;
+
+    case METRIC_HEAT_CURVE_DEVIATION:
+        /* Until the deviation was held for a while, the current one is provided. */
+        if (0U < deviationTime)
+        {
+            value = (1000.0F * deviationSum) / static_cast<float>(deviationTime);
+        }
+        else if (true == m_isDeviationValid)
+        {
+            value = m_deviation;
+        }
+        else
+        {
+            isAvailable = false;
+        }
+        break;
+
+    default:
+        isAvailable = false;
+        break;
+    }
+
+    return isAvailable;
+}
+
+bool IVTRego6xxDerivedMetrics::save()
+{
+    bool isSaved = false;
+
+    if (true == m_isDirty)
+    {
+        /* The preferences write the totals to flash deferred, together with other changes. */
+        if (false == m_pref.save(&m_totals))
+        {
+            ESP_LOGW(TAG, "Failed to save the totals.");
+        }
+        else
+        {
+            m_isDirty = false;
+            ++m_saves;
+            isSaved   = true;
+        }
+    }
+
+    return isSaved;
+}
+
+void IVTRego6xxDerivedMetrics::writeMetrics(std::string& out) const
+{
+    char   line[96];
+    size_t idx = 0U;
+
+    out += "# TYPE ivt_rego6xx_derived_metric gauge\n";
+
+    for (idx = 0U; idx < METRIC_COUNT; ++idx)
+    {
+        float value = 0.0F;
+
+        if (true == getMetric(static_cast<Metric>(idx), value))
+        {
+            (void)snprintf(line, sizeof(line), "ivt_rego6xx_derived_metric{metric=\"%s\"} %.3f\n", METRIC_NAMES[idx], static_cast<double>(value));
+            out += line;
+        }
+    }
+
+    out += "# TYPE ivt_rego6xx_derived_metrics_saves_total counter\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_derived_metrics_saves_total %u\n", static_cast<unsigned int>(m_saves));
+    out += line;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void IVTRego6xxDerivedMetrics::advanceWindow(uint32_t now)
+{
+    if (false == m_isWindowStarted)
+    {
+        m_bucketIdx       = 0U;
+        m_bucketStart     = now;
+        m_isWindowStarted = true;
+    }
+    else if ((BUCKET_COUNT * BUCKET_DURATION) <= (now - m_bucketStart))
+    {
+        /* The whole hour passed without any update. */
+        memset(m_buckets, 0, sizeof(m_buckets));
+        m_bucketIdx   = 0U;
+        m_bucketStart = now;
+    }
+    else
+    {
+        while (BUCKET_DURATION <= (now - m_bucketStart))
+        {
+            m_bucketIdx = (m_bucketIdx + 1U) % BUCKET_COUNT;
+            memset(&m_buckets[m_bucketIdx], 0, sizeof(Bucket));
+            m_bucketStart += BUCKET_DURATION;
+        }
+    }
+}
+
+void IVTRego6xxDerivedMetrics::updateInput(Input input, float value, uint32_t now)
+{
+    InputValue& inputValue = m_inputs[input];
+    Bucket&     bucket     = m_buckets[m_bucketIdx];
+    uint32_t    holdTime   = getHoldTime(inputValue, now);
+    bool        wasOn      = isOn(inputValue);
+    bool        isNowOn    = (0.0F != value);
+
+    switch (input)
+    {
+    case INPUT_COMPRESSOR:
+        bucket.compressorTime += holdTime;
+
+        if (true == wasOn)
+        {
+            bucket.compressorOnTime   += holdTime;
+            m_totals.compressorOnTime += holdTime;
+            m_isDirty                  = true;
+        }
+
+        /* The first value after the start is no start of the compressor. */
+        if ((true == inputValue.isValid) &&
+            (false == wasOn) &&
+            (true == isNowOn))
+        {
+            ++bucket.compressorStarts;
+            ++m_totals.compressorStarts;
+            m_isDirty = true;
+        }
+        break;
+
+    case INPUT_ADD_HEAT_3KW:
+        if (true == wasOn)
+        {
+            m_totals.addHeat3kwOnTime += holdTime;
+            m_isDirty                  = true;
+        }
+        break;
+
+    case INPUT_ADD_HEAT_6KW:
+        if (true == wasOn)
+        {
+            m_totals.addHeat6kwOnTime += holdTime;
+            m_isDirty                  = true;
+        }
+        break;
+
+    case INPUT_HOT_WATER:
+        if ((true == inputValue.isValid) &&
+            (false == wasOn) &&
+            (true == isNowOn))
+        {
+            m_hotWaterCycleStart = now;
+            m_isHotWaterCycle    = true;
+        }
+        /* A cycle is only measured, if its start was seen. */
+        else if ((true == wasOn) &&
+                 (false == isNowOn) &&
+                 (true == m_isHotWaterCycle))
+        {
+            m_totals.hotWaterCycleDuration = now - m_hotWaterCycleStart;
+            ++m_totals.hotWaterCycles;
+            m_isHotWaterCycle              = false;
+            m_isDirty                      = true;
+        }
+        else
+        {
+            ;
+        }
+        break;
+
+    case INPUT_HEAT_CURVE_ACTUAL:
+    case INPUT_HEAT_CURVE_TARGET:
+    default:
+        break;
+    }
+
+    inputValue.value     = value;
+    inputValue.timestamp = now;
+    inputValue.isValid   = true;
+}
+
+void IVTRego6xxDerivedMetrics::updateDeviation(uint32_t now)
+{
+    const InputValue& actual = m_inputs[INPUT_HEAT_CURVE_ACTUAL];
+    const InputValue& target = m_inputs[INPUT_HEAT_CURVE_TARGET];
+
+    /* The previous deviation was held until now. */
+    if (true == m_isDeviationValid)
+    {
+        uint32_t holdTime = now - m_deviationTimestamp;
+        Bucket&  bucket   = m_buckets[m_bucketIdx];
+
+        if (MAX_HOLD_TIME >= holdTime)
+        {
+            bucket.deviationSum  += m_deviation * static_cast<float>(holdTime) / 1000.0F;
+            bucket.deviationTime += holdTime;
+        }
+    }
+
+    if ((true == actual.isValid) &&
+        (true == target.isValid))
+    {
+        m_deviation          = actual.value - target.value;
+        m_deviationTimestamp = now;
+        m_isDeviationValid   = true;
+    }
+}
+
+uint32_t IVTRego6xxDerivedMetrics::getHoldTime(const InputValue& inputValue, uint32_t now)
+{
+    uint32_t holdTime = 0U;
+
+    if (true == inputValue.isValid)
+    {
+        holdTime = now - inputValue.timestamp;
+
+        if (MAX_HOLD_TIME < holdTime)
+        {
+            holdTime = 0U;
+        }
+    }
+
+    return holdTime;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
@@ -0,0 +1,330 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  IVT rego6xx controller derived metrics
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <stdint.h>
+#include "esphome/core/component.h"
+#include "esphome/core/preferences.h"
+#include <string>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * Derives operating metrics of the heatpump from the read entity values.
+ *
+ * Every metric is updated incrementally with each read value, the state of
+ * an entity is held until it is read again. The compressor duty cycle, its
+ * starts per hour and the heat curve deviation are aggregated over the last
+ * hour in buckets. The totals are saved batched to the preferences, so they
+ * continue after a reboot.
+ */
+class IVTRego6xxDerivedMetrics
+{
+public:
+
+    /**
+     * Entities, the metrics are derived from.
+     */
+    enum Input
+    {
+        INPUT_COMPRESSOR = 0U,      /**< Compressor state */
+        INPUT_ADD_HEAT_3KW,         /**< Additional heat 3 kW state */
+        INPUT_ADD_HEAT_6KW,         /**< Additional heat 6 kW state */
+        INPUT_HOT_WATER,            /**< Hot water state, e.g. the 3-way valve */
+        INPUT_HEAT_CURVE_ACTUAL,    /**< Actual temperature of the heat curve */
+        INPUT_HEAT_CURVE_TARGET,    /**< Target temperature of the heat curve */
+        INPUT_COUNT                 /**< Number of inputs */
+    };
+
+    /**
+     * Provided metrics.
+     */
+    enum Metric
+    {
+        METRIC_COMPRESSOR_DUTY_CYCLE = 0U,  /**< Compressor on-time in % of the last hour. */
+        METRIC_COMPRESSOR_STARTS_PER_HOUR,  /**< Compressor starts in the last hour. */
+        METRIC_COMPRESSOR_STARTS,           /**< Total compressor starts. */
+        METRIC_COMPRESSOR_ON_TIME,          /**< Total compressor on-time in h. */
+        METRIC_ADD_HEAT_3KW_ON_TIME,        /**< Total additional heat 3 kW on-time in h. */
+        METRIC_ADD_HEAT_6KW_ON_TIME,        /**< Total additional heat 6 kW on-time in h. */
+        METRIC_ADD_HEAT_ENERGY,             /**< Total estimated additional heat energy in kWh. */
+        METRIC_HOT_WATER_CYCLE_DURATION,    /**< Duration of the last hot water cycle in min. */
+        METRIC_HOT_WATER_CYCLES,            /**< Total hot water cycles. */
+        METRIC_HEAT_CURVE_DEVIATION,        /**< Average deviation of the heat curve in the last hour. */
+        METRIC_COUNT                        /**< Number of metrics */
+    };
+
+    /** Duration of a bucket of the last hour in ms. */
+    static const uint32_t BUCKET_DURATION = 10U * 60U * 1000U;
+
+    /** Number of buckets, which cover the last hour. */
+    static const size_t BUCKET_COUNT = 6U;
+
+    /** Maximum time in ms, an entity state is held until it is read again. A longer gap is not accounted. */
+    static const uint32_t MAX_HOLD_TIME = 15U * 60U * 1000U;
+
+    /**
+     * Constructs the derived metrics.
+     */
+    IVTRego6xxDerivedMetrics() :
+        m_pref(),
+        m_inputCount(0U),
+        m_inputs(),
+        m_buckets(),
+        m_bucketIdx(0U),
+        m_bucketStart(0U),
+        m_isWindowStarted(false),
+        m_deviation(0.0F),
+        m_deviationTimestamp(0U),
+        m_isDeviationValid(false),
+        m_hotWaterCycleStart(0U),
+        m_isHotWaterCycle(false),
+        m_totals(),
+        m_isDirty(false),
+        m_saves(0U)
+    {
+    }
+
+    /**
+     * Destroys the derived metrics.
+     */
+    ~IVTRego6xxDerivedMetrics()
+    {
+    }
+
+    /**
+     * Set the entity of an input.
+     *
+     * @param[in] input     Input
+     * @param[in] entity    Entity
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool setInput(Input input, const EntityBase* entity);
+
+    /**
+     * Get the number of inputs, which have an entity.
+     *
+     * @return Number of inputs
+     */
+    size_t getInputCount() const
+    {
+        return m_inputCount;
+    }
+
+    /**
+     * Load the totals from the preferences.
+     *
+     * @return If totals were restored, it will return true otherwise false.
+     */
+    bool load();
+
+    /**
+     * Update the metrics with the value of a read entity.
+     * Binary states are given as 0 for off and 1 for on.
+     *
+     * @param[in] entity    Entity
+     * @param[in] value     Read value
+     */
+    void update(const EntityBase* entity, float value);
+
+    /**
+     * Get a metric.
+     *
+     * @param[in]  metric   Metric
+     * @param[out] value    Value of the metric
+     *
+     * @return If the metric is available, it will return true otherwise false.
+     */
+    bool getMetric(Metric metric, float& value) const;
+
+    /**
+     * Save the totals to the preferences, if they changed since the last save.
+     *
+     * @return If saved, it will return true otherwise false.
+     */
+    bool save();
+
+    /**
+     * Append the metrics in the Prometheus text format.
+     *
+     * @param[out] out  Output
+     */
+    void writeMetrics(std::string& out) const;
+
+private:
+
+    /** Snapshot layout version, which invalidates the snapshots of older layouts. */
+    static const uint32_t VERSION = 1U;
+
+    /** Power of the additional heat 3 kW step in kW. */
+    static constexpr float ADD_HEAT_3KW_POWER = 3.0F;
+
+    /** Power of the additional heat 6 kW step in kW. */
+    static constexpr float ADD_HEAT_6KW_POWER = 6.0F;
+
+    /**
+     * Last read value of an input.
+     */
+    struct InputValue
+    {
+        const EntityBase* entity;       /**< Entity */
+        float             value;        /**< Last read value */
+        uint32_t          timestamp;    /**< Timestamp in ms, when the value was read. */
+        bool              isValid;      /**< Is a value available? */
+    };
+
+    /**
+     * Aggregation of a part of the last hour.
+     */
+    struct Bucket
+    {
+        uint32_t compressorOnTime;  /**< Compressor on-time in ms */
+        uint32_t compressorTime;    /**< Time in ms, the compressor state is known. */
+        uint32_t compressorStarts;  /**< Compressor starts */
+        float    deviationSum;      /**< Heat curve deviation integrated over time in K*s */
+        uint32_t deviationTime;     /**< Time in ms, the heat curve deviation is known. */
+    };
+
+    /**
+     * Totals, which are saved to the preferences.
+     */
+    struct Totals
+    {
+        uint32_t version;               /**< Layout version */
+        uint32_t compressorStarts;      /**< Compressor starts */
+        uint32_t hotWaterCycles;        /**< Hot water cycles */
+        uint32_t hotWaterCycleDuration; /**< Duration of the last hot water cycle in ms, 0 if unknown. */
+        uint64_t compressorOnTime;      /**< Compressor on-time in ms */
+        uint64_t addHeat3kwOnTime;      /**< Additional heat 3 kW on-time in ms */
+        uint64_t addHeat6kwOnTime;      /**< Additional heat 6 kW on-time in ms */
+    };
+
+    ESPPreferenceObject m_pref;                   /**< Preference, which stores the totals. */
+    size_t              m_inputCount;             /**< Number of inputs, which have an entity. */
+    InputValue          m_inputs[INPUT_COUNT];    /**< Last read values of the inputs */
+    Bucket              m_buckets[BUCKET_COUNT];  /**< Buckets of the last hour */
+    size_t              m_bucketIdx;              /**< Index of the current bucket */
+    uint32_t            m_bucketStart;            /**< Timestamp in ms, when the current bucket started. */
+    bool                m_isWindowStarted;        /**< Is the current bucket started? */
+    float               m_deviation;              /**< Current heat curve deviation in K */
+    uint32_t            m_deviationTimestamp;     /**< Timestamp in ms of the current heat curve deviation. */
+    bool                m_isDeviationValid;       /**< Is the current heat curve deviation available? */
+    uint32_t            m_hotWaterCycleStart;     /**< Timestamp in ms, when the current hot water cycle started. */
+    bool                m_isHotWaterCycle;        /**< Is a hot water cycle running, whose start was seen? */
+    Totals              m_totals;                 /**< Totals */
+    bool                m_isDirty;                /**< Did the totals change since the last save? */
+    uint32_t            m_saves;                  /**< Number of saves */
+
+    IVTRego6xxDerivedMetrics(const IVTRego6xxDerivedMetrics& other);
+    IVTRego6xxDerivedMetrics& operator=(const IVTRego6xxDerivedMetrics& other);
+
+    /**
+     * Move the buckets of the last hour forward to the current time.
+     *
+     * @param[in] now   Current timestamp in ms
+     */
+    void advanceWindow(uint32_t now);
+
+    /**
+     * Update a single input with a read value.
+     *
+     * @param[in] input Input
+     * @param[in] value Read value
+     * @param[in] now   Current timestamp in ms
+     */
+    void updateInput(Input input, float value, uint32_t now);
+
+    /**
+     * Update the heat curve deviation, after its actual or target temperature was read.
+     *
+     * @param[in] now   Current timestamp in ms
+     */
+    void updateDeviation(uint32_t now);
+
+    /**
+     * Get the time in ms, the last value of an input was held until now.
+     *
+     * @param[in] inputValue    Input value
+     * @param[in] now           Current timestamp in ms
+     *
+     * @return Hold time in ms or 0 if unknown.
+     */
+    static uint32_t getHoldTime(const InputValue& inputValue, uint32_t now);
+
+    /**
+     * Is a binary input on?
+     *
+     * @param[in] inputValue    Input value
+     *
+     * @return If the input is known and on, it will return true otherwise false.
+     */
+    static bool isOn(const InputValue& inputValue)
+    {
+        return (true == inputValue.isValid) && (0.0F != inputValue.value);
+    }
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
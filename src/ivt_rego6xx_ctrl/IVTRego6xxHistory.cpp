@@ -0,0 +1,836 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  IVT rego6xx controller compressed sample history
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IVTRego6xxHistory.h"
+#include "IVTRego6xxMetrics.h"
+#include "SimpleTimer.hpp"
+#include <new>
+#include <stdio.h>
+#include <string.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+namespace esphome
+{
+namespace ivt_rego6xx_ctrl
+{
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static uint32_t encodeZigzag(int32_t value);
+static int32_t decodeZigzag(uint32_t value);
+static size_t encodeVarint(uint8_t* buffer, uint32_t value);
+static bool decodeVarint(const uint8_t* buffer, size_t size, size_t& offset, uint32_t& value);
+static void writeUInt16(uint8_t* buffer, uint16_t value);
+static void writeUInt32(uint8_t* buffer, uint32_t value);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** File header magic. */
+static const uint8_t MAGIC[] = { 'R', '6', 'H', 'S' };
+
+/** CSV header line. */
+static const char CSV_HEADER[] = "entity,uptime_s,age_s,value\n";
+
+/** Number of seconds per day. */
+static const uint32_t SECONDS_PER_DAY = 86400U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool IVTRego6xxHistory::addSensor(const EntityBase* entity, size_t size)
+{
+    bool isSuccessful = false;
+
+    if ((nullptr != entity) &&
+        (MAX_SENSORS > m_sensorCount) &&
+        (MAX_SENSORS == findSensor(entity)))
+    {
+        SensorHistory& history = m_sensors[m_sensorCount];
+
+        history.entity        = entity;
+        history.size          = size;
+        history.blocks        = nullptr;
+        history.blockCount    = 0U;
+        history.firstNumber   = 0U;
+        history.headNumber    = 0U;
+        history.isStarted     = false;
+        history.lastTime      = 0U;
+        history.lastValue     = 0;
+        history.lastTimeDelta = 0;
+        history.firstTime     = 0U;
+        history.samples       = 0U;
+
+        ++m_sensorCount;
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+bool IVTRego6xxHistory::allocate()
+{
+    bool   isSuccessful = true;
+    size_t idx          = 0U;
+
+    for (idx = 0U; idx < m_sensorCount; ++idx)
+    {
+        SensorHistory& history = m_sensors[idx];
+
+        if (nullptr == history.blocks)
+        {
+            /* At least two blocks, so the previous block is kept while the next one is filled. */
+            size_t blockCount = history.size / sizeof(Block);
+
+            if (2U > blockCount)
+            {
+                blockCount = 2U;
+            }
+
+            history.blocks = new (std::nothrow) Block[blockCount];
+
+            if (nullptr == history.blocks)
+            {
+                isSuccessful = false;
+            }
+            else
+            {
+                history.blockCount = blockCount;
+            }
+        }
+    }
+
+    return isSuccessful;
+}
+
+void IVTRego6xxHistory::release()
+{
+    size_t idx = 0U;
+
+    for (idx = 0U; idx < m_sensorCount; ++idx)
+    {
+        SensorHistory& history = m_sensors[idx];
+
+        if (nullptr != history.blocks)
+        {
+            delete[] history.blocks;
+            history.blocks     = nullptr;
+            history.blockCount = 0U;
+            history.isStarted  = false;
+        }
+    }
+}
+
+size_t IVTRego6xxHistory::getMemorySize() const
+{
+    size_t size = 0U;
+    size_t idx  = 0U;
+
+    for (idx = 0U; idx < m_sensorCount; ++idx)
+    {
+        size += m_sensors[idx].blockCount * sizeof(Block);
+    }
+
+    return size;
+}
+
+void IVTRego6xxHistory::add(const EntityBase* entity, int16_t value)
+{
+    size_t   idx  = findSensor(entity);
+    uint32_t time = updateUptime();
+
+    if ((MAX_SENSORS > idx) &&
+        (nullptr != m_sensors[idx].blocks))
+    {
+        SensorHistory& history = m_sensors[idx];
+        Block*         block   = nullptr;
+
+        if (true == history.isStarted)
+        {
+            block = &history.blocks[history.headNumber % history.blockCount];
+        }
+
+        if ((nullptr == block) ||
+            (MAX_SAMPLE_SIZE > (BLOCK_DATA_SIZE - block->used)))
+        {
+            startBlock(history, time, value);
+        }
+        else
+        {
+            int32_t timeDelta  = static_cast<int32_t>(time - history.lastTime);
+            int32_t dod        = timeDelta - history.lastTimeDelta;
+            int32_t valueDelta = static_cast<int32_t>(value) - history.lastValue;
+            size_t  used       = block->used;
+
+            if ((0 == dod) &&
+                (-64 <= valueDelta) &&
+                (63 >= valueDelta))
+            {
+                block->data[used] = static_cast<uint8_t>(valueDelta) & 0x7FU;
+                ++used;
+            }
+            else
+            {
+                block->data[used] = ESCAPE;
+                ++used;
+                used += encodeVarint(&block->data[used], encodeZigzag(dod));
+                used += encodeVarint(&block->data[used], encodeZigzag(valueDelta));
+            }
+
+            /* Publish the sample after its data is complete. */
+            block->used           = static_cast<uint16_t>(used);
+            history.lastTimeDelta = timeDelta;
+        }
+
+        history.lastTime  = time;
+        history.lastValue = value;
+        ++history.samples;
+    }
+}
+
+void IVTRego6xxHistory::beginExport(Cursor& cursor) const
+{
+    cursor.now            = getUptime();
+    cursor.isHeaderDone   = false;
+    cursor.sensorIdx      = 0U;
+    cursor.blockNumber    = 0U;
+    cursor.isBlockStarted = false;
+    cursor.offset         = 0U;
+    cursor.time           = 0U;
+    cursor.value          = 0;
+    cursor.timeDelta      = 0;
+}
+
+size_t IVTRego6xxHistory::exportCsv(char* buffer, size_t size, Cursor& cursor) const
+{
+    size_t written = 0U;
+    bool   isFull  = false;
+
+    if (nullptr == buffer)
+    {
+        isFull = true;
+    }
+    else if (false == cursor.isHeaderDone)
+    {
+        if ((sizeof(CSV_HEADER) - 1U) > size)
+        {
+            isFull = true;
+        }
+        else
+        {
+            memcpy(buffer, CSV_HEADER, sizeof(CSV_HEADER) - 1U);
+            written             = sizeof(CSV_HEADER) - 1U;
+            cursor.isHeaderDone = true;
+        }
+    }
+    else
+    {
+        ;
+    }
+
+    while ((false == isFull) && (m_sensorCount > cursor.sensorIdx))
+    {
+        const SensorHistory& history = m_sensors[cursor.sensorIdx];
+        uint32_t             number  = cursor.blockNumber;
+        Block                block;
+
+        if ((false == history.isStarted) ||
+            (0 < static_cast<int32_t>(number - history.headNumber)))
+        {
+            ++cursor.sensorIdx;
+            cursor.blockNumber    = 0U;
+            cursor.isBlockStarted = false;
+        }
+        else if (0 > static_cast<int32_t>(number - history.firstNumber))
+        {
+            /* The block was overwritten, continue with the oldest one. */
+            cursor.blockNumber    = history.firstNumber;
+            cursor.isBlockStarted = false;
+        }
+        else if (false == copyBlock(history, number, block))
+        {
+            /* The block is overwritten right now, the oldest block number is already updated. */
+            ;
+        }
+        else
+        {
+            const char* name = history.entity->get_name().c_str();
+            char        line[MAX_LINE_SIZE];
+            size_t      lineSize = 0U;
+
+            if (false == cursor.isBlockStarted)
+            {
+                lineSize = formatLine(line, name, block.startTime, cursor.now, block.startValue);
+
+                if (lineSize > (size - written))
+                {
+                    isFull = true;
+                }
+                else
+                {
+                    memcpy(&buffer[written], line, lineSize);
+                    written              += lineSize;
+
+                    cursor.isBlockStarted = true;
+                    cursor.offset         = 0U;
+                    cursor.time           = block.startTime;
+                    cursor.value          = block.startValue;
+                    cursor.timeDelta      = 0;
+                }
+            }
+
+            while ((false == isFull) && (cursor.offset < block.used))
+            {
+                size_t   offset    = cursor.offset;
+                uint32_t time      = cursor.time;
+                int32_t  value     = cursor.value;
+                int32_t  timeDelta = cursor.timeDelta;
+
+                if (false == decodeSample(block, offset, time, value, timeDelta))
+                {
+                    /* Corrupt data, skip the rest of the block. */
+                    cursor.offset = block.used;
+                }
+                else
+                {
+                    lineSize = formatLine(line, name, time, cursor.now, value);
+
+                    if (lineSize > (size - written))
+                    {
+                        isFull = true;
+                    }
+                    else
+                    {
+                        memcpy(&buffer[written], line, lineSize);
+                        written          += lineSize;
+
+                        cursor.offset     = offset;
+                        cursor.time       = time;
+                        cursor.value      = value;
+                        cursor.timeDelta  = timeDelta;
+                    }
+                }
+            }
+
+            if (false == isFull)
+            {
+                /* The current block is the last one of the sensor. */
+                if (number == history.headNumber)
+                {
+                    ++cursor.sensorIdx;
+                    cursor.blockNumber = 0U;
+                }
+                else
+                {
+                    ++cursor.blockNumber;
+                }
+
+                cursor.isBlockStarted = false;
+            }
+        }
+    }
+
+    return written;
+}
+
+size_t IVTRego6xxHistory::exportBinary(uint8_t* buffer, size_t size, Cursor& cursor) const
+{
+    size_t written = 0U;
+    bool   isFull  = false;
+
+    if (nullptr == buffer)
+    {
+        isFull = true;
+    }
+    else if (false == cursor.isHeaderDone)
+    {
+        size_t headerSize = FILE_HEADER_SIZE;
+        size_t idx        = 0U;
+
+        for (idx = 0U; idx < m_sensorCount; ++idx)
+        {
+            size_t nameSize = m_sensors[idx].entity->get_name().size();
+
+            headerSize += 1U + ((UINT8_MAX < nameSize) ? UINT8_MAX : nameSize);
+        }
+
+        if (headerSize > size)
+        {
+            isFull = true;
+        }
+        else
+        {
+            buffer[0] = MAGIC[0];
+            buffer[1] = MAGIC[1];
+            buffer[2] = MAGIC[2];
+            buffer[3] = MAGIC[3];
+            buffer[4] = VERSION;
+            buffer[5] = static_cast<uint8_t>(m_sensorCount);
+            buffer[6] = 0U; /* Reserved for future use. */
+            buffer[7] = 0U;
+            writeUInt32(&buffer[8], cursor.now);
+            written   = FILE_HEADER_SIZE;
+
+            for (idx = 0U; idx < m_sensorCount; ++idx)
+            {
+                const std::string& name     = m_sensors[idx].entity->get_name();
+                size_t             nameSize = (UINT8_MAX < name.size()) ? UINT8_MAX : name.size();
+
+                buffer[written] = static_cast<uint8_t>(nameSize);
+                ++written;
+                memcpy(&buffer[written], name.c_str(), nameSize);
+                written += nameSize;
+            }
+
+            cursor.isHeaderDone = true;
+        }
+    }
+    else
+    {
+        ;
+    }
+
+    while ((false == isFull) && (m_sensorCount > cursor.sensorIdx))
+    {
+        const SensorHistory& history = m_sensors[cursor.sensorIdx];
+        uint32_t             number  = cursor.blockNumber;
+        Block                block;
+
+        if ((false == history.isStarted) ||
+            (0 < static_cast<int32_t>(number - history.headNumber)))
+        {
+            ++cursor.sensorIdx;
+            cursor.blockNumber = 0U;
+        }
+        else if (0 > static_cast<int32_t>(number - history.firstNumber))
+        {
+            /* The block was overwritten, continue with the oldest one. */
+            cursor.blockNumber = history.firstNumber;
+        }
+        else if (false == copyBlock(history, number, block))
+        {
+            /* The block is overwritten right now, the oldest block number is already updated. */
+            ;
+        }
+        else if ((BLOCK_HEADER_SIZE + block.used) > (size - written))
+        {
+            isFull = true;
+        }
+        else
+        {
+            uint8_t* header = &buffer[written];
+
+            header[0] = static_cast<uint8_t>(cursor.sensorIdx);
+            header[1] = 0U; /* Reserved for future use. */
+            writeUInt16(&header[2], block.used);
+            writeUInt32(&header[4], block.startTime);
+            writeUInt16(&header[8], static_cast<uint16_t>(block.startValue));
+            header[10] = 0U; /* Reserved for future use. */
+            header[11] = 0U;
+            written   += BLOCK_HEADER_SIZE;
+
+            memcpy(&buffer[written], block.data, block.used);
+            written += block.used;
+
+            /* The current block is the last one of the sensor. */
+            if (number == history.headNumber)
+            {
+                ++cursor.sensorIdx;
+                cursor.blockNumber = 0U;
+            }
+            else
+            {
+                ++cursor.blockNumber;
+            }
+        }
+    }
+
+    return written;
+}
+
+void IVTRego6xxHistory::writeMetrics(std::string& out) const
+{
+    char     line[48];
+    size_t   idx    = 0U;
+    uint32_t uptime = getUptime();
+
+    out += "# TYPE ivt_rego6xx_history_size_bytes gauge\n";
+    for (idx = 0U; idx < m_sensorCount; ++idx)
+    {
+        out += "ivt_rego6xx_history_size_bytes{entity=\"";
+        appendLabelValue(out, m_sensors[idx].entity->get_name().c_str());
+        (void)snprintf(line, sizeof(line), "\"} %u\n", static_cast<unsigned int>(m_sensors[idx].blockCount * sizeof(Block)));
+        out += line;
+    }
+
+    out += "# TYPE ivt_rego6xx_history_samples_total counter\n";
+    for (idx = 0U; idx < m_sensorCount; ++idx)
+    {
+        out += "ivt_rego6xx_history_samples_total{entity=\"";
+        appendLabelValue(out, m_sensors[idx].entity->get_name().c_str());
+        (void)snprintf(line, sizeof(line), "\"} %u\n", static_cast<unsigned int>(m_sensors[idx].samples));
+        out += line;
+    }
+
+    out += "# TYPE ivt_rego6xx_history_span_seconds gauge\n";
+    for (idx = 0U; idx < m_sensorCount; ++idx)
+    {
+        const SensorHistory& history = m_sensors[idx];
+        uint32_t             span    = 0U;
+
+        if (true == history.isStarted)
+        {
+            span = uptime - history.blocks[history.firstNumber % history.blockCount].startTime;
+        }
+
+        out += "ivt_rego6xx_history_span_seconds{entity=\"";
+        appendLabelValue(out, history.entity->get_name().c_str());
+        (void)snprintf(line, sizeof(line), "\"} %u\n", static_cast<unsigned int>(span));
+        out += line;
+    }
+
+    /* The measured memory per day includes the block headers and the unused
+     * rest of full blocks, therefore it shows the real retention.
+     */
+    out += "# TYPE ivt_rego6xx_history_bytes_per_day gauge\n";
+    for (idx = 0U; idx < m_sensorCount; ++idx)
+    {
+        const SensorHistory& history = m_sensors[idx];
+        uint32_t             elapsed = history.lastTime - history.firstTime;
+
+        if ((true == history.isStarted) &&
+            (0U < elapsed))
+        {
+            const Block& head  = history.blocks[history.headNumber % history.blockCount];
+            float        bytes = static_cast<float>(history.headNumber) * static_cast<float>(sizeof(Block)) +
+                                 static_cast<float>(sizeof(Block) - BLOCK_DATA_SIZE + head.used);
+
+            out += "ivt_rego6xx_history_bytes_per_day{entity=\"";
+            appendLabelValue(out, history.entity->get_name().c_str());
+            (void)snprintf(line, sizeof(line), "\"} %.1f\n",
+                static_cast<double>(bytes * static_cast<float>(SECONDS_PER_DAY) / static_cast<float>(elapsed)));
+            out += line;
+        }
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+size_t IVTRego6xxHistory::findSensor(const EntityBase* entity) const
+{
+    size_t idx = 0U;
+
+    while ((idx < m_sensorCount) && (entity != m_sensors[idx].entity))
+    {
+        ++idx;
+    }
+
+    return (idx < m_sensorCount) ? idx : MAX_SENSORS;
+}
+
+uint32_t IVTRego6xxHistory::updateUptime()
+{
+    uint32_t now = SimpleTimer::now();
+
+    m_elapsed += now - m_lastNow;
+    m_lastNow  = now;
+    m_uptime  += m_elapsed / 1000U;
+    m_elapsed %= 1000U;
+
+    return m_uptime;
+}
+
+uint32_t IVTRego6xxHistory::getUptime() const
+{
+    return m_uptime + ((m_elapsed + (SimpleTimer::now() - m_lastNow)) / 1000U);
+}
+
+void IVTRego6xxHistory::startBlock(SensorHistory& history, uint32_t time, int16_t value)
+{
+    uint32_t number = 0U;
+    Block*   block  = nullptr;
+
+    if (true == history.isStarted)
+    {
+        number = history.headNumber + 1U;
+    }
+    else
+    {
+        history.firstTime = time;
+    }
+
+    /* Readers skip the oldest block, before it is overwritten. */
+    if (number >= history.blockCount)
+    {
+        history.firstNumber = number - history.blockCount + 1U;
+    }
+
+    block             = &history.blocks[number % history.blockCount];
+    block->number     = INVALID_NUMBER;
+    block->startTime  = time;
+    block->startValue = value;
+    block->used       = 0U;
+    block->number     = number;
+
+    history.headNumber    = number;
+    history.lastTimeDelta = 0;
+    history.isStarted     = true;
+}
+
+bool IVTRego6xxHistory::copyBlock(const SensorHistory& history, uint32_t number, Block& block)
+{
+    bool         isValid = false;
+    const Block& source  = history.blocks[number % history.blockCount];
+
+    if (number == source.number)
+    {
+        block.startTime  = source.startTime;
+        block.startValue = source.startValue;
+        block.used       = source.used;
+
+        memcpy(block.data, source.data, block.used);
+
+        /* Check again, because the block might be overwritten during the copy. */
+        if (number == source.number)
+        {
+            block.number = number;
+            isValid      = true;
+        }
+    }
+
+    return isValid;
+}
+
+bool IVTRego6xxHistory::decodeSample(const Block& block, size_t& offset, uint32_t& time, int32_t& value, int32_t& timeDelta)
+{
+    bool isSuccessful = false;
+
+    if (offset < block.used)
+    {
+        uint8_t first = block.data[offset];
+
+        if (ESCAPE != first)
+        {
+            /* Sign extend the 7-bit value delta. */
+            value        += static_cast<int32_t>(static_cast<int8_t>(static_cast<uint8_t>(first << 1U))) / 2;
+            time         += static_cast<uint32_t>(timeDelta);
+            offset       += 1U;
+            isSuccessful  = true;
+        }
+        else
+        {
+            size_t   next       = offset + 1U;
+            uint32_t dod        = 0U;
+            uint32_t valueDelta = 0U;
+
+            if ((true == decodeVarint(block.data, block.used, next, dod)) &&
+                (true == decodeVarint(block.data, block.used, next, valueDelta)))
+            {
+                timeDelta    += decodeZigzag(dod);
+                value        += decodeZigzag(valueDelta);
+                time         += static_cast<uint32_t>(timeDelta);
+                offset        = next;
+                isSuccessful  = true;
+            }
+        }
+    }
+
+    return isSuccessful;
+}
+
+size_t IVTRego6xxHistory::formatLine(char* line, const char* name, uint32_t time, uint32_t now, int32_t value)
+{
+    uint32_t magnitude = (0 > value) ? static_cast<uint32_t>(-value) : static_cast<uint32_t>(value);
+    int      length    = snprintf(line, MAX_LINE_SIZE, "%s,%u,%u,%s%u.%u\n",
+                                  name,
+                                  static_cast<unsigned int>(time),
+                                  static_cast<unsigned int>(now - time),
+                                  (0 > value) ? "-" : "",
+                                  static_cast<unsigned int>(magnitude / 10U),
+                                  static_cast<unsigned int>(magnitude % 10U));
+    size_t   lineSize  = 0U;
+
+    /* A truncated line is dropped. */
+    if ((0 < length) &&
+        (MAX_LINE_SIZE > static_cast<size_t>(length)))
+    {
+        lineSize = static_cast<size_t>(length);
+    }
+
+    return lineSize;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Map a signed value to an unsigned value, so small magnitudes result in
+ * small numbers.
+ *
+ * @param[in] value Signed value
+ *
+ * @return Zigzag encoded value
+ */
+static uint32_t encodeZigzag(int32_t value)
+{
+    return (static_cast<uint32_t>(value) << 1U) ^ static_cast<uint32_t>(value >> 31U);
+}
+
+/**
+ * Map a zigzag encoded value back to the signed value.
+ *
+ * @param[in] value Zigzag encoded value
+ *
+ * @return Signed value
+ */
+static int32_t decodeZigzag(uint32_t value)
+{
+    return static_cast<int32_t>((value >> 1U) ^ (0U - (value & 1U)));
+}
+
+/**
+ * Encode an unsigned value as LEB128 varint.
+ *
+ * @param[out] buffer   Buffer with at least 5 byte
+ * @param[in]  value    Value
+ *
+ * @return Number of written bytes
+ */
+static size_t encodeVarint(uint8_t* buffer, uint32_t value)
+{
+    size_t size = 0U;
+
+    while (0x80U <= value)
+    {
+        buffer[size] = static_cast<uint8_t>(value & 0x7FU) | 0x80U;
+        value      >>= 7U;
+        ++size;
+    }
+
+    buffer[size] = static_cast<uint8_t>(value);
+    ++size;
+
+    return size;
+}
+
+/**
+ * Decode a LEB128 varint.
+ *
+ * @param[in]     buffer    Buffer
+ * @param[in]     size      Buffer size in byte
+ * @param[in,out] offset    Offset of the varint, which is advanced.
+ * @param[out]    value     Value
+ *
+ * @return If successful decoded, it will return true otherwise false.
+ */
+static bool decodeVarint(const uint8_t* buffer, size_t size, size_t& offset, uint32_t& value)
+{
+    bool     isSuccessful = false;
+    bool     isEnd        = false;
+    uint32_t shift        = 0U;
+    size_t   next         = offset;
+
+    value = 0U;
+
+    while ((false == isEnd) && (next < size) && (32U > shift))
+    {
+        value |= static_cast<uint32_t>(buffer[next] & 0x7FU) << shift;
+        isEnd  = (0U == (buffer[next] & 0x80U));
+        shift += 7U;
+        ++next;
+    }
+
+    if (true == isEnd)
+    {
+        offset       = next;
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+/**
+ * Write a 16-bit value in little endian.
+ *
+ * @param[out] buffer   Buffer with at least 2 byte
+ * @param[in]  value    Value
+ */
+static void writeUInt16(uint8_t* buffer, uint16_t value)
+{
+    buffer[0] = static_cast<uint8_t>((value >> 0U) & 0xFFU);
+    buffer[1] = static_cast<uint8_t>((value >> 8U) & 0xFFU);
+}
+
+/**
+ * Write a 32-bit value in little endian.
+ *
+ * @param[out] buffer   Buffer with at least 4 byte
+ * @param[in]  value    Value
+ */
+static void writeUInt32(uint8_t* buffer, uint32_t value)
+{
+    buffer[0] = static_cast<uint8_t>((value >> 0U) & 0xFFU);
+    buffer[1] = static_cast<uint8_t>((value >> 8U) & 0xFFU);
+    buffer[2] = static_cast<uint8_t>((value >> 16U) & 0xFFU);
+    buffer[3] = static_cast<uint8_t>((value >> 24U) & 0xFFU);
+}
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
@@ -0,0 +1,365 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  IVT rego6xx controller compressed sample history
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <stdint.h>
+#include "esphome/core/component.h"
+#include <string>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * Keeps the raw values of sensors compressed in RAM, so they can be
+ * downloaded later, e.g. to backfill after a network outage.
+ *
+ * The history of a sensor is a ring of blocks. A block starts with the
+ * timestamp in s since the start and the 16-bit raw value of its first
+ * sample. Every further sample stores only the delta of its timestamp delta
+ * and the delta of its value:
+ * - 0vvvvvvv: The timestamp delta is unchanged, the value delta is a 7-bit
+ *   two's complement number. A sensor, which is read with a constant period
+ *   and changes slowly, takes 1 byte per sample.
+ * - 10000000, followed by the zigzag encoded delta of the timestamp delta
+ *   and the zigzag encoded value delta, each as unsigned LEB128 varint.
+ *
+ * The timestamps are based on an own uptime in s, which doesn't wrap around
+ * after 49 days like the timestamp in ms. A full ring overwrites its oldest
+ * block. The samples are added by the main
+ * loop and can be exported by another task concurrently. A block, which is
+ * overwritten while it is copied, is skipped.
+ */
+class IVTRego6xxHistory
+{
+public:
+
+    /** Maximum number of sensors, which covers all sensors of the controller. */
+    static const size_t MAX_SENSORS = 11U;
+
+    /** Size of the sample data of a block in byte. */
+    static const size_t BLOCK_DATA_SIZE = 244U;
+
+    /** Size of the file header of the binary export in byte, without the sensor names. */
+    static const size_t FILE_HEADER_SIZE = 12U;
+
+    /** Size of the block header of the binary export in byte. */
+    static const size_t BLOCK_HEADER_SIZE = 12U;
+
+    /** Binary export format version. */
+    static const uint8_t VERSION = 1U;
+
+    /**
+     * Export position, which is kept between the chunks of a download.
+     */
+    struct Cursor
+    {
+        uint32_t now;            /**< Timestamp in s, when the export started. */
+        bool     isHeaderDone;   /**< Was the header exported? */
+        size_t   sensorIdx;      /**< Index of the current sensor */
+        uint32_t blockNumber;    /**< Number of the current block */
+        bool     isBlockStarted; /**< Was the first sample of the current block exported? */
+        size_t   offset;         /**< Offset of the next sample in the current block */
+        uint32_t time;           /**< Timestamp in s of the last exported sample */
+        int32_t  value;          /**< Raw value of the last exported sample */
+        int32_t  timeDelta;      /**< Timestamp delta in s of the last exported sample */
+    };
+
+    /**
+     * Constructs the history.
+     */
+    IVTRego6xxHistory() :
+        m_sensorCount(0U),
+        m_sensors(),
+        m_lastNow(0U),
+        m_elapsed(0U),
+        m_uptime(0U)
+    {
+    }
+
+    /**
+     * Destroys the history.
+     */
+    ~IVTRego6xxHistory()
+    {
+        release();
+    }
+
+    /**
+     * Add a sensor, whose values shall be kept.
+     *
+     * @param[in] entity    Sensor
+     * @param[in] size      Memory size in byte, which is rounded down to whole blocks.
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addSensor(const EntityBase* entity, size_t size);
+
+    /**
+     * Get the number of sensors.
+     *
+     * @return Number of sensors
+     */
+    size_t getCount() const
+    {
+        return m_sensorCount;
+    }
+
+    /**
+     * Allocate the memory of every sensor.
+     *
+     * @return If the memory of every sensor is allocated, it will return true otherwise false.
+     */
+    bool allocate();
+
+    /**
+     * Release the memory of every sensor.
+     */
+    void release();
+
+    /**
+     * Get the allocated memory of every sensor.
+     *
+     * @return Total allocated memory in byte
+     */
+    size_t getMemorySize() const;
+
+    /**
+     * Add a read value of a sensor.
+     *
+     * @param[in] entity    Sensor
+     * @param[in] value     Raw value, 16-bit fixed point
+     */
+    void add(const EntityBase* entity, int16_t value);
+
+    /**
+     * Start an export.
+     *
+     * @param[out] cursor   Export position
+     */
+    void beginExport(Cursor& cursor) const;
+
+    /**
+     * Export the next decoded samples as CSV lines with the sensor name, the
+     * timestamp in s since the start, the age in s and the value. The raw
+     * value is provided in tenths.
+     *
+     * @param[out]    buffer    Buffer, which to fill
+     * @param[in]     size      Buffer size in byte
+     * @param[in,out] cursor    Export position, which is advanced.
+     *
+     * @return Number of written bytes, 0 if finished.
+     */
+    size_t exportCsv(char* buffer, size_t size, Cursor& cursor) const;
+
+    /**
+     * Export the next blocks in the binary format. The file header contains
+     * the magic "R6HS", the version, the number of sensors, 2 reserved bytes
+     * and the timestamp in s of the export, followed by the sensor names, each
+     * with its length as prefix. Every block has a header with the sensor
+     * index, a reserved byte, the data size, the timestamp and raw value of
+     * its first sample and 2 reserved bytes, followed by its sample data.
+     * All numbers are little endian.
+     *
+     * @param[out]    buffer    Buffer, which to fill
+     * @param[in]     size      Buffer size in byte
+     * @param[in,out] cursor    Export position, which is advanced.
+     *
+     * @return Number of written bytes, 0 if finished.
+     */
+    size_t exportBinary(uint8_t* buffer, size_t size, Cursor& cursor) const;
+
+    /**
+     * Append the memory size, the samples and the measured memory per day
+     * of every sensor in the Prometheus text format.
+     *
+     * @param[out] out  Output
+     */
+    void writeMetrics(std::string& out) const;
+
+private:
+
+    /** Block number, which marks a block while it is overwritten. */
+    static const uint32_t INVALID_NUMBER = 0xFFFFFFFFU;
+
+    /** Maximum encoded size of a sample in byte. */
+    static const size_t MAX_SAMPLE_SIZE = 9U;
+
+    /** First byte of a sample, whose deltas follow as varints. */
+    static const uint8_t ESCAPE = 0x80U;
+
+    /** Maximum size of a CSV line in byte. */
+    static const size_t MAX_LINE_SIZE = 64U;
+
+    /**
+     * Block of samples.
+     */
+    struct Block
+    {
+        volatile uint32_t number;                /**< Block number, which increases with every block. */
+        uint32_t          startTime;             /**< Timestamp in s of the first sample */
+        int16_t           startValue;            /**< Raw value of the first sample */
+        volatile uint16_t used;                  /**< Size of the sample data in byte */
+        uint8_t           data[BLOCK_DATA_SIZE]; /**< Sample data */
+    };
+
+    /**
+     * History of a single sensor.
+     */
+    struct SensorHistory
+    {
+        const EntityBase* entity;        /**< Sensor */
+        size_t            size;          /**< Requested memory size in byte */
+        Block*            blocks;        /**< Ring of blocks */
+        size_t            blockCount;    /**< Number of blocks */
+        volatile uint32_t firstNumber;   /**< Number of the oldest block */
+        volatile uint32_t headNumber;    /**< Number of the current block */
+        bool              isStarted;     /**< Was a sample added? */
+        uint32_t          lastTime;      /**< Timestamp in s of the last sample */
+        int32_t           lastValue;     /**< Raw value of the last sample */
+        int32_t           lastTimeDelta; /**< Timestamp delta in s of the last sample */
+        uint32_t          firstTime;     /**< Timestamp in s of the first sample ever. */
+        uint32_t          samples;       /**< Number of added samples */
+    };
+
+    size_t            m_sensorCount;          /**< Number of sensors */
+    SensorHistory     m_sensors[MAX_SENSORS]; /**< Histories of the sensors */
+    uint32_t          m_lastNow;              /**< Timestamp in ms of the last uptime update */
+    uint32_t          m_elapsed;              /**< Elapsed time in ms, which is not counted in the uptime yet. */
+    volatile uint32_t m_uptime;               /**< Uptime in s, which doesn't wrap around like the timestamp in ms. */
+
+    IVTRego6xxHistory(const IVTRego6xxHistory& other);
+    IVTRego6xxHistory& operator=(const IVTRego6xxHistory& other);
+
+    /**
+     * Find the history of a sensor.
+     *
+     * @param[in] entity    Sensor
+     *
+     * @return Index of the sensor or MAX_SENSORS if not found.
+     */
+    size_t findSensor(const EntityBase* entity) const;
+
+    /**
+     * Update the uptime.
+     *
+     * @return Uptime in s
+     */
+    uint32_t updateUptime();
+
+    /**
+     * Get the uptime, without updating it.
+     *
+     * @return Uptime in s
+     */
+    uint32_t getUptime() const;
+
+    /**
+     * Start a new block with a sample. If the ring is full, the oldest
+     * block is overwritten.
+     *
+     * @param[in,out] history   Sensor history
+     * @param[in]     time      Timestamp in s
+     * @param[in]     value     Raw value
+     */
+    static void startBlock(SensorHistory& history, uint32_t time, int16_t value);
+
+    /**
+     * Copy a block, if it is still valid.
+     *
+     * @param[in]  history  Sensor history
+     * @param[in]  number   Block number
+     * @param[out] block    Copy of the block
+     *
+     * @return If the block is valid, it will return true otherwise false.
+     */
+    static bool copyBlock(const SensorHistory& history, uint32_t number, Block& block);
+
+    /**
+     * Decode the next sample of a block.
+     *
+     * @param[in]     block     Block
+     * @param[in,out] offset    Offset of the sample, which is advanced.
+     * @param[in,out] time      Timestamp in s of the previous sample, which is updated.
+     * @param[in,out] value     Raw value of the previous sample, which is updated.
+     * @param[in,out] timeDelta Timestamp delta in s of the previous sample, which is updated.
+     *
+     * @return If a sample was decoded, it will return true otherwise false.
+     */
+    static bool decodeSample(const Block& block, size_t& offset, uint32_t& time, int32_t& value, int32_t& timeDelta);
+
+    /**
+     * Format a sample as CSV line.
+     *
+     * @param[out] line     Line buffer with at least MAX_LINE_SIZE byte
+     * @param[in]  name     Sensor name
+     * @param[in]  time     Timestamp in s
+     * @param[in]  now      Timestamp in s of the export
+     * @param[in]  value    Raw value
+     *
+     * @return Line length in byte
+     */
+    static size_t formatLine(char* line, const char* name, uint32_t time, uint32_t now, int32_t value);
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
@@ -0,0 +1,133 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Component specific log levels
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "esphome/core/defines.h"
+#include "esphome/core/log.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/**
+ * Log level of the polling subsystem, which reads the sensors, binary sensors,
+ * text sensors and numbers. It can only lower the ESPHome log level.
+ */
+#ifndef IVT_REGO6XX_POLL_LOG_LEVEL
+#define IVT_REGO6XX_POLL_LOG_LEVEL  ESPHOME_LOG_LEVEL
+#endif /* IVT_REGO6XX_POLL_LOG_LEVEL */
+
+/**
+ * Log level of the write subsystem, which writes the buttons and numbers.
+ * It can only lower the ESPHome log level.
+ */
+#ifndef IVT_REGO6XX_WRITE_LOG_LEVEL
+#define IVT_REGO6XX_WRITE_LOG_LEVEL ESPHOME_LOG_LEVEL
+#endif /* IVT_REGO6XX_WRITE_LOG_LEVEL */
+
+/*
+ * A disabled level is removed by the preprocessor, therefore neither its
+ * arguments are evaluated nor its message is formatted.
+ */
+
+/** Log disabled. */
+#define IVT_REGO6XX_LOG_DISABLED(...)   do { } while (0)
+
+#if (IVT_REGO6XX_POLL_LOG_LEVEL >= ESPHOME_LOG_LEVEL_ERROR)
+#define IVT_REGO6XX_POLL_LOGE(...)      ESP_LOGE(__VA_ARGS__)
+#else
+#define IVT_REGO6XX_POLL_LOGE(...)      IVT_REGO6XX_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if (IVT_REGO6XX_POLL_LOG_LEVEL >= ESPHOME_LOG_LEVEL_WARN)
+#define IVT_REGO6XX_POLL_LOGW(...)      ESP_LOGW(__VA_ARGS__)
+#else
+#define IVT_REGO6XX_POLL_LOGW(...)      IVT_REGO6XX_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if (IVT_REGO6XX_POLL_LOG_LEVEL >= ESPHOME_LOG_LEVEL_INFO)
+#define IVT_REGO6XX_POLL_LOGI(...)      ESP_LOGI(__VA_ARGS__)
+#else
+#define IVT_REGO6XX_POLL_LOGI(...)      IVT_REGO6XX_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if (IVT_REGO6XX_POLL_LOG_LEVEL >= ESPHOME_LOG_LEVEL_DEBUG)
+#define IVT_REGO6XX_POLL_LOGD(...)      ESP_LOGD(__VA_ARGS__)
+#else
+#define IVT_REGO6XX_POLL_LOGD(...)      IVT_REGO6XX_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if (IVT_REGO6XX_WRITE_LOG_LEVEL >= ESPHOME_LOG_LEVEL_ERROR)
+#define IVT_REGO6XX_WRITE_LOGE(...)     ESP_LOGE(__VA_ARGS__)
+#else
+#define IVT_REGO6XX_WRITE_LOGE(...)     IVT_REGO6XX_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if (IVT_REGO6XX_WRITE_LOG_LEVEL >= ESPHOME_LOG_LEVEL_WARN)
+#define IVT_REGO6XX_WRITE_LOGW(...)     ESP_LOGW(__VA_ARGS__)
+#else
+#define IVT_REGO6XX_WRITE_LOGW(...)     IVT_REGO6XX_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if (IVT_REGO6XX_WRITE_LOG_LEVEL >= ESPHOME_LOG_LEVEL_INFO)
+#define IVT_REGO6XX_WRITE_LOGI(...)     ESP_LOGI(__VA_ARGS__)
+#else
+#define IVT_REGO6XX_WRITE_LOGI(...)     IVT_REGO6XX_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if (IVT_REGO6XX_WRITE_LOG_LEVEL >= ESPHOME_LOG_LEVEL_DEBUG)
+#define IVT_REGO6XX_WRITE_LOGD(...)     ESP_LOGD(__VA_ARGS__)
+#else
+#define IVT_REGO6XX_WRITE_LOGD(...)     IVT_REGO6XX_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
@@ -0,0 +1,256 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Main loop cost of the component
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IVTRego6xxLoopCost.h"
+#include <stdio.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+namespace esphome
+{
+namespace ivt_rego6xx_ctrl
+{
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Label values of the state handlers in the metrics. */
+static const char* HANDLER_LABELS[IVTRego6xxLoopCost::HANDLER_COUNT] = {
+    "buttons",
+    "number_updates",
+    "text_sensors",
+    "sensors",
+    "binary_sensors",
+    "numbers"
+};
+
+/** Percentiles of the loop durations in the metrics. */
+static const uint8_t DURATION_PERCENTILES[] = { 50U, 95U, 99U };
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+void IVTRego6xxLoopCost::addLoop(uint32_t duration)
+{
+    ++m_loops;
+    m_loopTime += duration;
+    m_durations.add(duration);
+
+    ++m_windowLoops;
+    m_windowTime += duration;
+    m_windowDurations.add(duration);
+
+    if (m_windowMin > duration)
+    {
+        m_windowMin = duration;
+    }
+
+    if (m_windowMax < duration)
+    {
+        m_windowMax = duration;
+    }
+}
+
+void IVTRego6xxLoopCost::addHandler(Handler handler, uint32_t duration)
+{
+    if (HANDLER_COUNT > handler)
+    {
+        HandlerCost& cost = m_handlers[handler];
+
+        ++cost.calls;
+        cost.time += duration;
+
+        if (cost.max < duration)
+        {
+            cost.max = duration;
+        }
+    }
+}
+
+void IVTRego6xxLoopCost::update(uint32_t transactions)
+{
+    /* The counter may wrap around, but the difference is still right. */
+    uint32_t windowTransactions = transactions - m_transactions;
+
+    if (0U < m_windowLoops)
+    {
+        m_min = m_windowMin;
+        m_avg = static_cast<float>(m_windowTime) / static_cast<float>(m_windowLoops);
+        m_max = m_windowMax;
+        m_p50 = m_windowDurations.getPercentile(50U);
+        m_p95 = m_windowDurations.getPercentile(95U);
+    }
+
+    if (0U < windowTransactions)
+    {
+        m_loopsPerTransaction = static_cast<float>(m_windowLoops) / static_cast<float>(windowTransactions);
+    }
+    else
+    {
+        /* No request finished, e.g. during the initial delay. */
+        m_loopsPerTransaction = 0.0F;
+    }
+
+    m_transactions = transactions;
+    m_windowDurations.clear();
+    m_windowLoops  = 0U;
+    m_windowTime   = 0U;
+    m_windowMin    = UINT32_MAX;
+    m_windowMax    = 0U;
+}
+
+float IVTRego6xxLoopCost::getMetric(IVTRego6xxLoopSensor::Metric metric) const
+{
+    float value = 0.0F;
+
+    switch (metric)
+    {
+    case IVTRego6xxLoopSensor::METRIC_MIN:
+        value = static_cast<float>(m_min);
+        break;
+
+    case IVTRego6xxLoopSensor::METRIC_AVG:
+        value = m_avg;
+        break;
+
+    case IVTRego6xxLoopSensor::METRIC_MAX:
+        value = static_cast<float>(m_max);
+        break;
+
+    case IVTRego6xxLoopSensor::METRIC_P50:
+        value = static_cast<float>(m_p50);
+        break;
+
+    case IVTRego6xxLoopSensor::METRIC_P95:
+        value = static_cast<float>(m_p95);
+        break;
+
+    case IVTRego6xxLoopSensor::METRIC_LOOPS_PER_TRANSACTION:
+        value = m_loopsPerTransaction;
+        break;
+
+    default:
+        break;
+    }
+
+    return value;
+}
+
+void IVTRego6xxLoopCost::writeMetrics(std::string& out) const
+{
+    char   line[112];
+    size_t idx = 0U;
+
+    out += "# TYPE ivt_rego6xx_loop_calls_total counter\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_loop_calls_total %u\n", static_cast<unsigned int>(m_loops));
+    out += line;
+
+    out += "# TYPE ivt_rego6xx_loop_seconds_total counter\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_loop_seconds_total %.6f\n", static_cast<double>(m_loopTime) / 1000000.0);
+    out += line;
+
+    out += "# TYPE ivt_rego6xx_loop_duration_microseconds summary\n";
+    for (idx = 0U; idx < (sizeof(DURATION_PERCENTILES) / sizeof(DURATION_PERCENTILES[0])); ++idx)
+    {
+        uint8_t percentile = DURATION_PERCENTILES[idx];
+
+        (void)snprintf(line, sizeof(line), "ivt_rego6xx_loop_duration_microseconds{quantile=\"0.%02u\"} %u\n", static_cast<unsigned int>(percentile), static_cast<unsigned int>(m_durations.getPercentile(percentile)));
+        out += line;
+    }
+
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_loop_duration_microseconds{quantile=\"1\"} %u\n", static_cast<unsigned int>(m_durations.getMax()));
+    out += line;
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_loop_duration_microseconds_count %u\n", static_cast<unsigned int>(m_durations.getCount()));
+    out += line;
+
+    out += "# TYPE ivt_rego6xx_loops_per_transaction gauge\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_loops_per_transaction %.3f\n", m_loopsPerTransaction);
+    out += line;
+
+    out += "# TYPE ivt_rego6xx_handler_calls_total counter\n";
+    for (idx = 0U; idx < HANDLER_COUNT; ++idx)
+    {
+        (void)snprintf(line, sizeof(line), "ivt_rego6xx_handler_calls_total{state=\"%s\"} %u\n", HANDLER_LABELS[idx], static_cast<unsigned int>(m_handlers[idx].calls));
+        out += line;
+    }
+
+    out += "# TYPE ivt_rego6xx_handler_seconds_total counter\n";
+    for (idx = 0U; idx < HANDLER_COUNT; ++idx)
+    {
+        (void)snprintf(line, sizeof(line), "ivt_rego6xx_handler_seconds_total{state=\"%s\"} %.6f\n", HANDLER_LABELS[idx], static_cast<double>(m_handlers[idx].time) / 1000000.0);
+        out += line;
+    }
+
+    out += "# TYPE ivt_rego6xx_handler_max_microseconds gauge\n";
+    for (idx = 0U; idx < HANDLER_COUNT; ++idx)
+    {
+        (void)snprintf(line, sizeof(line), "ivt_rego6xx_handler_max_microseconds{state=\"%s\"} %u\n", HANDLER_LABELS[idx], static_cast<unsigned int>(m_handlers[idx].max));
+        out += line;
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
@@ -0,0 +1,209 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Main loop cost of the component
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <stdint.h>
+#include "Histogram.hpp"
+#include "sensor/IVTRego6xxLoopSensor.h"
+#include <string>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * Measures the CPU time, which the component takes from the ESPHome main loop.
+ * This includes the log formatting, the entity name lookups and the string
+ * decoding of every request.
+ *
+ * The duration of every loop call and of every state handler call is kept in
+ * total since startup. The minimum, average, maximum and percentiles of the
+ * loop calls as well as the loop calls per finished request are additionally
+ * calculated per window, which is closed by every update.
+ */
+class IVTRego6xxLoopCost
+{
+public:
+
+    /**
+     * State handlers of the polling state machine, same order as its states.
+     */
+    enum Handler
+    {
+        HANDLER_BUTTONS = 0U,       /**< Handle buttons. */
+        HANDLER_NUMBER_UPDATES,     /**< Handle number updates. */
+        HANDLER_TEXT_SENSORS,       /**< Handle text sensors. */
+        HANDLER_SENSORS,            /**< Handle sensors. */
+        HANDLER_BINARY_SENSORS,     /**< Handle binary sensors. */
+        HANDLER_NUMBERS,            /**< Handle numbers. */
+        HANDLER_COUNT               /**< Number of state handlers. */
+    };
+
+    /**
+     * Histogram of durations in us, which resolves up to about 1 s.
+     */
+    typedef Histogram<3U, 20U> DurationHistogram;
+
+    /**
+     * Constructs the main loop cost.
+     */
+    IVTRego6xxLoopCost() :
+        m_loops(0U),
+        m_loopTime(0U),
+        m_durations(),
+        m_handlers(),
+        m_windowDurations(),
+        m_windowLoops(0U),
+        m_windowTime(0U),
+        m_windowMin(UINT32_MAX),
+        m_windowMax(0U),
+        m_transactions(0U),
+        m_min(0U),
+        m_avg(0.0F),
+        m_max(0U),
+        m_p50(0U),
+        m_p95(0U),
+        m_loopsPerTransaction(0.0F)
+    {
+    }
+
+    /**
+     * Destroys the main loop cost.
+     */
+    ~IVTRego6xxLoopCost()
+    {
+    }
+
+    /**
+     * Add the duration of a loop call.
+     *
+     * @param[in] duration  Duration in us
+     */
+    void addLoop(uint32_t duration);
+
+    /**
+     * Add the duration of a state handler call.
+     *
+     * @param[in] handler   State handler
+     * @param[in] duration  Duration in us
+     */
+    void addHandler(Handler handler, uint32_t duration);
+
+    /**
+     * Close the current window and calculate its statistics.
+     *
+     * @param[in] transactions  Number of finished requests since startup.
+     */
+    void update(uint32_t transactions);
+
+    /**
+     * Get the value of a metric of the last closed window, like it is
+     * published by a main loop cost sensor.
+     *
+     * @param[in] metric    Metric
+     *
+     * @return Value of the metric
+     */
+    float getMetric(IVTRego6xxLoopSensor::Metric metric) const;
+
+    /**
+     * Append the totals since startup in the Prometheus text format.
+     *
+     * @param[out] out  Output
+     */
+    void writeMetrics(std::string& out) const;
+
+private:
+
+    /**
+     * Durations of a single state handler.
+     */
+    struct HandlerCost
+    {
+        uint32_t calls;     /**< Number of calls */
+        uint64_t time;      /**< Sum of all durations in us */
+        uint32_t max;       /**< Maximum duration in us */
+    };
+
+    uint32_t          m_loops;                   /**< Number of loop calls since startup. */
+    uint64_t          m_loopTime;                /**< Sum of all loop durations since startup in us. */
+    DurationHistogram m_durations;               /**< Loop durations since startup. */
+    HandlerCost       m_handlers[HANDLER_COUNT]; /**< Durations per state handler since startup. */
+    DurationHistogram m_windowDurations;         /**< Loop durations of the current window. */
+    uint32_t          m_windowLoops;             /**< Number of loop calls in the current window. */
+    uint64_t          m_windowTime;              /**< Sum of the loop durations in the current window in us. */
+    uint32_t          m_windowMin;               /**< Minimum loop duration in the current window in us. */
+    uint32_t          m_windowMax;               /**< Maximum loop duration in the current window in us. */
+    uint32_t          m_transactions;            /**< Number of finished requests at the last update. */
+    uint32_t          m_min;                     /**< Minimum loop duration of the last window in us. */
+    float             m_avg;                     /**< Average loop duration of the last window in us. */
+    uint32_t          m_max;                     /**< Maximum loop duration of the last window in us. */
+    uint32_t          m_p50;                     /**< Median loop duration of the last window in us. */
+    uint32_t          m_p95;                     /**< 95th percentile of the loop duration of the last window in us. */
+    float             m_loopsPerTransaction;     /**< Loop calls per finished request of the last window. */
+
+    IVTRego6xxLoopCost(const IVTRego6xxLoopCost& other);
+    IVTRego6xxLoopCost& operator=(const IVTRego6xxLoopCost& other);
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
@@ -0,0 +1,756 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  IVT rego6xx controller Modbus TCP server
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IVTRego6xxModbusServer.h"
+
+#ifdef IVT_REGO6XX_MODBUS
+
+#include "esphome/core/log.h"
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+namespace esphome
+{
+namespace ivt_rego6xx_ctrl
+{
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static uint16_t getU16(const uint8_t* buffer);
+static void putU16(uint8_t* buffer, uint16_t value);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Logging tag */
+static const char* TAG = "ivt_rego6xx_ctrl.modbus";
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool IVTRego6xxModbusServer::addInputRegister(const EntityBase* entity, uint16_t addr)
+{
+    return addRegister(addr, entity, nullptr);
+}
+
+bool IVTRego6xxModbusServer::addHoldingRegister(IVTRego6xxNumber* number)
+{
+    bool isSuccessful = false;
+
+    if (nullptr != number)
+    {
+        isSuccessful = addRegister(number->getAddr(), number, number);
+    }
+
+    return isSuccessful;
+}
+
+void IVTRego6xxModbusServer::begin(const IVTRego6xxTelemetry* cache)
+{
+    m_cache = cache;
+
+    if (false == listen())
+    {
+        m_listenRetryTimer.start(LISTEN_RETRY_PERIOD);
+    }
+}
+
+void IVTRego6xxModbusServer::process()
+{
+    size_t idx = 0U;
+
+    if (nullptr == m_socket)
+    {
+        if (true == m_listenRetryTimer.isTimeout())
+        {
+            if (false == listen())
+            {
+                m_listenRetryTimer.restart();
+            }
+            else
+            {
+                m_listenRetryTimer.stop();
+            }
+        }
+    }
+    else
+    {
+        acceptClients();
+    }
+
+    for (idx = 0U; idx < MAX_CLIENTS; ++idx)
+    {
+        Client& client = m_clients[idx];
+
+        if (nullptr != client.socket)
+        {
+            receive(client);
+        }
+
+        /* A write, which is not confirmed in time, fails. The heatpump
+         * may still apply it later.
+         */
+        if ((nullptr != client.socket) &&
+            (0U < client.pendingWrites) &&
+            (WRITE_TIMEOUT <= (SimpleTimer::now() - client.writeTimestamp)))
+        {
+            ESP_LOGW(TAG, "Write not confirmed in time.");
+
+            m_writesFailed      += releaseWrites(client);
+            client.isWriteFailed = true;
+            client.pendingWrites = 0U;
+            finishWrite(client);
+        }
+
+        if (nullptr != client.socket)
+        {
+            handleRequests(client);
+        }
+    }
+}
+
+void IVTRego6xxModbusServer::confirmWrite(const IVTRego6xxNumber* number, bool isSuccessful)
+{
+    size_t idx = 0U;
+
+    for (idx = 0U; idx < m_registerCount; ++idx)
+    {
+        Register& reg = m_registers[idx];
+
+        if ((number == reg.number) &&
+            (nullptr != reg.writer))
+        {
+            Client& client = *reg.writer;
+
+            reg.writer = nullptr;
+
+            if (true == isSuccessful)
+            {
+                ++m_writesConfirmed;
+            }
+            else
+            {
+                ++m_writesFailed;
+                client.isWriteFailed = true;
+            }
+
+            if (0U < client.pendingWrites)
+            {
+                --client.pendingWrites;
+
+                if (0U == client.pendingWrites)
+                {
+                    finishWrite(client);
+                }
+            }
+        }
+    }
+}
+
+void IVTRego6xxModbusServer::writeMetrics(std::string& out) const
+{
+    char   line[80];
+    size_t clients = 0U;
+    size_t idx     = 0U;
+
+    for (idx = 0U; idx < MAX_CLIENTS; ++idx)
+    {
+        if (nullptr != m_clients[idx].socket)
+        {
+            ++clients;
+        }
+    }
+
+    out += "# TYPE ivt_rego6xx_modbus_clients gauge\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_modbus_clients %u\n", static_cast<unsigned int>(clients));
+    out += line;
+
+    out += "# TYPE ivt_rego6xx_modbus_requests_total counter\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_modbus_requests_total %u\n", static_cast<unsigned int>(m_requests));
+    out += line;
+
+    out += "# TYPE ivt_rego6xx_modbus_exceptions_total counter\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_modbus_exceptions_total %u\n", static_cast<unsigned int>(m_exceptions));
+    out += line;
+
+    out += "# TYPE ivt_rego6xx_modbus_writes_total counter\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_modbus_writes_total{result=\"confirmed\"} %u\n", static_cast<unsigned int>(m_writesConfirmed));
+    out += line;
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_modbus_writes_total{result=\"failed\"} %u\n", static_cast<unsigned int>(m_writesFailed));
+    out += line;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+bool IVTRego6xxModbusServer::addRegister(uint16_t addr, const EntityBase* entity, IVTRego6xxNumber* number)
+{
+    bool isSuccessful = false;
+
+    if ((nullptr != entity) &&
+        (MAX_REGISTERS > m_registerCount))
+    {
+        if (nullptr != findRegister(addr, nullptr != number))
+        {
+            ESP_LOGE(TAG, "Register 0x%04X of '%s' is already in use.", addr, entity->get_name().c_str());
+        }
+        else
+        {
+            Register& reg = m_registers[m_registerCount];
+
+            reg.addr   = addr;
+            reg.entity = entity;
+            reg.number = number;
+            reg.writer = nullptr;
+
+            ++m_registerCount;
+            isSuccessful = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+IVTRego6xxModbusServer::Register* IVTRego6xxModbusServer::findRegister(uint32_t addr, bool isHolding)
+{
+    Register* reg = nullptr;
+    size_t    idx = 0U;
+
+    while ((nullptr == reg) && (idx < m_registerCount))
+    {
+        if ((addr == m_registers[idx].addr) &&
+            (isHolding == (nullptr != m_registers[idx].number)))
+        {
+            reg = &m_registers[idx];
+        }
+
+        ++idx;
+    }
+
+    return reg;
+}
+
+bool IVTRego6xxModbusServer::listen()
+{
+    bool                    isSuccessful = false;
+    int                     enable       = 1;
+    struct sockaddr_storage server;
+    socklen_t               serverLen    = socket::set_sockaddr_any(reinterpret_cast<struct sockaddr*>(&server), sizeof(server), m_port);
+
+    m_socket = socket::socket_ip(SOCK_STREAM, 0);
+
+    if (nullptr == m_socket)
+    {
+        ESP_LOGE(TAG, "Failed to create the socket, errno %d.", errno);
+    }
+    else if ((0 != m_socket->setsockopt(SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable))) ||
+             (0 != m_socket->setblocking(false)) ||
+             (0 != m_socket->bind(reinterpret_cast<struct sockaddr*>(&server), serverLen)) ||
+             (0 != m_socket->listen(static_cast<int>(MAX_CLIENTS))))
+    {
+        ESP_LOGE(TAG, "Failed to listen on port %u, errno %d.", static_cast<unsigned int>(m_port), errno);
+
+        (void)m_socket->close();
+        m_socket.reset();
+    }
+    else
+    {
+        ESP_LOGI(TAG, "Listening on port %u.", static_cast<unsigned int>(m_port));
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+void IVTRego6xxModbusServer::acceptClients()
+{
+    bool isAccepted = false;
+
+    do
+    {
+        struct sockaddr_storage         source;
+        socklen_t                       sourceLen = sizeof(source);
+        std::unique_ptr<socket::Socket> socket    = m_socket->accept(reinterpret_cast<struct sockaddr*>(&source), &sourceLen);
+
+        isAccepted = (nullptr != socket);
+
+        if (true == isAccepted)
+        {
+            Client* client = getFreeClient();
+
+            if (nullptr == client)
+            {
+                ESP_LOGW(TAG, "Client rejected, all clients have a pending write.");
+                (void)socket->close();
+            }
+            else
+            {
+                int enable = 1;
+
+                (void)socket->setblocking(false);
+                (void)socket->setsockopt(IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+                client->socket        = std::move(socket);
+                client->rxSize        = 0U;
+                client->lastActivity  = SimpleTimer::now();
+                client->pendingWrites = 0U;
+                client->isWriteFailed = false;
+
+                ESP_LOGD(TAG, "Client %s connected.", client->socket->getpeername().c_str());
+            }
+        }
+    }
+    while (true == isAccepted);
+}
+
+IVTRego6xxModbusServer::Client* IVTRego6xxModbusServer::getFreeClient()
+{
+    Client* client = nullptr;
+    Client* oldest = nullptr;
+    size_t  idx    = 0U;
+
+    while ((nullptr == client) && (idx < MAX_CLIENTS))
+    {
+        Client& candidate = m_clients[idx];
+
+        if (nullptr == candidate.socket)
+        {
+            client = &candidate;
+        }
+        else if ((0U == candidate.pendingWrites) &&
+                 ((nullptr == oldest) || ((SimpleTimer::now() - candidate.lastActivity) > (SimpleTimer::now() - oldest->lastActivity))))
+        {
+            oldest = &candidate;
+        }
+        else
+        {
+            ;
+        }
+
+        ++idx;
+    }
+
+    if ((nullptr == client) &&
+        (nullptr != oldest))
+    {
+        ESP_LOGD(TAG, "Least recently active client closed.");
+        closeClient(*oldest);
+        client = oldest;
+    }
+
+    return client;
+}
+
+void IVTRego6xxModbusServer::receive(Client& client)
+{
+    /* If the buffer is full, the client waits for a pending write. */
+    if (sizeof(client.rx) > client.rxSize)
+    {
+        ssize_t received = client.socket->read(&client.rx[client.rxSize], sizeof(client.rx) - client.rxSize);
+
+        if (0 < received)
+        {
+            client.rxSize       += static_cast<size_t>(received);
+            client.lastActivity  = SimpleTimer::now();
+        }
+        else if ((0 == received) ||
+                 ((EWOULDBLOCK != errno) && (EAGAIN != errno)))
+        {
+            ESP_LOGD(TAG, "Client disconnected.");
+            closeClient(client);
+        }
+        else
+        {
+            /* No data available. */
+            ;
+        }
+    }
+}
+
+void IVTRego6xxModbusServer::handleRequests(Client& client)
+{
+    bool isComplete = true;
+
+    /* Requests are handled in order, therefore a pending write blocks the following ones. */
+    while ((true == isComplete) &&
+           (nullptr != client.socket) &&
+           (0U == client.pendingWrites) &&
+           (MBAP_SIZE <= client.rxSize))
+    {
+        uint16_t protocolId = getU16(&client.rx[2U]);
+        uint16_t length     = getU16(&client.rx[4U]);
+        size_t   frameSize  = 6U + length;
+
+        /* The length contains the unit id and at least the function code. */
+        if ((0U != protocolId) ||
+            (2U > length) ||
+            (MAX_FRAME_SIZE < frameSize))
+        {
+            ESP_LOGW(TAG, "Invalid frame, client closed.");
+            closeClient(client);
+        }
+        else if (client.rxSize < frameSize)
+        {
+            isComplete = false;
+        }
+        else
+        {
+            handleRequest(client, client.rx, frameSize);
+
+            /* The client may be closed due to a failed response. */
+            if (nullptr != client.socket)
+            {
+                client.rxSize -= frameSize;
+                memmove(client.rx, &client.rx[frameSize], client.rxSize);
+            }
+        }
+    }
+}
+
+void IVTRego6xxModbusServer::handleRequest(Client& client, const uint8_t* frame, size_t size)
+{
+    const uint8_t* pdu       = &frame[MBAP_SIZE];
+    size_t         pduSize   = size - MBAP_SIZE;
+    uint8_t        rsp[MAX_FRAME_SIZE];
+    size_t         rspSize   = 0U;
+    ExceptionCode  exception = EXCEPTION_NONE;
+
+    ++m_requests;
+
+    switch (pdu[0U])
+    {
+    case FC_READ_HOLDING_REGISTERS:
+        exception = readRegisters(pdu, pduSize, true, &rsp[MBAP_SIZE], rspSize);
+        break;
+
+    case FC_READ_INPUT_REGISTERS:
+        exception = readRegisters(pdu, pduSize, false, &rsp[MBAP_SIZE], rspSize);
+        break;
+
+    case FC_WRITE_SINGLE_REGISTER:
+        if (5U != pduSize)
+        {
+            exception = EXCEPTION_ILLEGAL_DATA_VALUE;
+        }
+        else
+        {
+            exception = writeRegisters(client, getU16(&pdu[1U]), &pdu[3U], 1U);
+        }
+        break;
+
+    case FC_WRITE_MULTIPLE_REGISTERS:
+        if ((6U > pduSize) ||
+            (0U == getU16(&pdu[3U])) ||
+            (MAX_WRITE_REGISTERS < getU16(&pdu[3U])) ||
+            ((2U * getU16(&pdu[3U])) != pdu[5U]) ||
+            ((6U + pdu[5U]) != pduSize))
+        {
+            exception = EXCEPTION_ILLEGAL_DATA_VALUE;
+        }
+        else
+        {
+            exception = writeRegisters(client, getU16(&pdu[1U]), &pdu[6U], getU16(&pdu[3U]));
+        }
+        break;
+
+    default:
+        exception = EXCEPTION_ILLEGAL_FUNCTION;
+        break;
+    }
+
+    if (EXCEPTION_NONE != exception)
+    {
+        ++m_exceptions;
+
+        rsp[MBAP_SIZE]      = pdu[0U] | 0x80U;
+        rsp[MBAP_SIZE + 1U] = exception;
+        rspSize             = 2U;
+    }
+    /* A write is answered after it is confirmed. Both write responses
+     * echo the function code, the address and the value or quantity.
+     */
+    else if (0U < client.pendingWrites)
+    {
+        memcpy(client.writeRsp, frame, MBAP_SIZE + 5U);
+        putU16(&client.writeRsp[4U], 6U);
+    }
+    else
+    {
+        ;
+    }
+
+    if (0U < rspSize)
+    {
+        memcpy(rsp, frame, MBAP_SIZE);
+        putU16(&rsp[4U], static_cast<uint16_t>(rspSize + 1U));
+        send(client, rsp, MBAP_SIZE + rspSize);
+    }
+}
+
+IVTRego6xxModbusServer::ExceptionCode IVTRego6xxModbusServer::readRegisters(const uint8_t* pdu, size_t pduSize, bool isHolding, uint8_t* rsp, size_t& rspSize)
+{
+    ExceptionCode exception = EXCEPTION_NONE;
+
+    if (5U != pduSize)
+    {
+        exception = EXCEPTION_ILLEGAL_DATA_VALUE;
+    }
+    else
+    {
+        uint16_t addr  = getU16(&pdu[1U]);
+        uint16_t count = getU16(&pdu[3U]);
+        uint16_t idx   = 0U;
+
+        if ((0U == count) ||
+            (MAX_READ_REGISTERS < count))
+        {
+            exception = EXCEPTION_ILLEGAL_DATA_VALUE;
+        }
+
+        while ((EXCEPTION_NONE == exception) && (idx < count))
+        {
+            const Register* reg   = findRegister(static_cast<uint32_t>(addr) + idx, isHolding);
+            uint16_t        value = VALUE_UNKNOWN;
+
+            if (nullptr == reg)
+            {
+                exception = EXCEPTION_ILLEGAL_DATA_ADDRESS;
+            }
+            else
+            {
+                if (nullptr != m_cache)
+                {
+                    (void)m_cache->getValue(reg->entity, value);
+                }
+
+                putU16(&rsp[2U + (2U * idx)], value);
+            }
+
+            ++idx;
+        }
+
+        if (EXCEPTION_NONE == exception)
+        {
+            rsp[0U] = pdu[0U];
+            rsp[1U] = static_cast<uint8_t>(2U * count);
+            rspSize = 2U + (2U * count);
+        }
+    }
+
+    return exception;
+}
+
+IVTRego6xxModbusServer::ExceptionCode IVTRego6xxModbusServer::writeRegisters(Client& client, uint16_t addr, const uint8_t* values, uint16_t count)
+{
+    ExceptionCode exception = EXCEPTION_NONE;
+    uint16_t      idx       = 0U;
+
+    /* Validate all registers first, so a request is written completely or not at all. */
+    while ((EXCEPTION_NONE == exception) && (idx < count))
+    {
+        const Register* reg = findRegister(static_cast<uint32_t>(addr) + idx, true);
+
+        if (nullptr == reg)
+        {
+            exception = EXCEPTION_ILLEGAL_DATA_ADDRESS;
+        }
+        else if (nullptr != reg->writer)
+        {
+            exception = EXCEPTION_SERVER_DEVICE_BUSY;
+        }
+        else
+        {
+            /* The register holds the raw value of the heatpump, a signed fixed point value with one decimal. */
+            float value = static_cast<int16_t>(getU16(&values[2U * idx])) / 10.0F;
+
+            if ((reg->number->traits.get_min_value() > value) ||
+                (reg->number->traits.get_max_value() < value))
+            {
+                exception = EXCEPTION_ILLEGAL_DATA_VALUE;
+            }
+        }
+
+        ++idx;
+    }
+
+    for (idx = 0U; (EXCEPTION_NONE == exception) && (idx < count); ++idx)
+    {
+        Register* reg   = findRegister(static_cast<uint32_t>(addr) + idx, true);
+        float     value = static_cast<int16_t>(getU16(&values[2U * idx])) / 10.0F;
+
+        ESP_LOGD(TAG, "Write '%s' with %.1f requested.", reg->entity->get_name().c_str(), static_cast<double>(value));
+
+        /* The write is queued like an update from Home Assistant. */
+        reg->writer = &client;
+        reg->number->make_call().set_value(value).perform();
+
+        ++client.pendingWrites;
+    }
+
+    if (EXCEPTION_NONE == exception)
+    {
+        client.isWriteFailed  = false;
+        client.writeTimestamp = SimpleTimer::now();
+    }
+
+    return exception;
+}
+
+void IVTRego6xxModbusServer::finishWrite(Client& client)
+{
+    if (nullptr != client.socket)
+    {
+        if (true == client.isWriteFailed)
+        {
+            uint8_t rsp[MBAP_SIZE + 2U];
+
+            ++m_exceptions;
+
+            memcpy(rsp, client.writeRsp, MBAP_SIZE);
+            putU16(&rsp[4U], 3U);
+            rsp[MBAP_SIZE]      = client.writeRsp[MBAP_SIZE] | 0x80U;
+            rsp[MBAP_SIZE + 1U] = EXCEPTION_SERVER_DEVICE_FAILURE;
+
+            send(client, rsp, sizeof(rsp));
+        }
+        else
+        {
+            send(client, client.writeRsp, sizeof(client.writeRsp));
+        }
+    }
+
+    client.isWriteFailed = false;
+}
+
+void IVTRego6xxModbusServer::send(Client& client, const uint8_t* frame, size_t size)
+{
+    ssize_t written = client.socket->write(frame, size);
+
+    if (static_cast<ssize_t>(size) != written)
+    {
+        ESP_LOGW(TAG, "Failed to send response, client closed.");
+        closeClient(client);
+    }
+}
+
+void IVTRego6xxModbusServer::closeClient(Client& client)
+{
+    (void)releaseWrites(client);
+
+    if (nullptr != client.socket)
+    {
+        (void)client.socket->close();
+        client.socket.reset();
+    }
+
+    client.rxSize        = 0U;
+    client.pendingWrites = 0U;
+    client.isWriteFailed = false;
+}
+
+size_t IVTRego6xxModbusServer::releaseWrites(const Client& client)
+{
+    size_t released = 0U;
+    size_t idx      = 0U;
+
+    for (idx = 0U; idx < m_registerCount; ++idx)
+    {
+        if (&client == m_registers[idx].writer)
+        {
+            m_registers[idx].writer = nullptr;
+            ++released;
+        }
+    }
+
+    return released;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Get a big endian 16-bit value.
+ *
+ * @param[in] buffer    Buffer
+ *
+ * @return Value
+ */
+static uint16_t getU16(const uint8_t* buffer)
+{
+    return static_cast<uint16_t>((static_cast<uint16_t>(buffer[0U]) << 8U) | buffer[1U]);
+}
+
+/**
+ * Put a 16-bit value in big endian.
+ *
+ * @param[out] buffer   Buffer
+ * @param[in]  value    Value
+ */
+static void putU16(uint8_t* buffer, uint16_t value)
+{
+    buffer[0U] = static_cast<uint8_t>((value >> 8U) & 0xFFU);
+    buffer[1U] = static_cast<uint8_t>(value & 0xFFU);
+}
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+#endif /* IVT_REGO6XX_MODBUS */
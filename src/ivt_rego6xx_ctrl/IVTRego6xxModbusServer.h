@@ -0,0 +1,429 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  IVT rego6xx controller Modbus TCP server
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "esphome/core/defines.h"
+
+#ifdef IVT_REGO6XX_MODBUS
+
+#include <stdint.h>
+#include "esphome/core/component.h"
+#include "esphome/components/socket/socket.h"
+#include "SimpleTimer.hpp"
+#include "IVTRego6xxTelemetry.h"
+#include "number/IVTRego6xxNumber.h"
+#include <memory>
+#include <string>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * Modbus TCP server, which provides the entity values as registers.
+ *
+ * The register address is the system register address of the heatpump.
+ * The sensors and binary sensors are input registers, the numbers are
+ * holding registers. Reads are served from the cached raw values and never
+ * access the heatpump. A not yet read value is 0x8000.
+ *
+ * A write is validated against the range of the number and requested like
+ * an update from Home Assistant. The response is sent after the heatpump
+ * confirmed the write, until then further requests of the client wait.
+ * Several clients are served, the least recently active one is closed if a
+ * new client connects and all slots are in use.
+ */
+class IVTRego6xxModbusServer
+{
+public:
+
+    /** Default TCP port. */
+    static const uint16_t DEFAULT_PORT        = 502U;
+
+    /** Maximum number of concurrent clients. */
+    static const size_t   MAX_CLIENTS         = 4U;
+
+    /** Maximum number of registers, which covers all sensors, binary sensors and numbers. */
+    static const size_t   MAX_REGISTERS       = IVTRego6xxTelemetry::MAX_ENTITIES;
+
+    /** Register value of a not yet read entity. */
+    static const uint16_t VALUE_UNKNOWN       = 0x8000U;
+
+    /** Time in ms, after which a not confirmed write fails. */
+    static const uint32_t WRITE_TIMEOUT       = SIMPLE_TIMER_SECONDS(10U);
+
+    /** Time in ms between two attempts to open the server socket. */
+    static const uint32_t LISTEN_RETRY_PERIOD = SIMPLE_TIMER_SECONDS(10U);
+
+    /**
+     * Constructs the Modbus TCP server.
+     */
+    IVTRego6xxModbusServer() :
+        m_port(DEFAULT_PORT),
+        m_cache(nullptr),
+        m_socket(nullptr),
+        m_listenRetryTimer(),
+        m_registerCount(0U),
+        m_registers(),
+        m_clients(),
+        m_requests(0U),
+        m_exceptions(0U),
+        m_writesConfirmed(0U),
+        m_writesFailed(0U)
+    {
+    }
+
+    /**
+     * Destroys the Modbus TCP server.
+     */
+    ~IVTRego6xxModbusServer()
+    {
+    }
+
+    /**
+     * Set the TCP port.
+     *
+     * @param[in] port  TCP port
+     */
+    void setPort(uint16_t port)
+    {
+        m_port = port;
+    }
+
+    /**
+     * Get the TCP port.
+     *
+     * @return TCP port
+     */
+    uint16_t getPort() const
+    {
+        return m_port;
+    }
+
+    /**
+     * Add a sensor or binary sensor as input register.
+     *
+     * @param[in] entity    Entity
+     * @param[in] addr      Register address
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addInputRegister(const EntityBase* entity, uint16_t addr);
+
+    /**
+     * Add a number as holding register at its address.
+     *
+     * @param[in] number    Number
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addHoldingRegister(IVTRego6xxNumber* number);
+
+    /**
+     * Get the number of registers.
+     *
+     * @return Number of registers
+     */
+    size_t getRegisterCount() const
+    {
+        return m_registerCount;
+    }
+
+    /**
+     * Start the server.
+     *
+     * @param[in] cache Cached entity values, which are served.
+     */
+    void begin(const IVTRego6xxTelemetry* cache);
+
+    /**
+     * Accept new clients and handle their requests.
+     */
+    void process();
+
+    /**
+     * Confirm the write of a number, after the heatpump responded.
+     * A write, which wasn't requested by a client, is ignored.
+     *
+     * @param[in] number        Number
+     * @param[in] isSuccessful  Is the write successful?
+     */
+    void confirmWrite(const IVTRego6xxNumber* number, bool isSuccessful);
+
+    /**
+     * Append the clients, requests and writes in the Prometheus text format.
+     *
+     * @param[out] out  Output
+     */
+    void writeMetrics(std::string& out) const;
+
+private:
+
+    /** Size of the MBAP header in byte. */
+    static const size_t   MBAP_SIZE           = 7U;
+
+    /** Maximum size of a frame (MBAP header and PDU) in byte. */
+    static const size_t   MAX_FRAME_SIZE      = 260U;
+
+    /** Size of a write response frame in byte. */
+    static const size_t   WRITE_RSP_SIZE      = 12U;
+
+    /** Maximum number of registers, which can be read by a single request. */
+    static const uint16_t MAX_READ_REGISTERS  = 125U;
+
+    /** Maximum number of registers, which can be written by a single request. */
+    static const uint16_t MAX_WRITE_REGISTERS = 123U;
+
+    /**
+     * Supported function codes.
+     */
+    enum FunctionCode
+    {
+        FC_READ_HOLDING_REGISTERS   = 0x03U, /**< Read holding registers */
+        FC_READ_INPUT_REGISTERS     = 0x04U, /**< Read input registers */
+        FC_WRITE_SINGLE_REGISTER    = 0x06U, /**< Write single register */
+        FC_WRITE_MULTIPLE_REGISTERS = 0x10U  /**< Write multiple registers */
+    };
+
+    /**
+     * Exception codes.
+     */
+    enum ExceptionCode
+    {
+        EXCEPTION_NONE                  = 0x00U, /**< No exception */
+        EXCEPTION_ILLEGAL_FUNCTION      = 0x01U, /**< Function code not supported */
+        EXCEPTION_ILLEGAL_DATA_ADDRESS  = 0x02U, /**< Register not available */
+        EXCEPTION_ILLEGAL_DATA_VALUE    = 0x03U, /**< Invalid request or value out of range */
+        EXCEPTION_SERVER_DEVICE_FAILURE = 0x04U, /**< Write failed or not confirmed */
+        EXCEPTION_SERVER_DEVICE_BUSY    = 0x06U  /**< Write of the register is pending */
+    };
+
+    struct Client;
+
+    /**
+     * A register, which is mapped to an entity.
+     */
+    struct Register
+    {
+        uint16_t          addr;   /**< Register address */
+        const EntityBase* entity; /**< Entity, whose cached value is served. */
+        IVTRego6xxNumber* number; /**< Number, if it is a holding register otherwise nullptr. */
+        Client*           writer; /**< Client, whose write is pending, otherwise nullptr. */
+    };
+
+    /**
+     * A connected client.
+     */
+    struct Client
+    {
+        std::unique_ptr<socket::Socket> socket;                   /**< Client socket, nullptr if the slot is free. */
+        uint8_t                         rx[MAX_FRAME_SIZE];       /**< Received, not yet handled data */
+        size_t                          rxSize;                   /**< Number of received bytes */
+        uint32_t                        lastActivity;             /**< Timestamp in ms of the last received data */
+        size_t                          pendingWrites;            /**< Number of not yet confirmed register writes */
+        bool                            isWriteFailed;            /**< Is any register write of the request failed? */
+        uint32_t                        writeTimestamp;           /**< Timestamp in ms of the pending write request */
+        uint8_t                         writeRsp[WRITE_RSP_SIZE]; /**< Response of the pending write request */
+    };
+
+    uint16_t                        m_port;                     /**< TCP port */
+    const IVTRego6xxTelemetry*      m_cache;                    /**< Cached entity values */
+    std::unique_ptr<socket::Socket> m_socket;                   /**< Server socket */
+    SimpleTimer                     m_listenRetryTimer;         /**< Timer used to retry opening the server socket. */
+    size_t                          m_registerCount;            /**< Number of registers */
+    Register                        m_registers[MAX_REGISTERS]; /**< Registers */
+    Client                          m_clients[MAX_CLIENTS];     /**< Client slots */
+    uint32_t                        m_requests;                 /**< Number of handled requests */
+    uint32_t                        m_exceptions;               /**< Number of exception responses */
+    uint32_t                        m_writesConfirmed;          /**< Number of confirmed register writes */
+    uint32_t                        m_writesFailed;             /**< Number of failed register writes */
+
+    IVTRego6xxModbusServer(const IVTRego6xxModbusServer& other);
+    IVTRego6xxModbusServer& operator=(const IVTRego6xxModbusServer& other);
+
+    /**
+     * Add a register.
+     *
+     * @param[in] addr      Register address
+     * @param[in] entity    Entity
+     * @param[in] number    Number, if it is a holding register otherwise nullptr.
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addRegister(uint16_t addr, const EntityBase* entity, IVTRego6xxNumber* number);
+
+    /**
+     * Find a register.
+     *
+     * @param[in] addr          Register address, may be out of the 16-bit range.
+     * @param[in] isHolding     Is a holding register requested, otherwise an input register?
+     *
+     * @return Register or nullptr if not available.
+     */
+    Register* findRegister(uint32_t addr, bool isHolding);
+
+    /**
+     * Open the server socket.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool listen();
+
+    /**
+     * Accept all pending connections.
+     */
+    void acceptClients();
+
+    /**
+     * Get a slot for a new client. If all slots are in use, the least
+     * recently active client without pending write is closed.
+     *
+     * @return Client slot or nullptr if none is available.
+     */
+    Client* getFreeClient();
+
+    /**
+     * Receive data from a client.
+     *
+     * @param[in] client    Client
+     */
+    void receive(Client& client);
+
+    /**
+     * Handle all complete requests of a client, until a write is pending.
+     *
+     * @param[in] client    Client
+     */
+    void handleRequests(Client& client);
+
+    /**
+     * Handle a single request and send its response, except for a pending write.
+     *
+     * @param[in] client    Client
+     * @param[in] frame     Request frame
+     * @param[in] size      Request frame size in byte
+     */
+    void handleRequest(Client& client, const uint8_t* frame, size_t size);
+
+    /**
+     * Read registers from the cache.
+     *
+     * @param[in]  pdu          Request PDU
+     * @param[in]  pduSize      Request PDU size in byte
+     * @param[in]  isHolding    Are holding registers requested, otherwise input registers?
+     * @param[out] rsp          Response PDU
+     * @param[out] rspSize      Response PDU size in byte
+     *
+     * @return Exception code
+     */
+    ExceptionCode readRegisters(const uint8_t* pdu, size_t pduSize, bool isHolding, uint8_t* rsp, size_t& rspSize);
+
+    /**
+     * Validate the values of consecutive holding registers and request their writes.
+     *
+     * @param[in] client    Client
+     * @param[in] addr      Address of the first register
+     * @param[in] values    Register values, big endian
+     * @param[in] count     Number of registers
+     *
+     * @return Exception code
+     */
+    ExceptionCode writeRegisters(Client& client, uint16_t addr, const uint8_t* values, uint16_t count);
+
+    /**
+     * Send the response of the pending write request, after all its writes are done.
+     *
+     * @param[in] client    Client
+     */
+    void finishWrite(Client& client);
+
+    /**
+     * Send a frame to a client. On failure the client is closed.
+     *
+     * @param[in] client    Client
+     * @param[in] frame     Frame
+     * @param[in] size      Frame size in byte
+     */
+    void send(Client& client, const uint8_t* frame, size_t size);
+
+    /**
+     * Close a client and release its pending writes.
+     * Already requested writes are still performed.
+     *
+     * @param[in] client    Client
+     */
+    void closeClient(Client& client);
+
+    /**
+     * Release the pending writes of a client.
+     *
+     * @param[in] client    Client
+     *
+     * @return Number of released writes
+     */
+    size_t releaseWrites(const Client& client);
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+#endif /* IVT_REGO6XX_MODBUS */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
@@ -0,0 +1,188 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  IVT rego6xx controller outbox for MQTT outages
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IVTRego6xxOutbox.h"
+#include "SimpleTimer.hpp"
+#include <new>
+#include <stdio.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+namespace esphome
+{
+namespace ivt_rego6xx_ctrl
+{
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool IVTRego6xxOutbox::allocate(size_t capacity)
+{
+    bool isSuccessful = false;
+
+    release();
+
+    if (0U < capacity)
+    {
+        m_entries = new (std::nothrow) Entry[capacity];
+
+        if (nullptr != m_entries)
+        {
+            m_capacity   = capacity;
+            isSuccessful = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+void IVTRego6xxOutbox::release()
+{
+    if (nullptr != m_entries)
+    {
+        delete[] m_entries;
+        m_entries = nullptr;
+    }
+
+    m_capacity = 0U;
+    m_tail     = 0U;
+    m_count    = 0U;
+}
+
+void IVTRego6xxOutbox::add(const EntityBase* entity, float value)
+{
+    if ((nullptr != m_entries) &&
+        (nullptr != entity))
+    {
+        Entry* entry = nullptr;
+
+        /* Under pressure the oldest value is dropped, the latest are more relevant. */
+        if (m_capacity == m_count)
+        {
+            m_tail = (m_tail + 1U) % m_capacity;
+            --m_count;
+            ++m_dropped;
+        }
+
+        entry            = &m_entries[(m_tail + m_count) % m_capacity];
+        entry->entity    = entity;
+        entry->timestamp = SimpleTimer::now();
+        entry->value     = value;
+
+        ++m_count;
+        ++m_buffered;
+    }
+}
+
+bool IVTRego6xxOutbox::peek(Entry& entry) const
+{
+    bool isAvailable = false;
+
+    if (0U < m_count)
+    {
+        entry       = m_entries[m_tail];
+        isAvailable = true;
+    }
+
+    return isAvailable;
+}
+
+void IVTRego6xxOutbox::pop()
+{
+    if (0U < m_count)
+    {
+        m_tail = (m_tail + 1U) % m_capacity;
+        --m_count;
+        ++m_replayed;
+    }
+}
+
+void IVTRego6xxOutbox::writeMetrics(std::string& out) const
+{
+    char line[64];
+
+    out += "# TYPE ivt_rego6xx_outbox_entries gauge\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_outbox_entries %u\n", static_cast<unsigned int>(m_count));
+    out += line;
+
+    out += "# TYPE ivt_rego6xx_outbox_buffered_total counter\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_outbox_buffered_total %u\n", static_cast<unsigned int>(m_buffered));
+    out += line;
+
+    out += "# TYPE ivt_rego6xx_outbox_replayed_total counter\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_outbox_replayed_total %u\n", static_cast<unsigned int>(m_replayed));
+    out += line;
+
+    out += "# TYPE ivt_rego6xx_outbox_dropped_total counter\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_outbox_dropped_total %u\n", static_cast<unsigned int>(m_dropped));
+    out += line;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
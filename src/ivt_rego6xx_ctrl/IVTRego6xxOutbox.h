@@ -0,0 +1,206 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  IVT rego6xx controller outbox for MQTT outages
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <stdint.h>
+#include "esphome/core/component.h"
+#include <string>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * Bounded outbox, which keeps the published entity values with their
+ * timestamp while the MQTT broker is not reachable. The values are replayed
+ * in their original order, after the connection is back. If the outbox is
+ * full, the oldest value is dropped.
+ *
+ * The outbox is handled by the main loop only, it doesn't publish itself.
+ */
+class IVTRego6xxOutbox
+{
+public:
+
+    /**
+     * Buffered entity value.
+     */
+    struct Entry
+    {
+        const EntityBase* entity;    /**< Entity */
+        uint32_t          timestamp; /**< Timestamp in ms, when the value was published. */
+        float             value;     /**< Value */
+    };
+
+    /**
+     * Constructs the outbox without memory.
+     */
+    IVTRego6xxOutbox() :
+        m_entries(nullptr),
+        m_capacity(0U),
+        m_tail(0U),
+        m_count(0U),
+        m_buffered(0U),
+        m_replayed(0U),
+        m_dropped(0U)
+    {
+    }
+
+    /**
+     * Destroys the outbox.
+     */
+    ~IVTRego6xxOutbox()
+    {
+        release();
+    }
+
+    /**
+     * Allocate the outbox memory.
+     *
+     * @param[in] capacity  Maximum number of entries
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool allocate(size_t capacity);
+
+    /**
+     * Release the outbox memory.
+     */
+    void release();
+
+    /**
+     * Is the outbox enabled?
+     *
+     * @return If the outbox memory is allocated, it will return true otherwise false.
+     */
+    bool isEnabled() const
+    {
+        return (nullptr != m_entries);
+    }
+
+    /**
+     * Get the number of buffered entries.
+     *
+     * @return Number of entries
+     */
+    size_t getCount() const
+    {
+        return m_count;
+    }
+
+    /**
+     * Get the maximum number of entries.
+     *
+     * @return Maximum number of entries
+     */
+    size_t getCapacity() const
+    {
+        return m_capacity;
+    }
+
+    /**
+     * Buffer an entity value with the current timestamp. If the outbox is
+     * full, the oldest entry is dropped.
+     *
+     * @param[in] entity    Entity
+     * @param[in] value     Value
+     */
+    void add(const EntityBase* entity, float value);
+
+    /**
+     * Get the oldest entry, without removing it.
+     *
+     * @param[out] entry    Oldest entry
+     *
+     * @return If an entry is available, it will return true otherwise false.
+     */
+    bool peek(Entry& entry) const;
+
+    /**
+     * Remove the oldest entry, after it was replayed.
+     */
+    void pop();
+
+    /**
+     * Append the number of buffered, replayed and dropped entries in the
+     * Prometheus text format.
+     *
+     * @param[out] out  Output
+     */
+    void writeMetrics(std::string& out) const;
+
+private:
+
+    Entry*   m_entries;  /**< Ring of entries */
+    size_t   m_capacity; /**< Maximum number of entries */
+    size_t   m_tail;     /**< Index of the oldest entry */
+    size_t   m_count;    /**< Number of entries */
+    uint32_t m_buffered; /**< Number of buffered entries */
+    uint32_t m_replayed; /**< Number of replayed entries */
+    uint32_t m_dropped;  /**< Number of dropped entries */
+
+    IVTRego6xxOutbox(const IVTRego6xxOutbox& other);
+    IVTRego6xxOutbox& operator=(const IVTRego6xxOutbox& other);
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
@@ -0,0 +1,848 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  End-to-end polling benchmark against the Rego6xx simulator
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IVTRego6xxPollingBenchmark.h"
+
+#ifdef IVT_REGO6XX_POLLING_BENCHMARK
+
+#include "IVTRego6xxCtrl.h"
+#include "Rego6xxCtrl.h"
+#include "EventTrace.hpp"
+#include "esphome/core/log.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+namespace esphome
+{
+namespace ivt_rego6xx_ctrl
+{
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static uint32_t getVirtualTime();
+
+#ifdef EVENT_TRACE_SIZE
+static uint32_t getVirtualMicros();
+#endif /* EVENT_TRACE_SIZE */
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/**
+ * Logger tag of this component.
+ */
+static const char*     TAG          = "ivt_rego6xx_ctrl.polling_benchmark";
+
+/** Virtual time in us, which is the clock of all simple timers. */
+static const uint64_t* virtualClock = nullptr;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+int IVTRego6xxSimLink::available()
+{
+    int available = 0;
+
+    if (m_readyTime <= m_time)
+    {
+        available = m_sim.available();
+    }
+
+    return available;
+}
+
+int IVTRego6xxSimLink::read()
+{
+    int data = -1;
+
+    if (m_readyTime <= m_time)
+    {
+        data = m_sim.read();
+
+        if ((true == m_isRspPending) &&
+            (0 >= m_sim.available()))
+        {
+            m_isRspPending = false;
+            m_isCompleted  = true;
+        }
+    }
+
+    return data;
+}
+
+int IVTRego6xxSimLink::peek()
+{
+    int data = -1;
+
+    if (m_readyTime <= m_time)
+    {
+        data = m_sim.peek();
+    }
+
+    return data;
+}
+
+size_t IVTRego6xxSimLink::write(uint8_t data)
+{
+    return write(&data, 1U);
+}
+
+size_t IVTRego6xxSimLink::write(const uint8_t* buffer, size_t size)
+{
+    size_t   written = size;
+    uint32_t rspSize = 0U;
+    uint64_t busy    = 0U;
+
+    /* Too fast after the previous transaction, the controller doesn't respond. */
+    if ((0U < m_readyTime) &&
+        ((m_readyTime + TURNAROUND_TIME) > m_time))
+    {
+        ++m_ignoredCount;
+    }
+    else
+    {
+        written = m_sim.write(buffer, size);
+        rspSize = static_cast<uint32_t>(m_sim.available());
+    }
+
+    busy = static_cast<uint64_t>(written + rspSize) * BYTE_TIME;
+
+    /* The command is sent after a pending transmission. */
+    if (m_readyTime < m_time)
+    {
+        m_readyTime = m_time;
+    }
+
+    m_readyTime    += busy;
+    m_busyTime     += busy;
+    m_isRspPending  = (0U < rspSize);
+    m_isCompleted   = false;
+
+    if (Rego6xxCtrl::CMD_SIZE == size)
+    {
+        m_cmdId  = buffer[1];
+        m_addr   = static_cast<uint16_t>(buffer[2] & 0x03U) << 14U;
+        m_addr  |= static_cast<uint16_t>(buffer[3] & 0x7FU) << 7U;
+        m_addr  |= static_cast<uint16_t>(buffer[4] & 0x7FU) << 0U;
+    }
+
+    return written;
+}
+
+bool IVTRego6xxSimLink::getCompleted(uint8_t& cmdId, uint16_t& addr)
+{
+    bool isCompleted = m_isCompleted;
+
+    if (true == isCompleted)
+    {
+        cmdId         = m_cmdId;
+        addr          = m_addr;
+        m_isCompleted = false;
+    }
+
+    return isCompleted;
+}
+
+void IVTRego6xxPollingBenchmark::addPolicy(const char* name, const IVTRego6xxPollingPolicy& policy)
+{
+    Policy item;
+
+    item.name   = name;
+    item.policy = policy;
+
+    m_policies.push_back(item);
+}
+
+void IVTRego6xxPollingBenchmark::begin(IVTRego6xxCtrl& ctrl)
+{
+    size_t idx = 0U;
+
+    virtualClock = &m_time;
+    SimpleTimer::setClock(getVirtualTime);
+
+#ifdef EVENT_TRACE_SIZE
+    /* The traced events shall show the virtual timing of the bus. */
+    EventTrace::getInstance().setClock(getVirtualMicros);
+#endif /* EVENT_TRACE_SIZE */
+
+    for (idx = 0U; idx < ctrl.m_sensorCount; ++idx)
+    {
+        addEntity(ctrl.m_sensors[idx], KIND_SENSOR, ctrl.m_sensors[idx]->getCmdId(), ctrl.m_sensors[idx]->getAddr());
+    }
+
+    for (idx = 0U; idx < ctrl.m_binarySensorCount; ++idx)
+    {
+        addEntity(ctrl.m_binarySensors[idx], KIND_BINARY_SENSOR, ctrl.m_binarySensors[idx]->getCmdId(), ctrl.m_binarySensors[idx]->getAddr());
+    }
+
+    for (idx = 0U; idx < ctrl.m_textSensorCount; ++idx)
+    {
+        addEntity(ctrl.m_textSensors[idx], KIND_TEXT_SENSOR, ctrl.m_textSensors[idx]->getCmdId(), ctrl.m_textSensors[idx]->getAddr());
+    }
+
+    for (idx = 0U; idx < ctrl.m_numberCount; ++idx)
+    {
+        addEntity(ctrl.m_numbers[idx], KIND_NUMBER, ctrl.m_numbers[idx]->getReadCmdId(), ctrl.m_numbers[idx]->getAddr());
+    }
+
+    /* Without explicit policies, the policy of the component is measured. */
+    if (true == m_policies.empty())
+    {
+        addPolicy("component", ctrl.m_policy);
+    }
+
+    ESP_LOGI(TAG, "Polling benchmark started: %u entities, %u buttons, %u policies, %u s virtual time per policy.",
+        static_cast<unsigned int>(m_entities.size()),
+        static_cast<unsigned int>(ctrl.m_buttonCount),
+        static_cast<unsigned int>(m_policies.size()),
+        static_cast<unsigned int>(m_duration / 1000U));
+
+    startRun(ctrl);
+}
+
+void IVTRego6xxPollingBenchmark::process(IVTRego6xxCtrl& ctrl)
+{
+    uint32_t step = 0U;
+
+    while ((false == m_isFinished) && (STEPS_PER_LOOP > step))
+    {
+        uint8_t  cmdId = 0U;
+        uint16_t addr  = 0U;
+
+        if (true == processEvents(ctrl))
+        {
+            m_idleSteps = 0U;
+        }
+
+        ctrl.processPolling();
+
+        if (true == m_link.getCompleted(cmdId, addr))
+        {
+            handleCompleted(cmdId, addr);
+        }
+
+        /* A run ends only between two transactions. */
+        if ((m_duration <= getRunTime()) &&
+            (false == isRspPending(ctrl)))
+        {
+            finishRun(ctrl);
+        }
+        else
+        {
+            m_time += getStep(ctrl);
+        }
+
+        ++step;
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void IVTRego6xxPollingBenchmark::addEntity(const EntityBase* entity, Kind kind, uint8_t cmdId, uint16_t addr)
+{
+    Entity item;
+
+    item.entity          = entity;
+    item.kind            = kind;
+    item.cmdId           = cmdId;
+    item.addr            = addr;
+    item.lastRead        = 0U;
+    item.isReadInCycle   = false;
+    item.isChangePending = false;
+    item.changeTime      = 0U;
+    item.deadline        = 0U;
+
+    m_entities.push_back(item);
+}
+
+void IVTRego6xxPollingBenchmark::startRun(IVTRego6xxCtrl& ctrl)
+{
+    const Policy& policy = m_policies[m_policyIndex];
+
+    ctrl.setPollingPolicy(policy.policy);
+    ctrl.startPolling();
+
+    /* Every run starts with the same heatpump values and the alarm cleared. */
+    m_link.getSim().clearValues();
+    (void)m_link.getSim().setValue(Rego6xxCtrl::CMD_ID_READ_FRONT_PANEL, ALARM_LED_ADDR, 0U);
+
+    m_runStart            = now();
+    m_runBusyTime         = m_link.getBusyTime();
+    m_runIgnoredCount     = m_link.getIgnoredCount();
+    m_idleSteps           = 0U;
+    m_cycleStart          = 0U;
+    m_cycleReadCount      = 0U;
+    m_publishCount        = 0U;
+    m_changeCount         = 0U;
+    m_missedCount         = 0U;
+    m_random              = RANDOM_SEED;
+    m_nextButtonIndex     = 0U;
+    m_nextPressTime       = m_pressInterval;
+    m_pressedButton       = nullptr;
+    m_pressTime           = 0U;
+    m_nextAlarmTime       = m_alarmInterval;
+    m_isAlarm             = false;
+    m_nextTemperatureTime = m_temperatureInterval;
+    m_nextSensorIndex     = 0U;
+    m_cycles.clear();
+    m_staleness.clear();
+    m_pressLatencies.clear();
+
+    for (Entity& entity : m_entities)
+    {
+        entity.lastRead        = 0U;
+        entity.isReadInCycle   = false;
+        entity.isChangePending = false;
+        entity.staleness.clear();
+    }
+
+    ESP_LOGI(TAG, "Run %u/%u with policy '%s' started.",
+        static_cast<unsigned int>(m_policyIndex + 1U),
+        static_cast<unsigned int>(m_policies.size()),
+        policy.name.c_str());
+}
+
+void IVTRego6xxPollingBenchmark::finishRun(IVTRego6xxCtrl& ctrl)
+{
+    uint32_t runTime = getRunTime();
+    Result   result;
+
+    /* Changes, which are still not read, count as missed as soon as their deadline is over. */
+    for (Entity& entity : m_entities)
+    {
+        if ((true == entity.isChangePending) &&
+            (entity.deadline < (runTime - entity.changeTime)))
+        {
+            ++m_missedCount;
+        }
+    }
+
+    if ((nullptr != m_pressedButton) &&
+        (PRESS_DEADLINE < (runTime - m_pressTime)))
+    {
+        ++m_missedCount;
+    }
+
+    result.stalenessP50 = m_staleness.getPercentile(50U);
+    result.stalenessP95 = m_staleness.getPercentile(95U);
+    result.stalenessMax = m_staleness.getMax();
+    result.changeCount  = m_changeCount;
+    result.missedCount  = m_missedCount;
+    result.busLoad      = 0U;
+    result.publishCount = m_publishCount;
+    result.pressP95     = m_pressLatencies.getPercentile(95U);
+    result.snapshotTime = 0U;
+    result.ignoredCount = m_link.getIgnoredCount() - m_runIgnoredCount;
+
+    if ((true == ctrl.m_isBurstEnabled) &&
+        (0U == ctrl.m_burstRounds))
+    {
+        result.snapshotTime = ctrl.m_snapshotDuration;
+    }
+
+    if (0U < runTime)
+    {
+        result.busLoad = static_cast<uint32_t>(((m_link.getBusyTime() - m_runBusyTime) * 1000U) / (static_cast<uint64_t>(runTime) * 1000U));
+    }
+
+    m_results.push_back(result);
+    reportRun();
+
+    ++m_policyIndex;
+
+    if (m_policies.size() > m_policyIndex)
+    {
+        startRun(ctrl);
+    }
+    else
+    {
+        m_isFinished = true;
+        reportComparison();
+    }
+}
+
+bool IVTRego6xxPollingBenchmark::isRspPending(const IVTRego6xxCtrl& ctrl) const
+{
+    return (nullptr != ctrl.m_rego6xxRsp) ||
+           (nullptr != ctrl.m_displayRsp) ||
+           (nullptr != ctrl.m_confirmRsp);
+}
+
+uint64_t IVTRego6xxPollingBenchmark::getStep(IVTRego6xxCtrl& ctrl)
+{
+    uint64_t step   = STEP;
+    bool     isIdle = false;
+    uint32_t wait   = UINT32_MAX;
+
+    /* Transmission in progress? Continue when it is finished. */
+    if (m_time < m_link.getReadyTime())
+    {
+        step        = m_link.getReadyTime() - m_time;
+        m_idleSteps = 0U;
+    }
+    /* Response is read? */
+    else if (true == isRspPending(ctrl))
+    {
+        m_idleSteps = 0U;
+    }
+    /* Pause between two requests, the state machine is not processed. */
+    else if (true == ctrl.m_pauseTimer.isTimerRunning())
+    {
+        wait        = ctrl.m_pauseTimer.getRemaining();
+        isIdle      = true;
+        m_idleSteps = 0U;
+    }
+    else
+    {
+        ++m_idleSteps;
+
+        /* The state machine passed all states without any request, therefore
+         * nothing happens until the next timer elapses.
+         */
+        if (IDLE_STEPS <= m_idleSteps)
+        {
+            const SimpleTimer* timers[] =
+            {
+                &ctrl.m_sensorTimer,
+                &ctrl.m_binarySensorTimer,
+                &ctrl.m_textSensorTimer,
+                &ctrl.m_numberTimer
+            };
+
+            for (const SimpleTimer* timer : timers)
+            {
+                if ((true == timer->isTimerRunning()) &&
+                    (wait > timer->getRemaining()))
+                {
+                    wait = timer->getRemaining();
+                }
+            }
+
+            isIdle = true;
+        }
+    }
+
+    if (true == isIdle)
+    {
+        uint32_t runTime   = getRunTime();
+        uint32_t nextEvent = getTimeToNextEvent();
+
+        if (wait > nextEvent)
+        {
+            wait = nextEvent;
+        }
+
+        if ((m_duration > runTime) &&
+            (wait > (m_duration - runTime)))
+        {
+            wait = m_duration - runTime;
+        }
+
+        if (1U < wait)
+        {
+            step = static_cast<uint64_t>(wait) * 1000U;
+        }
+    }
+
+    return step;
+}
+
+uint32_t IVTRego6xxPollingBenchmark::getTimeToNextEvent() const
+{
+    uint32_t       wait       = UINT32_MAX;
+    uint32_t       runTime    = getRunTime();
+    const uint32_t intervals[] = { m_pressInterval, m_alarmInterval, m_temperatureInterval };
+    const uint32_t times[]     = { m_nextPressTime, m_nextAlarmTime, m_nextTemperatureTime };
+    size_t         idx         = 0U;
+
+    for (idx = 0U; idx < (sizeof(times) / sizeof(times[0])); ++idx)
+    {
+        /* Event enabled? */
+        if (0U < intervals[idx])
+        {
+            uint32_t eventWait = (times[idx] > runTime) ? (times[idx] - runTime) : 0U;
+
+            if (wait > eventWait)
+            {
+                wait = eventWait;
+            }
+        }
+    }
+
+    return wait;
+}
+
+bool IVTRego6xxPollingBenchmark::processEvents(IVTRego6xxCtrl& ctrl)
+{
+    bool     isEvent = false;
+    uint32_t runTime = getRunTime();
+
+    /* Press the next button. Only one button press at once, otherwise the latencies can't be assigned. */
+    if ((0U < m_pressInterval) &&
+        (m_nextPressTime <= runTime))
+    {
+        m_nextPressTime += m_pressInterval;
+
+        if ((0U < ctrl.m_buttonCount) &&
+            (nullptr == m_pressedButton))
+        {
+            IVTRego6xxButton* button = ctrl.m_buttons[m_nextButtonIndex];
+
+            button->press();
+
+            m_pressedButton   = button;
+            m_pressTime       = runTime;
+            m_nextButtonIndex = (m_nextButtonIndex + 1U) % ctrl.m_buttonCount;
+            ++m_changeCount;
+        }
+
+        isEvent = true;
+    }
+
+    /* Raise or clear the alarm. */
+    if ((0U < m_alarmInterval) &&
+        (m_nextAlarmTime <= runTime))
+    {
+        m_nextAlarmTime += m_alarmInterval;
+
+        for (Entity& entity : m_entities)
+        {
+            if ((KIND_BINARY_SENSOR == entity.kind) &&
+                (Rego6xxCtrl::CMD_ID_READ_FRONT_PANEL == entity.cmdId) &&
+                (ALARM_LED_ADDR == entity.addr))
+            {
+                m_isAlarm = !m_isAlarm;
+
+                (void)m_link.getSim().setValue(entity.cmdId, entity.addr, (true == m_isAlarm) ? 1U : 0U);
+                markChange(entity, ALARM_DEADLINE);
+                break;
+            }
+        }
+
+        isEvent = true;
+    }
+
+    /* Change the temperature of the next sensor. */
+    if ((0U < m_temperatureInterval) &&
+        (m_nextTemperatureTime <= runTime))
+    {
+        size_t count = 0U;
+
+        m_nextTemperatureTime += m_temperatureInterval;
+
+        while (m_entities.size() > count)
+        {
+            Entity& entity = m_entities[m_nextSensorIndex];
+
+            m_nextSensorIndex = (m_nextSensorIndex + 1U) % m_entities.size();
+            ++count;
+
+            if (KIND_SENSOR == entity.kind)
+            {
+                /* 20.0 - 29.9 °C */
+                uint16_t value = static_cast<uint16_t>(200U + (getRandom() % 100U));
+
+                (void)m_link.getSim().setValue(entity.cmdId, entity.addr, value);
+                markChange(entity, TEMPERATURE_DEADLINE);
+                break;
+            }
+        }
+
+        isEvent = true;
+    }
+
+    return isEvent;
+}
+
+uint32_t IVTRego6xxPollingBenchmark::getRandom()
+{
+    /* Linear congruential generator, the upper bits have the best quality. */
+    m_random = (m_random * 1664525U) + 1013904223U;
+
+    return m_random >> 16U;
+}
+
+void IVTRego6xxPollingBenchmark::markChange(Entity& entity, uint32_t deadline)
+{
+    /* Several changes until the next read are seen as one, the oldest one counts. */
+    if (false == entity.isChangePending)
+    {
+        entity.isChangePending = true;
+        entity.changeTime      = getRunTime();
+        entity.deadline        = deadline;
+
+        ++m_changeCount;
+    }
+}
+
+void IVTRego6xxPollingBenchmark::handleCompleted(uint8_t cmdId, uint16_t addr)
+{
+    uint32_t runTime = getRunTime();
+
+    if ((nullptr != m_pressedButton) &&
+        (cmdId == m_pressedButton->getCmdId()) &&
+        (addr == m_pressedButton->getAddr()))
+    {
+        uint32_t latency = runTime - m_pressTime;
+
+        m_pressLatencies.add(latency);
+
+        if (PRESS_DEADLINE < latency)
+        {
+            ++m_missedCount;
+        }
+
+        m_pressedButton = nullptr;
+    }
+    else
+    {
+        std::vector<Entity>::iterator it = m_entities.begin();
+
+        /* Find the entity, which was read. */
+        while ((m_entities.end() != it) &&
+               ((cmdId != it->cmdId) || (addr != it->addr)))
+        {
+            ++it;
+        }
+
+        if (m_entities.end() != it)
+        {
+            uint32_t age = runTime - it->lastRead;
+
+            it->staleness.add(age);
+            m_staleness.add(age);
+            it->lastRead = runTime;
+
+            /* Every successful read is published. */
+            ++m_publishCount;
+
+            if (true == it->isChangePending)
+            {
+                if (it->deadline < (runTime - it->changeTime))
+                {
+                    ++m_missedCount;
+                }
+
+                it->isChangePending = false;
+            }
+
+            if (false == it->isReadInCycle)
+            {
+                it->isReadInCycle = true;
+                ++m_cycleReadCount;
+
+                /* All entities read at least once? */
+                if (m_entities.size() <= m_cycleReadCount)
+                {
+                    m_cycles.add(runTime - m_cycleStart);
+
+                    for (Entity& entity : m_entities)
+                    {
+                        entity.isReadInCycle = false;
+                    }
+
+                    m_cycleStart     = runTime;
+                    m_cycleReadCount = 0U;
+                }
+            }
+        }
+    }
+}
+
+void IVTRego6xxPollingBenchmark::reportRun()
+{
+    const Result& result = m_results.back();
+
+    ESP_LOGI(TAG, "Run with policy '%s' finished after %u s virtual time.",
+        m_policies[m_policyIndex].name.c_str(),
+        static_cast<unsigned int>(getRunTime() / 1000U));
+    ESP_LOGI(TAG, "Bus utilisation: %u.%u %%", static_cast<unsigned int>(result.busLoad / 10U), static_cast<unsigned int>(result.busLoad % 10U));
+    ESP_LOGI(TAG, "Publishes: %u", static_cast<unsigned int>(result.publishCount));
+    ESP_LOGI(TAG, "Scripted changes: %u, missed deadlines: %u", static_cast<unsigned int>(result.changeCount), static_cast<unsigned int>(result.missedCount));
+    ESP_LOGI(TAG, "Commands ignored by the controller: %u", static_cast<unsigned int>(result.ignoredCount));
+
+    if (0U == result.snapshotTime)
+    {
+        ESP_LOGI(TAG, "Initial snapshot: not completed.");
+    }
+    else
+    {
+        ESP_LOGI(TAG, "Initial snapshot [ms]: %u", static_cast<unsigned int>(result.snapshotTime));
+    }
+
+    if (0U == m_cycles.getCount())
+    {
+        ESP_LOGI(TAG, "Full refresh cycle: not completed.");
+    }
+    else
+    {
+        ESP_LOGI(TAG, "Full refresh cycle [ms]: n=%u p50=%u p95=%u max=%u",
+            static_cast<unsigned int>(m_cycles.getCount()),
+            static_cast<unsigned int>(m_cycles.getPercentile(50U)),
+            static_cast<unsigned int>(m_cycles.getPercentile(95U)),
+            static_cast<unsigned int>(m_cycles.getMax()));
+    }
+
+    if (0U == m_pressLatencies.getCount())
+    {
+        ESP_LOGI(TAG, "Button press to confirm: no samples.");
+    }
+    else
+    {
+        ESP_LOGI(TAG, "Button press to confirm [ms]: n=%u p50=%u p95=%u max=%u",
+            static_cast<unsigned int>(m_pressLatencies.getCount()),
+            static_cast<unsigned int>(m_pressLatencies.getPercentile(50U)),
+            static_cast<unsigned int>(m_pressLatencies.getPercentile(95U)),
+            static_cast<unsigned int>(m_pressLatencies.getMax()));
+    }
+
+    ESP_LOGI(TAG, "Staleness [ms]:");
+
+    for (const Entity& entity : m_entities)
+    {
+        if (0U == entity.staleness.getCount())
+        {
+            ESP_LOGI(TAG, "  %-24s never read", entity.entity->get_name().c_str());
+        }
+        else
+        {
+            ESP_LOGI(TAG, "  %-24s n=%u p50=%u p95=%u max=%u",
+                entity.entity->get_name().c_str(),
+                static_cast<unsigned int>(entity.staleness.getCount()),
+                static_cast<unsigned int>(entity.staleness.getPercentile(50U)),
+                static_cast<unsigned int>(entity.staleness.getPercentile(95U)),
+                static_cast<unsigned int>(entity.staleness.getMax()));
+        }
+    }
+}
+
+void IVTRego6xxPollingBenchmark::reportComparison()
+{
+    size_t idx = 0U;
+
+    ESP_LOGI(TAG, "Policy comparison over %u s virtual time per policy, staleness and latency in ms:",
+        static_cast<unsigned int>(m_duration / 1000U));
+    ESP_LOGI(TAG, "%-16s %9s %9s %9s %8s %8s %9s %10s %9s %9s %8s",
+        "policy", "stale p50", "stale p95", "stale max", "changes", "missed", "bus load", "publishes", "press p95", "snapshot", "ignored");
+
+    for (idx = 0U; idx < m_results.size(); ++idx)
+    {
+        const Result& result = m_results[idx];
+
+        ESP_LOGI(TAG, "%-16s %9u %9u %9u %8u %8u %5u.%u %% %10u %9u %9u %8u",
+            m_policies[idx].name.c_str(),
+            static_cast<unsigned int>(result.stalenessP50),
+            static_cast<unsigned int>(result.stalenessP95),
+            static_cast<unsigned int>(result.stalenessMax),
+            static_cast<unsigned int>(result.changeCount),
+            static_cast<unsigned int>(result.missedCount),
+            static_cast<unsigned int>(result.busLoad / 10U),
+            static_cast<unsigned int>(result.busLoad % 10U),
+            static_cast<unsigned int>(result.publishCount),
+            static_cast<unsigned int>(result.pressP95),
+            static_cast<unsigned int>(result.snapshotTime),
+            static_cast<unsigned int>(result.ignoredCount));
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Get the virtual time, which is used as clock of all simple timers.
+ *
+ * @return Virtual time in ms
+ */
+static uint32_t getVirtualTime()
+{
+    uint32_t time = 0U;
+
+    if (nullptr != virtualClock)
+    {
+        time = static_cast<uint32_t>(*virtualClock / 1000U);
+    }
+
+    return time;
+}
+
+#ifdef EVENT_TRACE_SIZE
+
+/**
+ * Get the virtual time, which is used as clock of the event trace.
+ *
+ * @return Virtual time in us
+ */
+static uint32_t getVirtualMicros()
+{
+    uint32_t time = 0U;
+
+    if (nullptr != virtualClock)
+    {
+        time = static_cast<uint32_t>(*virtualClock);
+    }
+
+    return time;
+}
+
+#endif /* EVENT_TRACE_SIZE */
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+#endif /* IVT_REGO6XX_POLLING_BENCHMARK */
@@ -0,0 +1,610 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  End-to-end polling benchmark against the Rego6xx simulator
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "esphome/core/defines.h"
+
+#ifdef IVT_REGO6XX_POLLING_BENCHMARK
+
+#include "esphome/core/component.h"
+#include "Rego6xxSim.h"
+#include "SimpleTimer.hpp"
+#include "Histogram.hpp"
+#include "IVTRego6xxPollingPolicy.h"
+#include "button/IVTRego6xxButton.h"
+#include <string>
+#include <vector>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+class IVTRego6xxCtrl;
+
+/**
+ * Link between the IVT rego6xx controller component and the Rego6xx simulator.
+ * It models the transmission time of every byte at 19200 baud under the
+ * virtual clock, i.e. a response is available only after the command and
+ * the response were transmitted. A command, which follows the previous
+ * transaction too fast, is ignored like by an overloaded controller.
+ */
+class IVTRego6xxSimLink : public Stream
+{
+public:
+
+    /**
+     * Constructs the simulator link.
+     *
+     * @param[in] time  Virtual time in us
+     */
+    IVTRego6xxSimLink(const uint64_t& time) :
+        m_time(time),
+        m_sim(),
+        m_readyTime(0U),
+        m_busyTime(0U),
+        m_ignoredCount(0U),
+        m_cmdId(0U),
+        m_addr(0U),
+        m_isRspPending(false),
+        m_isCompleted(false)
+    {
+        m_sim.setVerbose(false);
+    }
+
+    /**
+     * Destroys the simulator link.
+     */
+    ~IVTRego6xxSimLink()
+    {
+    }
+
+    /**
+     * Get the number of available data.
+     *
+     * @return Number of byte which are available
+     */
+    int available() override;
+
+    /**
+     * Read a single data byte.
+     *
+     * @return Single data byte or -1 if no byte is available.
+     */
+    int read() override;
+
+    /**
+     * Read a single data byte, but without increasing the internal read position.
+     *
+     * @return Single data byte or -1 if no byte is available.
+     */
+    int peek() override;
+
+    /**
+     * Write a single data byte.
+     *
+     * @param[in] data  Single data byte
+     *
+     * @return Number of written data byte
+     */
+    size_t write(uint8_t data) override;
+
+    /**
+     * Write a command.
+     *
+     * @param[in] buffer    Command buffer
+     * @param[in] size      Command buffer size in byte
+     *
+     * @return Number of written data byte
+     */
+    size_t write(const uint8_t* buffer, size_t size) override;
+
+    /**
+     * Get the simulator, e.g. to change the values of the heatpump.
+     *
+     * @return Rego6xx heatpump controller simulator
+     */
+    Rego6xxSim& getSim()
+    {
+        return m_sim;
+    }
+
+    /**
+     * Get the time the bus was busy.
+     *
+     * @return Busy time in us
+     */
+    uint64_t getBusyTime() const
+    {
+        return m_busyTime;
+    }
+
+    /**
+     * Get the number of commands, which were ignored because they followed
+     * the previous transaction within the turnaround time.
+     *
+     * @return Number of ignored commands
+     */
+    uint32_t getIgnoredCount() const
+    {
+        return m_ignoredCount;
+    }
+
+    /**
+     * Get the virtual time, when the bus is free again.
+     *
+     * @return Virtual time in us
+     */
+    uint64_t getReadyTime() const
+    {
+        return m_readyTime;
+    }
+
+    /**
+     * Get the command of the last transaction, after its response was
+     * read completely. Every transaction is provided once.
+     *
+     * @param[out] cmdId    Command id
+     * @param[out] addr     Address
+     *
+     * @return If a transaction was completed, it will return true otherwise false.
+     */
+    bool getCompleted(uint8_t& cmdId, uint16_t& addr);
+
+private:
+
+    /** Transmission time of a single byte (start bit, 8 data bits, stop bit) at 19200 baud in us. */
+    static const uint32_t BYTE_TIME       = 521U;
+
+    /**
+     * Assumed time in us, which the Rego6xx controller needs after a
+     * transaction until it accepts the next command.
+     */
+    static const uint32_t TURNAROUND_TIME = 5000U;
+
+    const uint64_t& m_time;         /**< Virtual time in us */
+    Rego6xxSim      m_sim;          /**< Rego6xx heatpump controller simulator */
+    uint64_t        m_readyTime;    /**< Virtual time in us, when the response is available. */
+    uint64_t        m_busyTime;     /**< Time in us the bus was busy. */
+    uint32_t        m_ignoredCount; /**< Number of ignored commands. */
+    uint8_t         m_cmdId;        /**< Command id of the current transaction. */
+    uint16_t        m_addr;         /**< Address of the current transaction. */
+    bool            m_isRspPending; /**< Is the response of the current transaction not read completely? */
+    bool            m_isCompleted;  /**< Is the current transaction completed? */
+
+    IVTRego6xxSimLink();
+};
+
+/**
+ * End-to-end benchmark of the polling of the IVT rego6xx controller component.
+ * The real polling logic with the configured entities runs against the
+ * Rego6xx simulator under a virtual clock. The clock jumps over periods
+ * without bus activity, so several days are processed in a short time.
+ *
+ * Every polling policy runs over the same scripted scenario: button presses,
+ * alarms and temperature changes in fixed intervals. Every change has a
+ * deadline, until it shall be read from the heatpump. After every run a
+ * report is logged and at the end a comparison table of all policies.
+ */
+class IVTRego6xxPollingBenchmark
+{
+public:
+
+    /**
+     * Constructs the polling benchmark.
+     */
+    IVTRego6xxPollingBenchmark() :
+        m_time(0U),
+        m_link(m_time),
+        m_duration(SIMPLE_TIMER_DAYS(7U)),
+        m_pressInterval(SIMPLE_TIMER_MINUTES(5U)),
+        m_alarmInterval(SIMPLE_TIMER_HOURS(6U)),
+        m_temperatureInterval(SIMPLE_TIMER_MINUTES(10U)),
+        m_isFinished(false),
+        m_policies(),
+        m_policyIndex(0U),
+        m_results(),
+        m_entities(),
+        m_runStart(0U),
+        m_runBusyTime(0U),
+        m_runIgnoredCount(0U),
+        m_idleSteps(0U),
+        m_cycleStart(0U),
+        m_cycleReadCount(0U),
+        m_cycles(),
+        m_staleness(),
+        m_publishCount(0U),
+        m_changeCount(0U),
+        m_missedCount(0U),
+        m_random(0U),
+        m_nextButtonIndex(0U),
+        m_nextPressTime(0U),
+        m_pressedButton(nullptr),
+        m_pressTime(0U),
+        m_pressLatencies(),
+        m_nextAlarmTime(0U),
+        m_isAlarm(false),
+        m_nextTemperatureTime(0U),
+        m_nextSensorIndex(0U)
+    {
+    }
+
+    /**
+     * Destroys the polling benchmark.
+     */
+    ~IVTRego6xxPollingBenchmark()
+    {
+    }
+
+    /**
+     * Get the stream to the simulator, which replaces the UART.
+     *
+     * @return Stream to the simulator
+     */
+    Stream& getStream()
+    {
+        return m_link;
+    }
+
+    /**
+     * Set the virtual duration of every run.
+     *
+     * @param[in] duration  Duration in ms
+     */
+    void setDuration(uint32_t duration)
+    {
+        m_duration = duration;
+    }
+
+    /**
+     * Set the virtual interval between two scripted button presses.
+     *
+     * @param[in] interval  Interval in ms. 0 disables the button presses.
+     */
+    void setPressInterval(uint32_t interval)
+    {
+        m_pressInterval = interval;
+    }
+
+    /**
+     * Set the virtual interval, after which the scripted alarm is raised
+     * or cleared.
+     *
+     * @param[in] interval  Interval in ms. 0 disables the alarms.
+     */
+    void setAlarmInterval(uint32_t interval)
+    {
+        m_alarmInterval = interval;
+    }
+
+    /**
+     * Set the virtual interval between two scripted temperature changes.
+     *
+     * @param[in] interval  Interval in ms. 0 disables the temperature changes.
+     */
+    void setTemperatureInterval(uint32_t interval)
+    {
+        m_temperatureInterval = interval;
+    }
+
+    /**
+     * Add a polling policy, which shall be compared. If no policy is added,
+     * only the policy of the component runs.
+     *
+     * @param[in] name      Name of the policy
+     * @param[in] policy    Polling policy
+     */
+    void addPolicy(const char* name, const IVTRego6xxPollingPolicy& policy);
+
+    /**
+     * Activate the virtual clock, collect the registered entities and
+     * start the first run. It must be called before any timer of the
+     * component is started.
+     *
+     * @param[in] ctrl  IVT rego6xx controller component
+     */
+    void begin(IVTRego6xxCtrl& ctrl);
+
+    /**
+     * Run a number of polling steps under the virtual clock.
+     * After every run its report is logged, after the last one the
+     * comparison table.
+     *
+     * @param[in] ctrl  IVT rego6xx controller component
+     */
+    void process(IVTRego6xxCtrl& ctrl);
+
+private:
+
+    /**
+     * A polling policy, which is compared.
+     */
+    struct Policy
+    {
+        std::string             name;   /**< Name of the policy */
+        IVTRego6xxPollingPolicy policy; /**< Polling policy */
+    };
+
+    /**
+     * The result of a single run.
+     */
+    struct Result
+    {
+        uint32_t stalenessP50; /**< Staleness of all entities p50 in ms. */
+        uint32_t stalenessP95; /**< Staleness of all entities p95 in ms. */
+        uint32_t stalenessMax; /**< Staleness of all entities max. in ms. */
+        uint32_t changeCount;  /**< Number of scripted changes. */
+        uint32_t missedCount;  /**< Number of scripted changes, which missed their deadline. */
+        uint32_t busLoad;      /**< Bus utilisation in 0.1 % */
+        uint32_t publishCount; /**< Number of published entity states. */
+        uint32_t pressP95;     /**< Button press to confirm latency p95 in ms. */
+        uint32_t snapshotTime; /**< Time until the initial snapshot of the startup burst was complete in ms. 0 if not complete. */
+        uint32_t ignoredCount; /**< Number of commands, which the simulator ignored. */
+    };
+
+    /**
+     * The kind of an entity.
+     */
+    enum Kind
+    {
+        KIND_SENSOR = 0U,   /**< Sensor */
+        KIND_BINARY_SENSOR, /**< Binary sensor */
+        KIND_TEXT_SENSOR,   /**< Text sensor */
+        KIND_NUMBER         /**< Number */
+    };
+
+    /**
+     * An entity, which is read cyclic from the heatpump.
+     */
+    struct Entity
+    {
+        const EntityBase* entity;          /**< The entity */
+        Kind              kind;            /**< Kind of the entity */
+        uint8_t           cmdId;           /**< Command id to read the entity. */
+        uint16_t          addr;            /**< Address to read the entity. */
+        uint32_t          lastRead;        /**< Run time of the last read in ms. */
+        bool              isReadInCycle;   /**< Is the entity read in the current full refresh cycle? */
+        bool              isChangePending; /**< Is a scripted change not read yet? */
+        uint32_t          changeTime;      /**< Run time of the oldest scripted change, which is not read yet, in ms. */
+        uint32_t          deadline;        /**< Deadline of the scripted change in ms. */
+        Histogram<>       staleness;       /**< Age of the value in ms, when it is read again. */
+    };
+
+    /** Virtual time step in us, if the bus is active. */
+    static const uint32_t       STEP                 = 1000U;
+
+    /** Number of polling steps per call to process(). */
+    static const uint32_t       STEPS_PER_LOOP       = 2000U;
+
+    /**
+     * Number of polling steps without bus activity, after which the virtual
+     * clock jumps to the next timeout. The state machine passes all states
+     * in the meantime.
+     */
+    static const uint32_t       IDLE_STEPS           = 8U;
+
+    /** Deadline of a button press until it is confirmed in ms. */
+    static const uint32_t       PRESS_DEADLINE       = SIMPLE_TIMER_SECONDS(1U);
+
+    /** Deadline of an alarm until it is read in ms. */
+    static const uint32_t       ALARM_DEADLINE       = SIMPLE_TIMER_MINUTES(1U);
+
+    /** Deadline of a temperature change until it is read in ms. */
+    static const uint32_t       TEMPERATURE_DEADLINE = SIMPLE_TIMER_MINUTES(5U);
+
+    /** Front panel address of the alarm LED, which is used for the scripted alarms. */
+    static const uint16_t       ALARM_LED_ADDR       = 0x0016U;
+
+    /** Seed of the pseudo random temperatures, same for every run. */
+    static const uint32_t       RANDOM_SEED          = 0x52656730U;
+
+    uint64_t                    m_time;                /**< Virtual time in us */
+    IVTRego6xxSimLink           m_link;                /**< Link to the simulator */
+    uint32_t                    m_duration;            /**< Virtual duration of every run in ms. */
+    uint32_t                    m_pressInterval;       /**< Virtual interval between two button presses in ms. */
+    uint32_t                    m_alarmInterval;       /**< Virtual interval between raising and clearing the alarm in ms. */
+    uint32_t                    m_temperatureInterval; /**< Virtual interval between two temperature changes in ms. */
+    bool                        m_isFinished;          /**< Is the benchmark finished? */
+    std::vector<Policy>         m_policies;            /**< Polling policies, which are compared. */
+    size_t                      m_policyIndex;         /**< Index of the policy of the current run. */
+    std::vector<Result>         m_results;             /**< Results of the finished runs. */
+    std::vector<Entity>         m_entities;            /**< Entities, which are read cyclic. */
+    uint32_t                    m_runStart;            /**< Virtual start time of the current run in ms. */
+    uint64_t                    m_runBusyTime;         /**< Bus busy time at the start of the current run in us. */
+    uint32_t                    m_runIgnoredCount;     /**< Number of ignored commands at the start of the current run. */
+    uint32_t                    m_idleSteps;           /**< Number of polling steps without bus activity. */
+    uint32_t                    m_cycleStart;          /**< Run time of the start of the current full refresh cycle in ms. */
+    size_t                      m_cycleReadCount;      /**< Number of entities read in the current full refresh cycle. */
+    Histogram<>                 m_cycles;              /**< Duration of the full refresh cycles in ms. */
+    Histogram<>                 m_staleness;           /**< Staleness of all entities in ms. */
+    uint32_t                    m_publishCount;        /**< Number of published entity states. */
+    uint32_t                    m_changeCount;         /**< Number of scripted changes. */
+    uint32_t                    m_missedCount;         /**< Number of scripted changes, which missed their deadline. */
+    uint32_t                    m_random;              /**< State of the pseudo random number generator. */
+    size_t                      m_nextButtonIndex;     /**< Index of the next button to press. */
+    uint32_t                    m_nextPressTime;       /**< Run time of the next button press in ms. */
+    const IVTRego6xxButton*     m_pressedButton;       /**< Pressed button, which waits for the confirmation. */
+    uint32_t                    m_pressTime;           /**< Run time of the button press in ms. */
+    Histogram<>                 m_pressLatencies;      /**< Button press to confirm latencies in ms. */
+    uint32_t                    m_nextAlarmTime;       /**< Run time of the next alarm change in ms. */
+    bool                        m_isAlarm;             /**< Is the alarm raised? */
+    uint32_t                    m_nextTemperatureTime; /**< Run time of the next temperature change in ms. */
+    size_t                      m_nextSensorIndex;     /**< Index of the next entity, whose temperature changes. */
+
+    IVTRego6xxPollingBenchmark(const IVTRego6xxPollingBenchmark& other);
+    IVTRego6xxPollingBenchmark& operator=(const IVTRego6xxPollingBenchmark& other);
+
+    /**
+     * Get the virtual time in ms.
+     *
+     * @return Virtual time in ms
+     */
+    uint32_t now() const
+    {
+        return static_cast<uint32_t>(m_time / 1000U);
+    }
+
+    /**
+     * Get the time since the start of the current run.
+     *
+     * @return Run time in ms
+     */
+    uint32_t getRunTime() const
+    {
+        return now() - m_runStart;
+    }
+
+    /**
+     * Add an entity, which is read cyclic.
+     *
+     * @param[in] entity    The entity
+     * @param[in] kind      Kind of the entity
+     * @param[in] cmdId     Command id to read the entity.
+     * @param[in] addr      Address to read the entity.
+     */
+    void addEntity(const EntityBase* entity, Kind kind, uint8_t cmdId, uint16_t addr);
+
+    /**
+     * Start a run with the current policy.
+     *
+     * @param[in] ctrl  IVT rego6xx controller component
+     */
+    void startRun(IVTRego6xxCtrl& ctrl);
+
+    /**
+     * Finish the current run and continue with the next policy.
+     *
+     * @param[in] ctrl  IVT rego6xx controller component
+     */
+    void finishRun(IVTRego6xxCtrl& ctrl);
+
+    /**
+     * Is the component waiting for a response?
+     *
+     * @param[in] ctrl  IVT rego6xx controller component
+     *
+     * @return If a response is pending, it will return true otherwise false.
+     */
+    bool isRspPending(const IVTRego6xxCtrl& ctrl) const;
+
+    /**
+     * Get the time until the virtual clock shall be advanced.
+     *
+     * @param[in] ctrl  IVT rego6xx controller component
+     *
+     * @return Time step in us
+     */
+    uint64_t getStep(IVTRego6xxCtrl& ctrl);
+
+    /**
+     * Get the time until the next scripted event.
+     *
+     * @return Time in ms
+     */
+    uint32_t getTimeToNextEvent() const;
+
+    /**
+     * Handle the scripted events, whose time has come.
+     *
+     * @param[in] ctrl  IVT rego6xx controller component
+     *
+     * @return If an event happened, it will return true otherwise false.
+     */
+    bool processEvents(IVTRego6xxCtrl& ctrl);
+
+    /**
+     * Get the next pseudo random number.
+     *
+     * @return Pseudo random number [0; 65535]
+     */
+    uint32_t getRandom();
+
+    /**
+     * Mark a scripted change of an entity, which shall be read until the deadline.
+     *
+     * @param[in] entity    The entity
+     * @param[in] deadline  Deadline in ms
+     */
+    void markChange(Entity& entity, uint32_t deadline);
+
+    /**
+     * Handle a completed transaction.
+     *
+     * @param[in] cmdId Command id
+     * @param[in] addr  Address
+     */
+    void handleCompleted(uint8_t cmdId, uint16_t addr);
+
+    /**
+     * Log the report of the current run.
+     */
+    void reportRun();
+
+    /**
+     * Log the comparison table of all runs.
+     */
+    void reportComparison();
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+#endif /* IVT_REGO6XX_POLLING_BENCHMARK */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
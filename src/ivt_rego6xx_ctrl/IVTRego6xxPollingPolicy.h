@@ -0,0 +1,98 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Polling policy of the IVT rego6xx controller component
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "SimpleTimer.hpp"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * Polling policy, which determines how often the entities are read from
+ * the heatpump. The default is the production policy.
+ */
+struct IVTRego6xxPollingPolicy
+{
+    uint32_t sensorReadPeriod;       /**< Period in ms for reading sensors from heatpump. */
+    uint32_t binarySensorReadPeriod; /**< Period in ms for reading binary sensors from heatpump. */
+    uint32_t textSensorReadPeriod;   /**< Period in ms for reading text sensors from heatpump. */
+    uint32_t numberReadPeriod;       /**< Period in ms for reading numbers from heatpump. */
+    uint32_t requestPause;           /**< Pause between every request to the heatpump controller in ms. */
+    bool     isButtonPreemptive;     /**< Are buttons and number updates handled after every request or only once per round? */
+
+    /**
+     * Constructs the production polling policy.
+     */
+    IVTRego6xxPollingPolicy() :
+        sensorReadPeriod(SIMPLE_TIMER_MINUTES(2U)),
+        binarySensorReadPeriod(SIMPLE_TIMER_SECONDS(30U)),
+        textSensorReadPeriod(SIMPLE_TIMER_SECONDS(30U)),
+        numberReadPeriod(SIMPLE_TIMER_SECONDS(60U)),
+        requestPause(100U),
+        isButtonPreemptive(true)
+    {
+    }
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
@@ -0,0 +1,386 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Operating mode aware polling profiles
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IVTRego6xxPollingProfiles.h"
+#include "Rego6xxCtrl.h"
+#include "SimpleTimer.hpp"
+#include "esphome/core/log.h"
+#include <stdio.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+namespace esphome
+{
+namespace ivt_rego6xx_ctrl
+{
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/**
+ * Logger tag of this component.
+ */
+static const char* TAG = "ivt_rego6xx_ctrl.polling_profiles";
+
+/** Names of the profiles, which are the label values in the metrics too. */
+static const char* PROFILE_NAMES[IVTRego6xxPollingProfiles::PROFILE_COUNT] = {
+    "idle",
+    "heating",
+    "hot_water",
+    "alarm"
+};
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool IVTRego6xxPollingProfiles::addEntity(const EntityBase* entity, Kind kind)
+{
+    bool isSuccessful = false;
+
+    if ((nullptr != entity) &&
+        (KIND_COUNT > kind) &&
+        (MAX_ENTITIES > m_entityCount))
+    {
+        EntityPeriods& entityPeriods = m_entities[m_entityCount];
+        size_t         idx           = 0U;
+
+        entityPeriods.entity   = entity;
+        entityPeriods.kind           = kind;
+        entityPeriods.adaptivePeriod = 0U;
+        entityPeriods.lastRead       = 0U;
+        entityPeriods.isRead         = false;
+
+        for (idx = 0U; idx < PROFILE_COUNT; ++idx)
+        {
+            entityPeriods.periods[idx] = 0U;
+        }
+
+        ++m_entityCount;
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+bool IVTRego6xxPollingProfiles::setPeriod(const EntityBase* entity, Profile profile, uint32_t period)
+{
+    bool           isSuccessful  = false;
+    EntityPeriods* entityPeriods = findEntity(entity);
+
+    if ((nullptr != entityPeriods) &&
+        (PROFILE_COUNT > profile))
+    {
+        entityPeriods->periods[profile] = period;
+        isSuccessful                    = true;
+    }
+
+    return isSuccessful;
+}
+
+bool IVTRego6xxPollingProfiles::setAdaptivePeriod(const EntityBase* entity, uint32_t period)
+{
+    bool           isSuccessful  = false;
+    EntityPeriods* entityPeriods = findEntity(entity);
+
+    if (nullptr != entityPeriods)
+    {
+        entityPeriods->adaptivePeriod = period;
+        isSuccessful                  = true;
+
+        if (0U < period)
+        {
+            m_isAdaptive = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+bool IVTRego6xxPollingProfiles::update(uint8_t cmdId, uint16_t addr, uint32_t value)
+{
+    bool    isChanged = false;
+    uint8_t state     = 0U;
+
+    if (Rego6xxCtrl::CMD_ID_READ_SYSTEM_REG == cmdId)
+    {
+        switch (addr)
+        {
+        case Rego6xxCtrl::SYSREG_ADDR_COMPRESSOR:
+            state = STATE_COMPRESSOR;
+            break;
+
+        case Rego6xxCtrl::SYSREG_ADDR_VXV:
+            state = STATE_VXV;
+            break;
+
+        case Rego6xxCtrl::SYSREG_ADDR_ALARM:
+            state = STATE_ALARM;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    if ((true == m_isEnabled) &&
+        (0U != state))
+    {
+        uint32_t now      = SimpleTimer::now();
+        Profile  detected = PROFILE_IDLE;
+
+        if (0U != value)
+        {
+            m_states |= state;
+        }
+        else
+        {
+            m_states &= static_cast<uint8_t>(~state);
+        }
+
+        detected = getDetectedProfile();
+
+        if (m_profile == detected)
+        {
+            /* A pending change is dropped. */
+            m_candidate = detected;
+        }
+        else
+        {
+            if (m_candidate != detected)
+            {
+                m_candidate      = detected;
+                m_candidateSince = now;
+            }
+
+            /* An alarm shall be observed closely at once. */
+            if ((PROFILE_ALARM == detected) ||
+                (m_holdTime <= (now - m_candidateSince)))
+            {
+                ESP_LOGI(TAG, "Polling profile changed from '%s' to '%s'.", getName(m_profile), getName(detected));
+
+                m_profile = detected;
+                ++m_changes;
+                isChanged = true;
+            }
+        }
+    }
+
+    return isChanged;
+}
+
+uint32_t IVTRego6xxPollingProfiles::getRoundPeriod(Kind kind, uint32_t kindPeriod) const
+{
+    uint32_t roundPeriod = kindPeriod;
+    size_t   idx         = 0U;
+
+    if ((true == m_isEnabled) ||
+        (true == m_isAdaptive))
+    {
+        roundPeriod = UINT32_MAX;
+
+        for (idx = 0U; idx < m_entityCount; ++idx)
+        {
+            if (kind == m_entities[idx].kind)
+            {
+                uint32_t period = getPeriod(m_entities[idx], kindPeriod);
+
+                if (roundPeriod > period)
+                {
+                    roundPeriod = period;
+                }
+            }
+        }
+
+        /* No entity of this kind. */
+        if (UINT32_MAX == roundPeriod)
+        {
+            roundPeriod = kindPeriod;
+        }
+    }
+
+    return roundPeriod;
+}
+
+bool IVTRego6xxPollingProfiles::isDue(const EntityBase* entity, uint32_t kindPeriod) const
+{
+    bool                 isDue         = true;
+    const EntityPeriods* entityPeriods = findEntity(entity);
+
+    /* An entity, which was never read, is always due. */
+    if (((true == m_isEnabled) || (true == m_isAdaptive)) &&
+        (nullptr != entityPeriods) &&
+        (true == entityPeriods->isRead))
+    {
+        uint32_t period      = getPeriod(*entityPeriods, kindPeriod);
+        uint32_t roundPeriod = getRoundPeriod(entityPeriods->kind, kindPeriod);
+        uint32_t elapsed     = SimpleTimer::now() - entityPeriods->lastRead;
+
+        /* The entity is read somewhere within a round, therefore half a round is tolerated.
+         * Otherwise an entity with the round period would be read only every second round.
+         */
+        if ((elapsed + (roundPeriod / 2U)) < period)
+        {
+            isDue = false;
+        }
+    }
+
+    return isDue;
+}
+
+void IVTRego6xxPollingProfiles::markRead(const EntityBase* entity)
+{
+    EntityPeriods* entityPeriods = findEntity(entity);
+
+    if (nullptr != entityPeriods)
+    {
+        entityPeriods->lastRead = SimpleTimer::now();
+        entityPeriods->isRead   = true;
+    }
+}
+
+const char* IVTRego6xxPollingProfiles::getName(Profile profile)
+{
+    return (PROFILE_COUNT > profile) ? PROFILE_NAMES[profile] : "unknown";
+}
+
+void IVTRego6xxPollingProfiles::writeMetrics(std::string& out) const
+{
+    char   line[80];
+    size_t idx = 0U;
+
+    out += "# TYPE ivt_rego6xx_polling_profile gauge\n";
+
+    for (idx = 0U; idx < PROFILE_COUNT; ++idx)
+    {
+        (void)snprintf(line, sizeof(line), "ivt_rego6xx_polling_profile{profile=\"%s\"} %u\n",
+            PROFILE_NAMES[idx],
+            (idx == static_cast<size_t>(m_profile)) ? 1U : 0U);
+        out += line;
+    }
+
+    out += "# TYPE ivt_rego6xx_polling_profile_changes_total counter\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_polling_profile_changes_total %u\n", static_cast<unsigned int>(m_changes));
+    out += line;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+IVTRego6xxPollingProfiles::EntityPeriods* IVTRego6xxPollingProfiles::findEntity(const EntityBase* entity)
+{
+    EntityPeriods* entityPeriods = nullptr;
+    size_t         idx           = 0U;
+
+    while ((nullptr == entityPeriods) && (idx < m_entityCount))
+    {
+        if (entity == m_entities[idx].entity)
+        {
+            entityPeriods = &m_entities[idx];
+        }
+
+        ++idx;
+    }
+
+    return entityPeriods;
+}
+
+const IVTRego6xxPollingProfiles::EntityPeriods* IVTRego6xxPollingProfiles::findEntity(const EntityBase* entity) const
+{
+    const EntityPeriods* entityPeriods = nullptr;
+    size_t               idx           = 0U;
+
+    while ((nullptr == entityPeriods) && (idx < m_entityCount))
+    {
+        if (entity == m_entities[idx].entity)
+        {
+            entityPeriods = &m_entities[idx];
+        }
+
+        ++idx;
+    }
+
+    return entityPeriods;
+}
+
+IVTRego6xxPollingProfiles::Profile IVTRego6xxPollingProfiles::getDetectedProfile() const
+{
+    Profile profile = PROFILE_IDLE;
+
+    if (0U != (m_states & STATE_ALARM))
+    {
+        profile = PROFILE_ALARM;
+    }
+    else if (0U != (m_states & STATE_COMPRESSOR))
+    {
+        profile = (0U != (m_states & STATE_VXV)) ? PROFILE_HOT_WATER : PROFILE_HEATING;
+    }
+    else
+    {
+        profile = PROFILE_IDLE;
+    }
+
+    return profile;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
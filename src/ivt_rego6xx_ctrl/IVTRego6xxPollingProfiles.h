@@ -0,0 +1,354 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Operating mode aware polling profiles
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <stdint.h>
+#include "esphome/core/component.h"
+#include <string>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * Selects the polling profile from the operating mode of the heatpump and
+ * provides the read period of every entity in the active profile.
+ *
+ * The operating mode is decoded from the system registers of the compressor,
+ * the three-way valve VXV and the alarm, whenever they are read. A new
+ * profile is activated only after it was detected for the hold time, which
+ * avoids toggling around a short compressor start. The alarm profile is
+ * activated at once.
+ *
+ * An entity without a period in the active profile is read with the period
+ * of its kind from the polling policy. An entity with a period is skipped in
+ * the rounds of its kind until its period elapsed, therefore the round period
+ * of a kind is the shortest period of its entities.
+ *
+ * An adaptive period, which follows the rate of change of the entity value,
+ * overrides the periods of the profiles.
+ */
+class IVTRego6xxPollingProfiles
+{
+public:
+
+    /**
+     * Polling profile, which is selected by the operating mode.
+     */
+    enum Profile
+    {
+        PROFILE_IDLE = 0U,  /**< Compressor off and no alarm. */
+        PROFILE_HEATING,    /**< Compressor on with the VXV in heating position. */
+        PROFILE_HOT_WATER,  /**< Compressor on with the VXV in hot water position. */
+        PROFILE_ALARM,      /**< Alarm is active. */
+        PROFILE_COUNT       /**< Number of profiles */
+    };
+
+    /**
+     * Kind of entity.
+     */
+    enum Kind
+    {
+        KIND_SENSOR = 0U,   /**< Sensor */
+        KIND_BINARY_SENSOR, /**< Binary sensor */
+        KIND_TEXT_SENSOR,   /**< Text sensor */
+        KIND_NUMBER,        /**< Number */
+        KIND_COUNT          /**< Number of entity kinds. */
+    };
+
+    /** Maximum number of entities, which covers all reading entities of the controller. */
+    static const size_t MAX_ENTITIES = 33U;
+
+    /**
+     * Constructs the polling profiles.
+     */
+    IVTRego6xxPollingProfiles() :
+        m_isEnabled(false),
+        m_isAdaptive(false),
+        m_holdTime(0U),
+        m_entityCount(0U),
+        m_entities(),
+        m_states(0U),
+        m_profile(PROFILE_IDLE),
+        m_candidate(PROFILE_IDLE),
+        m_candidateSince(0U),
+        m_changes(0U)
+    {
+    }
+
+    /**
+     * Destroys the polling profiles.
+     */
+    ~IVTRego6xxPollingProfiles()
+    {
+    }
+
+    /**
+     * Enable the selection of the polling profile by the operating mode.
+     * Without, the idle profile is never left and no period applies.
+     *
+     * @param[in] holdTime  Time in ms, a new operating mode shall be detected until its profile is activated.
+     */
+    void enable(uint32_t holdTime)
+    {
+        m_isEnabled = true;
+        m_holdTime  = holdTime;
+    }
+
+    /**
+     * Is the selection of the polling profile enabled?
+     *
+     * @return If enabled, it will return true otherwise false.
+     */
+    bool isEnabled() const
+    {
+        return m_isEnabled;
+    }
+
+    /**
+     * Add an entity, which is read cyclic.
+     *
+     * @param[in] entity    Entity
+     * @param[in] kind      Kind of entity
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addEntity(const EntityBase* entity, Kind kind);
+
+    /**
+     * Set the read period of an entity in a profile.
+     *
+     * @param[in] entity    Entity
+     * @param[in] profile   Profile
+     * @param[in] period    Read period in ms. 0 uses the period of its kind.
+     *
+     * @return If the entity is known, it will return true otherwise false.
+     */
+    bool setPeriod(const EntityBase* entity, Profile profile, uint32_t period);
+
+    /**
+     * Set the adaptive read period of an entity, which overrides the periods
+     * of the profiles.
+     *
+     * @param[in] entity    Entity
+     * @param[in] period    Read period in ms. 0 uses the periods of the profiles.
+     *
+     * @return If the entity is known, it will return true otherwise false.
+     */
+    bool setAdaptivePeriod(const EntityBase* entity, uint32_t period);
+
+    /**
+     * Decode the operating mode from a read system register and select
+     * the profile.
+     *
+     * @param[in] cmdId Command id of the read
+     * @param[in] addr  Address of the read
+     * @param[in] value Read raw value
+     *
+     * @return If the profile changed, it will return true otherwise false.
+     */
+    bool update(uint8_t cmdId, uint16_t addr, uint32_t value);
+
+    /**
+     * Get the active profile.
+     *
+     * @return Profile
+     */
+    Profile getProfile() const
+    {
+        return m_profile;
+    }
+
+    /**
+     * Get the round period of a kind of entities in the active profile,
+     * which is the shortest period of its entities.
+     *
+     * @param[in] kind          Kind of entity
+     * @param[in] kindPeriod    Period in ms of the kind from the polling policy.
+     *
+     * @return Round period in ms
+     */
+    uint32_t getRoundPeriod(Kind kind, uint32_t kindPeriod) const;
+
+    /**
+     * Shall an entity be read in the current round of its kind?
+     *
+     * @param[in] entity        Entity
+     * @param[in] kindPeriod    Period in ms of its kind from the polling policy.
+     *
+     * @return If the entity shall be read, it will return true otherwise false.
+     */
+    bool isDue(const EntityBase* entity, uint32_t kindPeriod) const;
+
+    /**
+     * Mark an entity as read, independent of the result.
+     *
+     * @param[in] entity    Entity
+     */
+    void markRead(const EntityBase* entity);
+
+    /**
+     * Get the name of a profile.
+     *
+     * @param[in] profile   Profile
+     *
+     * @return Name
+     */
+    static const char* getName(Profile profile);
+
+    /**
+     * Append the active profile and the number of profile changes in the
+     * Prometheus text format.
+     *
+     * @param[out] out  Output
+     */
+    void writeMetrics(std::string& out) const;
+
+private:
+
+    /**
+     * Read periods of a single entity.
+     */
+    struct EntityPeriods
+    {
+        const EntityBase* entity;                  /**< Entity */
+        Kind              kind;                    /**< Kind of entity */
+        uint32_t          periods[PROFILE_COUNT];  /**< Read period in ms per profile. 0 uses the period of its kind. */
+        uint32_t          adaptivePeriod;          /**< Adaptive read period in ms, which overrides the profiles. 0 if not adaptive. */
+        uint32_t          lastRead;                /**< Timestamp of the last read in ms. */
+        bool              isRead;                  /**< Was the entity ever read? */
+    };
+
+    /**
+     * Decoded state of the heatpump, bit per state.
+     */
+    enum State
+    {
+        STATE_COMPRESSOR = 0x01U,   /**< Compressor is on. */
+        STATE_VXV        = 0x02U,   /**< VXV is in hot water position. */
+        STATE_ALARM      = 0x04U    /**< Alarm is active. */
+    };
+
+    bool           m_isEnabled;              /**< Is the selection of the polling profile enabled? */
+    bool           m_isAdaptive;             /**< Has any entity an adaptive read period? */
+    uint32_t       m_holdTime;               /**< Time in ms, a new operating mode shall be detected until its profile is activated. */
+    size_t         m_entityCount;            /**< Number of entities */
+    EntityPeriods  m_entities[MAX_ENTITIES]; /**< Read periods of the entities */
+    uint8_t        m_states;                 /**< Decoded state of the heatpump */
+    Profile        m_profile;                /**< Active profile */
+    Profile        m_candidate;              /**< Profile of the detected operating mode, which waits for the hold time. */
+    uint32_t       m_candidateSince;         /**< Timestamp in ms, since the candidate is detected. */
+    uint32_t       m_changes;                /**< Number of profile changes */
+
+    IVTRego6xxPollingProfiles(const IVTRego6xxPollingProfiles& other);
+    IVTRego6xxPollingProfiles& operator=(const IVTRego6xxPollingProfiles& other);
+
+    /**
+     * Find the read periods of an entity.
+     *
+     * @param[in] entity    Entity
+     *
+     * @return Entity periods or nullptr if not found.
+     */
+    EntityPeriods* findEntity(const EntityBase* entity);
+
+    /**
+     * Find the read periods of an entity.
+     *
+     * @param[in] entity    Entity
+     *
+     * @return Entity periods or nullptr if not found.
+     */
+    const EntityPeriods* findEntity(const EntityBase* entity) const;
+
+    /**
+     * Get the profile of the decoded operating mode.
+     *
+     * @return Profile
+     */
+    Profile getDetectedProfile() const;
+
+    /**
+     * Get the read period of an entity, which is its adaptive period or its
+     * period in the active profile.
+     *
+     * @param[in] entityPeriods Read periods of the entity
+     * @param[in] kindPeriod    Period in ms of its kind from the polling policy.
+     *
+     * @return Read period in ms
+     */
+    uint32_t getPeriod(const EntityPeriods& entityPeriods, uint32_t kindPeriod) const
+    {
+        uint32_t period = entityPeriods.adaptivePeriod;
+
+        if ((0U == period) &&
+            (true == m_isEnabled))
+        {
+            period = entityPeriods.periods[m_profile];
+        }
+
+        return (0U == period) ? kindPeriod : period;
+    }
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
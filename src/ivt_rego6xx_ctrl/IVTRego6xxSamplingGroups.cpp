@@ -0,0 +1,298 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Coherent sampling groups
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IVTRego6xxSamplingGroups.h"
+#include "IVTRego6xxMetrics.h"
+#include "SimpleTimer.hpp"
+#include <stdio.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+namespace esphome
+{
+namespace ivt_rego6xx_ctrl
+{
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool IVTRego6xxSamplingGroups::addGroup(const char* name)
+{
+    bool isSuccessful = false;
+
+    if ((nullptr != name) &&
+        (MAX_GROUPS > m_groupCount))
+    {
+        Group& group = m_groups[m_groupCount];
+
+        group.name       = name;
+        group.timestamp  = 0U;
+        group.firstValue = 0U;
+        group.skew       = 0U;
+        group.maxSkew    = 0U;
+        group.passes     = 0U;
+
+        ++m_groupCount;
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+bool IVTRego6xxSamplingGroups::addMember(const EntityBase* entity)
+{
+    bool isSuccessful = false;
+
+    /* A sensor can be member of a single group only. */
+    if ((nullptr != entity) &&
+        (0U < m_groupCount) &&
+        (MAX_MEMBERS > m_memberCount) &&
+        (MAX_MEMBERS == findMember(entity)))
+    {
+        Member& member = m_members[m_memberCount];
+
+        member.entity  = entity;
+        member.group   = m_groupCount - 1U;
+        member.value   = 0.0F;
+        member.isValid = false;
+        member.isDone  = false;
+
+        ++m_memberCount;
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+size_t IVTRego6xxSamplingGroups::getGroup(const EntityBase* entity) const
+{
+    size_t idx = findMember(entity);
+
+    return (MAX_MEMBERS > idx) ? m_members[idx].group : NO_GROUP;
+}
+
+bool IVTRego6xxSamplingGroups::isInPass(const EntityBase* entity) const
+{
+    return (NO_GROUP != m_activeGroup) && (m_activeGroup == getGroup(entity));
+}
+
+void IVTRego6xxSamplingGroups::markRequested(const EntityBase* entity)
+{
+    size_t group = getGroup(entity);
+
+    if ((NO_GROUP != group) &&
+        (NO_GROUP == m_activeGroup))
+    {
+        size_t idx = 0U;
+
+        for (idx = 0U; idx < m_memberCount; ++idx)
+        {
+            if (group == m_members[idx].group)
+            {
+                m_members[idx].isValid = false;
+                m_members[idx].isDone  = false;
+            }
+        }
+
+        m_groups[group].timestamp = SimpleTimer::now();
+        m_activeGroup             = group;
+    }
+}
+
+void IVTRego6xxSamplingGroups::setValue(const EntityBase* entity, float value)
+{
+    size_t idx = findMember(entity);
+
+    if ((MAX_MEMBERS > idx) &&
+        (m_activeGroup == m_members[idx].group))
+    {
+        Group&   group    = m_groups[m_activeGroup];
+        uint32_t now      = SimpleTimer::now();
+        bool     isFirst  = true;
+        size_t   otherIdx = 0U;
+
+        for (otherIdx = 0U; otherIdx < m_memberCount; ++otherIdx)
+        {
+            if ((m_activeGroup == m_members[otherIdx].group) &&
+                (true == m_members[otherIdx].isValid))
+            {
+                isFirst = false;
+            }
+        }
+
+        if (true == isFirst)
+        {
+            group.firstValue = now;
+        }
+
+        m_members[idx].value   = value;
+        m_members[idx].isValid = true;
+        group.skew             = now - group.firstValue;
+    }
+}
+
+bool IVTRego6xxSamplingGroups::markDone(const EntityBase* entity)
+{
+    bool   isComplete = false;
+    size_t idx        = findMember(entity);
+
+    if ((MAX_MEMBERS > idx) &&
+        (m_activeGroup == m_members[idx].group))
+    {
+        size_t otherIdx = 0U;
+
+        m_members[idx].isDone = true;
+        isComplete            = true;
+
+        for (otherIdx = 0U; otherIdx < m_memberCount; ++otherIdx)
+        {
+            if ((m_activeGroup == m_members[otherIdx].group) &&
+                (false == m_members[otherIdx].isDone))
+            {
+                isComplete = false;
+            }
+        }
+
+        if (true == isComplete)
+        {
+            Group& group = m_groups[m_activeGroup];
+
+            if (group.maxSkew < group.skew)
+            {
+                group.maxSkew = group.skew;
+            }
+
+            ++group.passes;
+            m_activeGroup = NO_GROUP;
+        }
+    }
+
+    return isComplete;
+}
+
+bool IVTRego6xxSamplingGroups::getValue(const EntityBase* entity, float& value) const
+{
+    bool   isValid = false;
+    size_t idx     = findMember(entity);
+
+    /* Values of a pass in progress are not coherent yet. */
+    if ((MAX_MEMBERS > idx) &&
+        (m_activeGroup != m_members[idx].group) &&
+        (true == m_members[idx].isValid))
+    {
+        value   = m_members[idx].value;
+        isValid = true;
+    }
+
+    return isValid;
+}
+
+void IVTRego6xxSamplingGroups::writeMetrics(std::string& out) const
+{
+    char   line[96];
+    size_t idx = 0U;
+
+    out += "# TYPE ivt_rego6xx_sampling_group_passes_total counter\n";
+    for (idx = 0U; idx < m_groupCount; ++idx)
+    {
+        out += "ivt_rego6xx_sampling_group_passes_total{group=\"";
+        appendLabelValue(out, m_groups[idx].name);
+        (void)snprintf(line, sizeof(line), "\"} %u\n", static_cast<unsigned int>(m_groups[idx].passes));
+        out += line;
+    }
+
+    out += "# TYPE ivt_rego6xx_sampling_group_skew_ms gauge\n";
+    for (idx = 0U; idx < m_groupCount; ++idx)
+    {
+        out += "ivt_rego6xx_sampling_group_skew_ms{group=\"";
+        appendLabelValue(out, m_groups[idx].name);
+        (void)snprintf(line, sizeof(line), "\",statistic=\"last\"} %u\n", static_cast<unsigned int>(m_groups[idx].skew));
+        out += line;
+
+        out += "ivt_rego6xx_sampling_group_skew_ms{group=\"";
+        appendLabelValue(out, m_groups[idx].name);
+        (void)snprintf(line, sizeof(line), "\",statistic=\"max\"} %u\n", static_cast<unsigned int>(m_groups[idx].maxSkew));
+        out += line;
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+size_t IVTRego6xxSamplingGroups::findMember(const EntityBase* entity) const
+{
+    size_t idx = 0U;
+
+    while ((idx < m_memberCount) && (entity != m_members[idx].entity))
+    {
+        ++idx;
+    }
+
+    return (idx < m_memberCount) ? idx : MAX_MEMBERS;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
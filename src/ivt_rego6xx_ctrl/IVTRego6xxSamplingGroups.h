@@ -0,0 +1,301 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Coherent sampling groups
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <stdint.h>
+#include "esphome/core/component.h"
+#include <string>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * Groups of sensors, which are read back to back as one unit.
+ *
+ * A pass of a group starts with the request of its first member and
+ * completes after the last member was read. The start of the pass is the
+ * shared timestamp of the member values. The values of a completed pass are
+ * coherent and can be combined, e.g. to a delta.
+ */
+class IVTRego6xxSamplingGroups
+{
+public:
+
+    /** Maximum number of groups. */
+    static const size_t MAX_GROUPS = 4U;
+
+    /** Maximum number of members of all groups, which covers all sensors of the controller. */
+    static const size_t MAX_MEMBERS = 11U;
+
+    /** Group index of an entity, which is no member. */
+    static const size_t NO_GROUP = MAX_GROUPS;
+
+    /**
+     * Constructs the sampling groups.
+     */
+    IVTRego6xxSamplingGroups() :
+        m_groupCount(0U),
+        m_groups(),
+        m_memberCount(0U),
+        m_members(),
+        m_activeGroup(NO_GROUP)
+    {
+    }
+
+    /**
+     * Destroys the sampling groups.
+     */
+    ~IVTRego6xxSamplingGroups()
+    {
+    }
+
+    /**
+     * Add a group. The following members are added to it.
+     *
+     * @param[in] name  Name of the group
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addGroup(const char* name);
+
+    /**
+     * Add a member to the last added group.
+     *
+     * @param[in] entity    Sensor
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addMember(const EntityBase* entity);
+
+    /**
+     * Get the number of groups.
+     *
+     * @return Number of groups
+     */
+    size_t getGroupCount() const
+    {
+        return m_groupCount;
+    }
+
+    /**
+     * Get the group of an entity.
+     *
+     * @param[in] entity    Entity
+     *
+     * @return Group index or NO_GROUP if the entity is no member.
+     */
+    size_t getGroup(const EntityBase* entity) const;
+
+    /**
+     * Get the number of members of all groups.
+     *
+     * @return Number of members
+     */
+    size_t getMemberCount() const
+    {
+        return m_memberCount;
+    }
+
+    /**
+     * Get a member. The members of a group follow each other.
+     *
+     * @param[in] idx   Member index
+     *
+     * @return Member entity or nullptr if the index is invalid.
+     */
+    const EntityBase* getMember(size_t idx) const
+    {
+        return (m_memberCount > idx) ? m_members[idx].entity : nullptr;
+    }
+
+    /**
+     * Is a pass of a group in progress?
+     *
+     * @return If in progress, it will return true otherwise false.
+     */
+    bool isPassActive() const
+    {
+        return (NO_GROUP != m_activeGroup);
+    }
+
+    /**
+     * Is an entity member of the group, whose pass is in progress?
+     *
+     * @param[in] entity    Entity
+     *
+     * @return If it is, it will return true otherwise false.
+     */
+    bool isInPass(const EntityBase* entity) const;
+
+    /**
+     * Get the shared timestamp of the member values of a group, which is
+     * the start of its last pass.
+     *
+     * @param[in] group Group index
+     *
+     * @return Timestamp in ms
+     */
+    uint32_t getTimestamp(size_t group) const
+    {
+        return (m_groupCount > group) ? m_groups[group].timestamp : 0U;
+    }
+
+    /**
+     * Abort the pass in progress, e.g. if the polling starts from the beginning.
+     */
+    void abortPass()
+    {
+        m_activeGroup = NO_GROUP;
+    }
+
+    /**
+     * Mark a member as requested. The first requested member starts the
+     * pass of its group.
+     *
+     * @param[in] entity    Entity
+     */
+    void markRequested(const EntityBase* entity);
+
+    /**
+     * Set the read value of a member in the current pass.
+     *
+     * @param[in] entity    Entity
+     * @param[in] value     Read value
+     */
+    void setValue(const EntityBase* entity, float value);
+
+    /**
+     * Mark a member as read, independent of the result.
+     *
+     * @param[in] entity    Entity
+     *
+     * @return If the pass of its group is complete by it, it will return true otherwise false.
+     */
+    bool markDone(const EntityBase* entity);
+
+    /**
+     * Get the value of a member in the last completed pass of its group.
+     *
+     * @param[in] entity    Entity
+     * @param[out] value    Value
+     *
+     * @return If the value is valid, it will return true otherwise false.
+     */
+    bool getValue(const EntityBase* entity, float& value) const;
+
+    /**
+     * Append the number of passes and the time between the first and the
+     * last member value of every group in the Prometheus text format.
+     *
+     * @param[out] out  Output
+     */
+    void writeMetrics(std::string& out) const;
+
+private:
+
+    /**
+     * Sampling group.
+     */
+    struct Group
+    {
+        const char* name;       /**< Name of the group */
+        uint32_t    timestamp;  /**< Shared timestamp of the member values in ms, which is the start of the pass. */
+        uint32_t    firstValue; /**< Timestamp of the first member value in the pass in ms. */
+        uint32_t    skew;       /**< Time between the first and the last member value of the last pass in ms. */
+        uint32_t    maxSkew;    /**< Maximum time between the first and the last member value in ms. */
+        uint32_t    passes;     /**< Number of completed passes */
+    };
+
+    /**
+     * Member of a sampling group.
+     */
+    struct Member
+    {
+        const EntityBase* entity;   /**< Sensor */
+        size_t            group;    /**< Group index */
+        float             value;    /**< Value of the pass */
+        bool              isValid;  /**< Is the value valid? */
+        bool              isDone;   /**< Is the member read in the pass? */
+    };
+
+    size_t m_groupCount;            /**< Number of groups */
+    Group  m_groups[MAX_GROUPS];    /**< Groups */
+    size_t m_memberCount;           /**< Number of members */
+    Member m_members[MAX_MEMBERS];  /**< Members, ordered by group. */
+    size_t m_activeGroup;           /**< Group, whose pass is in progress or NO_GROUP. */
+
+    IVTRego6xxSamplingGroups(const IVTRego6xxSamplingGroups& other);
+    IVTRego6xxSamplingGroups& operator=(const IVTRego6xxSamplingGroups& other);
+
+    /**
+     * Find a member.
+     *
+     * @param[in] entity    Entity
+     *
+     * @return Member index or MAX_MEMBERS if not found.
+     */
+    size_t findMember(const EntityBase* entity) const;
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
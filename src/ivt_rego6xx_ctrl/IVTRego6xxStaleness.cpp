@@ -0,0 +1,277 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Staleness of the entity values
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IVTRego6xxStaleness.h"
+#include "SimpleTimer.hpp"
+#include "IVTRego6xxMetrics.h"
+#include "esphome/core/log.h"
+#include <stdio.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+namespace esphome
+{
+namespace ivt_rego6xx_ctrl
+{
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/**
+ * Logger tag of this component.
+ */
+static const char* TAG = "ivt_rego6xx_ctrl.staleness";
+
+/** Label values of the entity kinds in the metrics. */
+static const char* KIND_LABELS[IVTRego6xxStaleness::KIND_COUNT] = {
+    "sensor",
+    "binary_sensor",
+    "text_sensor",
+    "number"
+};
+
+/** Percentiles of the ages in the metrics. */
+static const uint8_t AGE_PERCENTILES[] = { 50U, 95U };
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool IVTRego6xxStaleness::addEntity(const EntityBase* entity, Kind kind)
+{
+    bool isSuccessful = false;
+
+    if ((nullptr != entity) &&
+        (KIND_COUNT > kind) &&
+        (MAX_ENTITIES > m_entityCount))
+    {
+        EntityAge& entityAge = m_entities[m_entityCount];
+
+        entityAge.entity      = entity;
+        entityAge.kind        = kind;
+        entityAge.maxAge      = 0U;
+        entityAge.lastSuccess = 0U;
+        entityAge.isRead      = false;
+        entityAge.isViolated  = false;
+
+        ++m_entityCount;
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+bool IVTRego6xxStaleness::setMaxAge(const EntityBase* entity, uint32_t maxAge)
+{
+    bool       isSuccessful = false;
+    EntityAge* entityAge    = findEntity(entity);
+
+    if (nullptr != entityAge)
+    {
+        entityAge->maxAge = maxAge;
+        isSuccessful      = true;
+    }
+
+    return isSuccessful;
+}
+
+void IVTRego6xxStaleness::begin()
+{
+    m_start = SimpleTimer::now();
+}
+
+void IVTRego6xxStaleness::refresh(const EntityBase* entity)
+{
+    EntityAge* entityAge = findEntity(entity);
+
+    if (nullptr != entityAge)
+    {
+        uint32_t now = SimpleTimer::now();
+
+        /* The first read after start is aged from the start too, which shows the startup latency. */
+        m_ages[entityAge->kind].add(getAge(*entityAge, now) / 1000U);
+
+        entityAge->lastSuccess = now;
+        entityAge->isRead      = true;
+    }
+}
+
+bool IVTRego6xxStaleness::check()
+{
+    uint32_t now            = SimpleTimer::now();
+    uint32_t violationCount = 0U;
+    size_t   idx            = 0U;
+
+    for (idx = 0U; idx < m_entityCount; ++idx)
+    {
+        EntityAge& entityAge  = m_entities[idx];
+        bool       isViolated = false;
+
+        if (0U < entityAge.maxAge)
+        {
+            uint32_t age = getAge(entityAge, now);
+
+            if (entityAge.maxAge < age)
+            {
+                isViolated = true;
+                ++violationCount;
+
+                if (false == entityAge.isViolated)
+                {
+                    ESP_LOGW(TAG, "'%s' exceeds its maximum age of %u s.", entityAge.entity->get_name().c_str(), static_cast<unsigned int>(entityAge.maxAge / 1000U));
+                    ++m_violations;
+                }
+            }
+            else if (true == entityAge.isViolated)
+            {
+                ESP_LOGI(TAG, "'%s' is up to date again.", entityAge.entity->get_name().c_str());
+            }
+            else
+            {
+                ;
+            }
+        }
+
+        entityAge.isViolated = isViolated;
+    }
+
+    m_violationCount = violationCount;
+
+    return (0U < violationCount);
+}
+
+void IVTRego6xxStaleness::writeMetrics(std::string& out) const
+{
+    char     line[96];
+    uint32_t now = SimpleTimer::now();
+    size_t   idx = 0U;
+
+    out += "# TYPE ivt_rego6xx_entity_age_seconds gauge\n";
+    for (idx = 0U; idx < m_entityCount; ++idx)
+    {
+        const EntityAge& entityAge = m_entities[idx];
+
+        out += "ivt_rego6xx_entity_age_seconds{entity=\"";
+        appendLabelValue(out, entityAge.entity->get_name().c_str());
+        (void)snprintf(line, sizeof(line), "\"} %u\n", static_cast<unsigned int>(getAge(entityAge, now) / 1000U));
+        out += line;
+    }
+
+    out += "# TYPE ivt_rego6xx_refresh_age_seconds summary\n";
+    for (idx = 0U; idx < KIND_COUNT; ++idx)
+    {
+        const AgeHistogram& ages = m_ages[idx];
+        size_t              percentileIdx = 0U;
+
+        for (percentileIdx = 0U; percentileIdx < (sizeof(AGE_PERCENTILES) / sizeof(AGE_PERCENTILES[0])); ++percentileIdx)
+        {
+            uint8_t percentile = AGE_PERCENTILES[percentileIdx];
+
+            (void)snprintf(line, sizeof(line), "ivt_rego6xx_refresh_age_seconds{kind=\"%s\",quantile=\"0.%02u\"} %u\n", KIND_LABELS[idx], static_cast<unsigned int>(percentile), static_cast<unsigned int>(ages.getPercentile(percentile)));
+            out += line;
+        }
+
+        (void)snprintf(line, sizeof(line), "ivt_rego6xx_refresh_age_seconds{kind=\"%s\",quantile=\"1\"} %u\n", KIND_LABELS[idx], static_cast<unsigned int>(ages.getMax()));
+        out += line;
+        (void)snprintf(line, sizeof(line), "ivt_rego6xx_refresh_age_seconds_count{kind=\"%s\"} %u\n", KIND_LABELS[idx], static_cast<unsigned int>(ages.getCount()));
+        out += line;
+    }
+
+    out += "# TYPE ivt_rego6xx_stale_entities gauge\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_stale_entities %u\n", static_cast<unsigned int>(m_violationCount));
+    out += line;
+
+    out += "# TYPE ivt_rego6xx_staleness_violations_total counter\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_staleness_violations_total %u\n", static_cast<unsigned int>(m_violations));
+    out += line;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+IVTRego6xxStaleness::EntityAge* IVTRego6xxStaleness::findEntity(const EntityBase* entity)
+{
+    EntityAge* entityAge = nullptr;
+    size_t     idx       = 0U;
+
+    while ((nullptr == entityAge) && (idx < m_entityCount))
+    {
+        if (entity == m_entities[idx].entity)
+        {
+            entityAge = &m_entities[idx];
+        }
+
+        ++idx;
+    }
+
+    return entityAge;
+}
+
+uint32_t IVTRego6xxStaleness::getAge(const EntityAge& entityAge, uint32_t now) const
+{
+    uint32_t since = (true == entityAge.isRead) ? entityAge.lastSuccess : m_start;
+
+    return now - since;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
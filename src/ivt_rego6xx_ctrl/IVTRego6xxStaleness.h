@@ -0,0 +1,238 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Staleness of the entity values
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "esphome/core/component.h"
+#include "Histogram.hpp"
+#include <string>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * Tracks the time of the last successful read of every entity, which reads
+ * its value from the heatpump. The age of a value, when it is refreshed, is
+ * kept in a histogram per entity kind. An entity, which exceeds its
+ * configured maximum age, violates the service level.
+ *
+ * The values are written by the main loop and read by the webserver task.
+ * They are 32 bit wide, which is read atomically.
+ */
+class IVTRego6xxStaleness
+{
+public:
+
+    /**
+     * Kind of entity.
+     */
+    enum Kind
+    {
+        KIND_SENSOR = 0U,   /**< Sensor */
+        KIND_BINARY_SENSOR, /**< Binary sensor */
+        KIND_TEXT_SENSOR,   /**< Text sensor */
+        KIND_NUMBER,        /**< Number */
+        KIND_COUNT          /**< Number of entity kinds. */
+    };
+
+    /** Histogram of the ages in s, which resolves up to 12 days with a relative error of at most 25 %. */
+    typedef Histogram<2U, 20U> AgeHistogram;
+
+    /** Maximum number of entities, which covers all reading entities of the controller. */
+    static const size_t MAX_ENTITIES = 33U;
+
+    /**
+     * Constructs the staleness tracking.
+     */
+    IVTRego6xxStaleness() :
+        m_entityCount(0U),
+        m_entities(),
+        m_ages(),
+        m_start(0U),
+        m_violationCount(0U),
+        m_violations(0U)
+    {
+    }
+
+    /**
+     * Destroys the staleness tracking.
+     */
+    ~IVTRego6xxStaleness()
+    {
+    }
+
+    /**
+     * Add an entity, whose staleness shall be tracked.
+     *
+     * @param[in] entity    Entity
+     * @param[in] kind      Kind of entity
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addEntity(const EntityBase* entity, Kind kind);
+
+    /**
+     * Set the maximum age of the value of an entity.
+     *
+     * @param[in] entity    Entity
+     * @param[in] maxAge    Maximum age in ms. 0 disables the check.
+     *
+     * @return If the entity is tracked, it will return true otherwise false.
+     */
+    bool setMaxAge(const EntityBase* entity, uint32_t maxAge);
+
+    /**
+     * Start tracking. Entities, which were never read, are aged from now on.
+     */
+    void begin();
+
+    /**
+     * Mark the value of an entity as refreshed.
+     *
+     * @param[in] entity    Entity, which was read successfully.
+     */
+    void refresh(const EntityBase* entity);
+
+    /**
+     * Check all entities against their maximum age. Every change of a
+     * violation is logged.
+     *
+     * @return If at least one entity violates its maximum age, it will return true otherwise false.
+     */
+    bool check();
+
+    /**
+     * Get the number of entities, which currently violate their maximum age.
+     *
+     * @return Number of entities
+     */
+    uint32_t getViolationCount() const
+    {
+        return m_violationCount;
+    }
+
+    /**
+     * Get the age histogram of an entity kind.
+     *
+     * @param[in] kind  Kind of entity
+     *
+     * @return Age histogram or nullptr if the kind is invalid.
+     */
+    const AgeHistogram* getAges(Kind kind) const
+    {
+        return (KIND_COUNT > kind) ? &m_ages[kind] : nullptr;
+    }
+
+    /**
+     * Append the ages and violations in the Prometheus text format.
+     *
+     * @param[out] out  Output
+     */
+    void writeMetrics(std::string& out) const;
+
+private:
+
+    /**
+     * Staleness of a single entity.
+     */
+    struct EntityAge
+    {
+        const EntityBase* entity;      /**< Entity */
+        Kind              kind;        /**< Kind of entity */
+        uint32_t          maxAge;      /**< Maximum age in ms. 0 if not checked. */
+        uint32_t          lastSuccess; /**< Timestamp of the last successful read in ms. */
+        bool              isRead;      /**< Was the entity ever read successfully? */
+        bool              isViolated;  /**< Does the entity violate its maximum age? */
+    };
+
+    size_t       m_entityCount;            /**< Number of tracked entities. */
+    EntityAge    m_entities[MAX_ENTITIES]; /**< Staleness per entity. */
+    AgeHistogram m_ages[KIND_COUNT];       /**< Ages at refresh in s, per entity kind. */
+    uint32_t     m_start;                  /**< Timestamp in ms, since entities without read are aged. */
+    uint32_t     m_violationCount;         /**< Number of entities, which currently violate their maximum age. */
+    uint32_t     m_violations;             /**< Number of violations since start. */
+
+    IVTRego6xxStaleness(const IVTRego6xxStaleness& other);
+    IVTRego6xxStaleness& operator=(const IVTRego6xxStaleness& other);
+
+    /**
+     * Find the staleness of an entity.
+     *
+     * @param[in] entity    Entity
+     *
+     * @return Staleness of the entity or nullptr if not found.
+     */
+    EntityAge* findEntity(const EntityBase* entity);
+
+    /**
+     * Get the current age of an entity value.
+     *
+     * @param[in] entityAge Staleness of the entity
+     * @param[in] now       Current timestamp in ms
+     *
+     * @return Age in ms
+     */
+    uint32_t getAge(const EntityAge& entityAge, uint32_t now) const;
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
@@ -0,0 +1,310 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  IVT rego6xx controller batched telemetry
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IVTRego6xxTelemetry.h"
+#include "IVTRego6xxMetrics.h"
+#include <stdio.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+namespace esphome
+{
+namespace ivt_rego6xx_ctrl
+{
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Binary frame header magic. */
+static const char MAGIC[] = { 'R', '6', 'T', 'M' };
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool IVTRego6xxTelemetry::addEntity(const EntityBase* entity, Kind kind)
+{
+    bool isSuccessful = false;
+
+    if ((nullptr != entity) &&
+        (MAX_ENTITIES > m_entityCount))
+    {
+        EntityValue& entityValue = m_entities[m_entityCount];
+
+        entityValue.entity    = entity;
+        entityValue.kind      = kind;
+        entityValue.value     = 0U;
+        entityValue.isValid   = false;
+        entityValue.isChanged = false;
+
+        ++m_entityCount;
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+void IVTRego6xxTelemetry::update(const EntityBase* entity, uint32_t value)
+{
+    size_t idx = 0U;
+
+    while ((idx < m_entityCount) && (entity != m_entities[idx].entity))
+    {
+        ++idx;
+    }
+
+    if (idx < m_entityCount)
+    {
+        EntityValue& entityValue = m_entities[idx];
+        uint16_t     rawValue    = static_cast<uint16_t>(value & 0xFFFFU);
+
+        if ((false == entityValue.isValid) ||
+            (rawValue != entityValue.value))
+        {
+            entityValue.value     = rawValue;
+            entityValue.isValid   = true;
+            entityValue.isChanged = true;
+            m_isChanged           = true;
+        }
+    }
+}
+
+bool IVTRego6xxTelemetry::getValue(const EntityBase* entity, uint16_t& value) const
+{
+    bool   isAvailable = false;
+    size_t idx         = 0U;
+
+    while ((idx < m_entityCount) && (entity != m_entities[idx].entity))
+    {
+        ++idx;
+    }
+
+    if ((idx < m_entityCount) &&
+        (true == m_entities[idx].isValid))
+    {
+        const EntityValue& entityValue = m_entities[idx];
+
+        if (KIND_BOOL == entityValue.kind)
+        {
+            value = (0U == entityValue.value) ? 0U : 1U;
+        }
+        else
+        {
+            value = entityValue.value;
+        }
+
+        isAvailable = true;
+    }
+
+    return isAvailable;
+}
+
+void IVTRego6xxTelemetry::writeJson(std::string& out, bool isChangedOnly) const
+{
+    char   field[24];
+    size_t idx = 0U;
+
+    (void)snprintf(field, sizeof(field), "{\"seq\":%u", static_cast<unsigned int>(m_seq));
+    out += field;
+
+    for (idx = 0U; idx < m_entityCount; ++idx)
+    {
+        const EntityValue& entityValue = m_entities[idx];
+
+        /* The snapshot contains every entity, so it shows the complete field order. */
+        if ((false == isChangedOnly) ||
+            (true == isContained(entityValue, isChangedOnly)))
+        {
+            out += ",\"";
+            out += entityValue.entity->get_object_id();
+            out += "\":";
+
+            if (false == entityValue.isValid)
+            {
+                out += "null";
+            }
+            else if (KIND_BOOL == entityValue.kind)
+            {
+                out += (0U == entityValue.value) ? "0" : "1";
+            }
+            else
+            {
+                /* The raw value is 16-bit two's complement in tenths. */
+                int32_t  value     = static_cast<int16_t>(entityValue.value);
+                uint32_t magnitude = (0 > value) ? static_cast<uint32_t>(-value) : static_cast<uint32_t>(value);
+
+                (void)snprintf(field, sizeof(field), "%s%u.%u",
+                               (0 > value) ? "-" : "",
+                               static_cast<unsigned int>(magnitude / 10U),
+                               static_cast<unsigned int>(magnitude % 10U));
+                out += field;
+            }
+        }
+    }
+
+    out += "}";
+}
+
+void IVTRego6xxTelemetry::writeBinary(std::string& out, bool isChangedOnly) const
+{
+    uint8_t bitmap[(MAX_ENTITIES + 7U) / 8U] = { 0U };
+    size_t  bitmapSize                       = (m_entityCount + 7U) / 8U;
+    size_t  idx                              = 0U;
+
+    out += MAGIC[0];
+    out += MAGIC[1];
+    out += MAGIC[2];
+    out += MAGIC[3];
+    out += static_cast<char>(VERSION);
+    out += static_cast<char>(m_entityCount);
+    out += static_cast<char>((m_seq >> 0U) & 0xFFU);
+    out += static_cast<char>((m_seq >> 8U) & 0xFFU);
+
+    for (idx = 0U; idx < m_entityCount; ++idx)
+    {
+        if (true == isContained(m_entities[idx], isChangedOnly))
+        {
+            bitmap[idx / 8U] |= static_cast<uint8_t>(1U << (idx % 8U));
+        }
+    }
+
+    out.append(reinterpret_cast<const char*>(bitmap), bitmapSize);
+
+    for (idx = 0U; idx < m_entityCount; ++idx)
+    {
+        const EntityValue& entityValue = m_entities[idx];
+
+        if (true == isContained(entityValue, isChangedOnly))
+        {
+            out += static_cast<char>((entityValue.value >> 0U) & 0xFFU);
+            out += static_cast<char>((entityValue.value >> 8U) & 0xFFU);
+        }
+    }
+}
+
+void IVTRego6xxTelemetry::commit()
+{
+    size_t idx = 0U;
+
+    for (idx = 0U; idx < m_entityCount; ++idx)
+    {
+        m_entities[idx].isChanged = false;
+    }
+
+    m_isChanged = false;
+    ++m_seq;
+    ++m_frames;
+}
+
+void IVTRego6xxTelemetry::writeMetrics(std::string& out) const
+{
+    char line[64];
+
+    out += "# TYPE ivt_rego6xx_telemetry_frames_total counter\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_telemetry_frames_total %u\n", static_cast<unsigned int>(m_frames));
+    out += line;
+}
+
+bool IVTRego6xxTelemetry::writeValueMetricsPart(std::string& out, size_t part) const
+{
+    bool isAvailable = true;
+
+    if (0U == part)
+    {
+        out += "# TYPE ivt_rego6xx_entity_value gauge\n";
+    }
+    else if (m_entityCount >= part)
+    {
+        const EntityValue& entityValue = m_entities[part - 1U];
+
+        if (true == entityValue.isValid)
+        {
+            out += "ivt_rego6xx_entity_value{entity=\"";
+            appendLabelValue(out, entityValue.entity->get_name().c_str());
+
+            if (KIND_BOOL == entityValue.kind)
+            {
+                out += (0U == entityValue.value) ? "\"} 0\n" : "\"} 1\n";
+            }
+            else
+            {
+                char line[24];
+
+                /* The raw value is 16-bit two's complement in tenths. */
+                (void)snprintf(line, sizeof(line), "\"} %.1f\n", static_cast<double>(static_cast<int16_t>(entityValue.value)) / 10.0);
+                out += line;
+            }
+        }
+    }
+    else
+    {
+        isAvailable = false;
+    }
+
+    return isAvailable;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
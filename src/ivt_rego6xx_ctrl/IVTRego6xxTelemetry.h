@@ -0,0 +1,254 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  IVT rego6xx controller batched telemetry
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <stdint.h>
+#include "esphome/core/component.h"
+#include <string>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * Combines the entity values into a single telemetry frame, instead of a
+ * message per entity. A frame contains either the changed values since the
+ * last frame or every known value as snapshot.
+ *
+ * The field order is the order the entities were added, which is the same
+ * in every frame. The JSON frame contains the sequence number and the
+ * values by object id. A JSON snapshot contains every entity, the unknown
+ * values as null. The binary frame contains the magic "R6TM", the
+ * version, the number of entities and the sequence number, followed by a
+ * bitmap with a bit per entity, which marks the contained values, and the
+ * contained 16-bit raw values in the field order. All numbers are little
+ * endian.
+ */
+class IVTRego6xxTelemetry
+{
+public:
+
+    /** Maximum number of entities, which covers all sensors, binary sensors and numbers. */
+    static const size_t MAX_ENTITIES = 29U;
+
+    /** Binary frame format version. */
+    static const uint8_t VERSION = 1U;
+
+    /** Size of the binary frame header in byte. */
+    static const size_t HEADER_SIZE = 8U;
+
+    /**
+     * Kinds of entity values.
+     */
+    enum Kind
+    {
+        KIND_FIXED_POINT = 0U, /**< 16-bit fixed point value with one decimal */
+        KIND_BOOL              /**< Boolean value */
+    };
+
+    /**
+     * Constructs the telemetry.
+     */
+    IVTRego6xxTelemetry() :
+        m_entityCount(0U),
+        m_entities(),
+        m_isChanged(false),
+        m_seq(0U),
+        m_frames(0U)
+    {
+    }
+
+    /**
+     * Destroys the telemetry.
+     */
+    ~IVTRego6xxTelemetry()
+    {
+    }
+
+    /**
+     * Add an entity, whose value shall be part of the frames.
+     *
+     * @param[in] entity    Entity
+     * @param[in] kind      Kind of the entity value
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addEntity(const EntityBase* entity, Kind kind);
+
+    /**
+     * Get the number of entities.
+     *
+     * @return Number of entities
+     */
+    size_t getCount() const
+    {
+        return m_entityCount;
+    }
+
+    /**
+     * Update the raw value of an entity, after it was read successfully.
+     *
+     * @param[in] entity    Entity
+     * @param[in] value     Raw value
+     */
+    void update(const EntityBase* entity, uint32_t value);
+
+    /**
+     * Get the cached value of an entity. A boolean value is 0 or 1.
+     *
+     * @param[in]  entity   Entity
+     * @param[out] value    Raw value
+     *
+     * @return If a value is available, it will return true otherwise false.
+     */
+    bool getValue(const EntityBase* entity, uint16_t& value) const;
+
+    /**
+     * Is any value changed since the last frame?
+     *
+     * @return If a value is changed, it will return true otherwise false.
+     */
+    bool isChanged() const
+    {
+        return m_isChanged;
+    }
+
+    /**
+     * Write a frame in the compact JSON format.
+     *
+     * @param[out] out              Output
+     * @param[in]  isChangedOnly    Shall only the changed values be written, otherwise all known values?
+     */
+    void writeJson(std::string& out, bool isChangedOnly) const;
+
+    /**
+     * Write a frame in the binary format.
+     *
+     * @param[out] out              Output
+     * @param[in]  isChangedOnly    Shall only the changed values be written, otherwise all known values?
+     */
+    void writeBinary(std::string& out, bool isChangedOnly) const;
+
+    /**
+     * Mark the changed values as sent, after their frame was published.
+     */
+    void commit();
+
+    /**
+     * Append the number of published frames in the Prometheus text format.
+     *
+     * @param[out] out  Output
+     */
+    void writeMetrics(std::string& out) const;
+
+    /**
+     * Append a part of the entity values in the Prometheus text format.
+     * The first part is the header, followed by a part per entity, so the
+     * output can be streamed with a small buffer. An unknown value is
+     * skipped.
+     *
+     * @param[out] out  Output
+     * @param[in]  part Part index, starting with 0.
+     *
+     * @return If the part exists, it will return true otherwise false.
+     */
+    bool writeValueMetricsPart(std::string& out, size_t part) const;
+
+private:
+
+    /**
+     * Value of a single entity.
+     */
+    struct EntityValue
+    {
+        const EntityBase* entity;    /**< Entity */
+        Kind              kind;      /**< Kind of the value */
+        uint16_t          value;     /**< Raw value */
+        bool              isValid;   /**< Is a value available? */
+        bool              isChanged; /**< Is the value changed since the last frame? */
+    };
+
+    size_t      m_entityCount;            /**< Number of entities */
+    EntityValue m_entities[MAX_ENTITIES]; /**< Values of the entities in the field order */
+    bool        m_isChanged;              /**< Is any value changed since the last frame? */
+    uint16_t    m_seq;                    /**< Sequence number of the next frame */
+    uint32_t    m_frames;                 /**< Number of published frames */
+
+    IVTRego6xxTelemetry(const IVTRego6xxTelemetry& other);
+    IVTRego6xxTelemetry& operator=(const IVTRego6xxTelemetry& other);
+
+    /**
+     * Is the value of an entity part of a frame?
+     *
+     * @param[in] entityValue       Value of the entity
+     * @param[in] isChangedOnly     Does the frame contain only the changed values?
+     *
+     * @return If the value is part of the frame, it will return true otherwise false.
+     */
+    static bool isContained(const EntityValue& entityValue, bool isChangedOnly)
+    {
+        return (true == entityValue.isValid) && ((false == isChangedOnly) || (true == entityValue.isChanged));
+    }
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
@@ -0,0 +1,354 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Warm start with the last-known entity values
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IVTRego6xxWarmStart.h"
+#include "IVTRego6xxMetrics.h"
+#include "SimpleTimer.hpp"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+#include <stdio.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+namespace esphome
+{
+namespace ivt_rego6xx_ctrl
+{
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/**
+ * Logger tag of this component.
+ */
+static const char* TAG = "ivt_rego6xx_ctrl.warm_start";
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool IVTRego6xxWarmStart::addEntity(EntityBase* entity)
+{
+    bool isSuccessful = false;
+
+    if ((nullptr != entity) &&
+        (MAX_ENTITIES > m_entityCount))
+    {
+        EntityValue& entityValue = m_entities[m_entityCount];
+
+        entityValue.entity     = entity;
+        entityValue.value      = 0U;
+        entityValue.timestamp  = 0U;
+        entityValue.baseAge    = 0U;
+        entityValue.isValid    = false;
+        entityValue.isRestored = false;
+
+        ++m_entityCount;
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+size_t IVTRego6xxWarmStart::load()
+{
+    Snapshot snapshot;
+    uint32_t now = SimpleTimer::now();
+
+    m_pref          = global_preferences->make_preference<Snapshot>(fnv1_hash("ivt_rego6xx_warm_start"));
+    m_restoredCount = 0U;
+
+    if ((true == m_pref.load(&snapshot)) &&
+        (VERSION == snapshot.version) &&
+        (MAX_ENTITIES >= snapshot.count))
+    {
+        size_t recordIdx = 0U;
+
+        for (recordIdx = 0U; recordIdx < snapshot.count; ++recordIdx)
+        {
+            const Record& record = snapshot.records[recordIdx];
+            size_t        idx    = 0U;
+
+            for (idx = 0U; idx < m_entityCount; ++idx)
+            {
+                EntityValue& entityValue = m_entities[idx];
+
+                if ((false == entityValue.isValid) &&
+                    (record.idHash == entityValue.entity->get_object_id_hash()))
+                {
+                    entityValue.value      = record.value;
+                    entityValue.timestamp  = now;
+                    entityValue.baseAge    = record.age;
+                    entityValue.isValid    = true;
+                    entityValue.isRestored = true;
+
+                    ESP_LOGD(TAG, "Restored %s, read %u s before the save.",
+                        entityValue.entity->get_name().c_str(),
+                        static_cast<unsigned int>(record.age));
+
+                    ++m_restoredCount;
+                    break;
+                }
+            }
+        }
+
+        ESP_LOGI(TAG, "Restored %u of %u values, the oldest was read %u s before the save.",
+            static_cast<unsigned int>(m_restoredCount),
+            static_cast<unsigned int>(snapshot.count),
+            static_cast<unsigned int>(getMaxAge()));
+    }
+    else
+    {
+        ESP_LOGI(TAG, "No values to restore.");
+    }
+
+    return m_restoredCount;
+}
+
+bool IVTRego6xxWarmStart::getRestoredValue(const EntityBase* entity, uint32_t& value) const
+{
+    bool               isRestored  = false;
+    const EntityValue* entityValue = findEntity(entity);
+
+    if ((nullptr != entityValue) &&
+        (true == entityValue->isRestored))
+    {
+        value      = entityValue->value;
+        isRestored = true;
+    }
+
+    return isRestored;
+}
+
+void IVTRego6xxWarmStart::update(const EntityBase* entity, uint32_t value)
+{
+    EntityValue* entityValue = findEntity(entity);
+
+    if (nullptr != entityValue)
+    {
+        if (true == entityValue->isRestored)
+        {
+            entityValue->isRestored = false;
+            --m_restoredCount;
+        }
+
+        entityValue->value     = value;
+        entityValue->timestamp = SimpleTimer::now();
+        entityValue->baseAge   = 0U;
+        entityValue->isValid   = true;
+
+        m_isDirty = true;
+    }
+}
+
+bool IVTRego6xxWarmStart::save()
+{
+    bool isSaved = false;
+
+    if (true == m_isDirty)
+    {
+        Snapshot snapshot;
+        uint32_t now = SimpleTimer::now();
+        size_t   idx = 0U;
+
+        /* Unused records are cleared, so the saved data only changes with the values. */
+        memset(&snapshot, 0, sizeof(snapshot));
+        snapshot.version = VERSION;
+
+        for (idx = 0U; idx < m_entityCount; ++idx)
+        {
+            EntityValue& entityValue = m_entities[idx];
+
+            if (true == entityValue.isValid)
+            {
+                Record& record = snapshot.records[snapshot.count];
+
+                record.idHash = entityValue.entity->get_object_id_hash();
+                record.value  = entityValue.value;
+                record.age    = getAge(entityValue, now);
+
+                ++snapshot.count;
+            }
+        }
+
+        /* The preferences write the snapshot to flash deferred, together with other changes. */
+        if (false == m_pref.save(&snapshot))
+        {
+            ESP_LOGW(TAG, "Failed to save %u values.", static_cast<unsigned int>(snapshot.count));
+        }
+        else
+        {
+            m_isDirty = false;
+            ++m_saves;
+            isSaved   = true;
+        }
+    }
+
+    return isSaved;
+}
+
+uint32_t IVTRego6xxWarmStart::getMaxAge() const
+{
+    uint32_t maxAge = 0U;
+    uint32_t now    = SimpleTimer::now();
+    size_t   idx    = 0U;
+
+    for (idx = 0U; idx < m_entityCount; ++idx)
+    {
+        const EntityValue& entityValue = m_entities[idx];
+
+        if (true == entityValue.isValid)
+        {
+            uint32_t age = getAge(entityValue, now);
+
+            if (maxAge < age)
+            {
+                maxAge = age;
+            }
+        }
+    }
+
+    return maxAge;
+}
+
+void IVTRego6xxWarmStart::writeMetrics(std::string& out) const
+{
+    char     line[64];
+    uint32_t now = SimpleTimer::now();
+    size_t   idx = 0U;
+
+    out += "# TYPE ivt_rego6xx_restored_entities gauge\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_restored_entities %u\n", static_cast<unsigned int>(m_restoredCount));
+    out += line;
+
+    out += "# TYPE ivt_rego6xx_entity_restored gauge\n";
+    for (idx = 0U; idx < m_entityCount; ++idx)
+    {
+        const EntityValue& entityValue = m_entities[idx];
+
+        out += "ivt_rego6xx_entity_restored{entity=\"";
+        appendLabelValue(out, entityValue.entity->get_name().c_str());
+        (void)snprintf(line, sizeof(line), "\"} %u\n", (true == entityValue.isRestored) ? 1U : 0U);
+        out += line;
+    }
+
+    /* Only the restored values have an age, a read value is tracked by the staleness. */
+    out += "# TYPE ivt_rego6xx_entity_restored_age_seconds gauge\n";
+    for (idx = 0U; idx < m_entityCount; ++idx)
+    {
+        const EntityValue& entityValue = m_entities[idx];
+
+        if (true == entityValue.isRestored)
+        {
+            out += "ivt_rego6xx_entity_restored_age_seconds{entity=\"";
+            appendLabelValue(out, entityValue.entity->get_name().c_str());
+            (void)snprintf(line, sizeof(line), "\"} %u\n", static_cast<unsigned int>(getAge(entityValue, now)));
+            out += line;
+        }
+    }
+
+    out += "# TYPE ivt_rego6xx_warm_start_saves_total counter\n";
+    (void)snprintf(line, sizeof(line), "ivt_rego6xx_warm_start_saves_total %u\n", static_cast<unsigned int>(m_saves));
+    out += line;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+IVTRego6xxWarmStart::EntityValue* IVTRego6xxWarmStart::findEntity(const EntityBase* entity)
+{
+    EntityValue* entityValue = nullptr;
+    size_t       idx         = 0U;
+
+    while ((nullptr == entityValue) && (idx < m_entityCount))
+    {
+        if (entity == m_entities[idx].entity)
+        {
+            entityValue = &m_entities[idx];
+        }
+
+        ++idx;
+    }
+
+    return entityValue;
+}
+
+const IVTRego6xxWarmStart::EntityValue* IVTRego6xxWarmStart::findEntity(const EntityBase* entity) const
+{
+    const EntityValue* entityValue = nullptr;
+    size_t             idx         = 0U;
+
+    while ((nullptr == entityValue) && (idx < m_entityCount))
+    {
+        if (entity == m_entities[idx].entity)
+        {
+            entityValue = &m_entities[idx];
+        }
+
+        ++idx;
+    }
+
+    return entityValue;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
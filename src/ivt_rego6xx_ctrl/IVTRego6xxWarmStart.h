@@ -0,0 +1,261 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Warm start with the last-known entity values
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <stdint.h>
+#include "esphome/core/component.h"
+#include "esphome/core/preferences.h"
+#include <string>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * Keeps the last-known raw values of the entities and saves them to the
+ * preferences, so they can be published right after a reboot.
+ *
+ * All values are saved together as one snapshot and only if a value was
+ * read since the last save. The save interval limits the flash wear.
+ * An entity is identified by its object id hash, therefore a changed
+ * configuration restores only the entities which still exist.
+ *
+ * Without a real time clock, the downtime is unknown. The age of a value
+ * is therefore the time since it was read until it was saved, plus the
+ * uptime until it is read again.
+ */
+class IVTRego6xxWarmStart
+{
+public:
+
+    /** Maximum number of entities, which covers all sensors, binary sensors and numbers. */
+    static const size_t MAX_ENTITIES = 29U;
+
+    /**
+     * Constructs the warm start.
+     */
+    IVTRego6xxWarmStart() :
+        m_pref(),
+        m_entityCount(0U),
+        m_entities(),
+        m_restoredCount(0U),
+        m_isDirty(false),
+        m_saves(0U)
+    {
+    }
+
+    /**
+     * Destroys the warm start.
+     */
+    ~IVTRego6xxWarmStart()
+    {
+    }
+
+    /**
+     * Add an entity, whose value shall be kept.
+     *
+     * @param[in] entity    Entity
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addEntity(EntityBase* entity);
+
+    /**
+     * Load the snapshot from the preferences. Every entity, whose value is
+     * part of it, is marked as restored.
+     *
+     * @return Number of restored entity values.
+     */
+    size_t load();
+
+    /**
+     * Get the restored raw value of an entity.
+     *
+     * @param[in]  entity   Entity
+     * @param[out] value    Restored raw value
+     *
+     * @return If the entity value was restored and not read since, it will return true otherwise false.
+     */
+    bool getRestoredValue(const EntityBase* entity, uint32_t& value) const;
+
+    /**
+     * Update the raw value of an entity, after it was read successfully.
+     *
+     * @param[in] entity    Entity
+     * @param[in] value     Raw value
+     */
+    void update(const EntityBase* entity, uint32_t value);
+
+    /**
+     * Save the snapshot to the preferences, if a value was read since the last save.
+     *
+     * @return If saved, it will return true otherwise false.
+     */
+    bool save();
+
+    /**
+     * Get the number of entities, which still show their restored value.
+     *
+     * @return Number of entities
+     */
+    size_t getRestoredCount() const
+    {
+        return m_restoredCount;
+    }
+
+    /**
+     * Get the age of the oldest value in s.
+     *
+     * @return Age in s
+     */
+    uint32_t getMaxAge() const;
+
+    /**
+     * Append the restored entities, their restored state and age per entity
+     * and the saves in the Prometheus text format.
+     *
+     * @param[out] out  Output
+     */
+    void writeMetrics(std::string& out) const;
+
+private:
+
+    /** Snapshot layout version, which invalidates the snapshots of older layouts. */
+    static const uint32_t VERSION = 3U;
+
+    /**
+     * Value of a single entity.
+     */
+    struct EntityValue
+    {
+        EntityBase* entity;     /**< Entity */
+        uint32_t    value;      /**< Raw value */
+        uint32_t    timestamp;  /**< Timestamp in ms, when the value was read or restored. */
+        uint32_t    baseAge;    /**< Age in s at the timestamp, only restored values have one. */
+        bool        isValid;    /**< Is a value available? */
+        bool        isRestored; /**< Is the value restored and not read since? */
+    };
+
+    /**
+     * Saved value of a single entity.
+     */
+    struct Record
+    {
+        uint32_t idHash;    /**< Object id hash of the entity */
+        uint32_t value;     /**< Raw value */
+        uint32_t age;       /**< Age in s at the save */
+    };
+
+    /**
+     * Saved values of all entities.
+     */
+    struct Snapshot
+    {
+        uint32_t version;               /**< Layout version */
+        uint32_t count;                 /**< Number of records */
+        Record   records[MAX_ENTITIES]; /**< Records */
+    };
+
+    ESPPreferenceObject m_pref;                   /**< Preference, which stores the snapshot. */
+    size_t              m_entityCount;            /**< Number of entities */
+    EntityValue         m_entities[MAX_ENTITIES]; /**< Values of the entities */
+    size_t              m_restoredCount;          /**< Number of entities, which still show their restored value. */
+    bool                m_isDirty;                /**< Was a value read since the last save? */
+    uint32_t            m_saves;                  /**< Number of saves */
+
+    IVTRego6xxWarmStart(const IVTRego6xxWarmStart& other);
+    IVTRego6xxWarmStart& operator=(const IVTRego6xxWarmStart& other);
+
+    /**
+     * Find the value of an entity.
+     *
+     * @param[in] entity    Entity
+     *
+     * @return Entity value or nullptr if not found.
+     */
+    EntityValue* findEntity(const EntityBase* entity);
+
+    /**
+     * Find the value of an entity.
+     *
+     * @param[in] entity    Entity
+     *
+     * @return Entity value or nullptr if not found.
+     */
+    const EntityValue* findEntity(const EntityBase* entity) const;
+
+    /**
+     * Get the age of an entity value.
+     *
+     * @param[in] entityValue   Entity value
+     * @param[in] now           Current timestamp in ms
+     *
+     * @return Age in s
+     */
+    static uint32_t getAge(const EntityValue& entityValue, uint32_t now)
+    {
+        return entityValue.baseAge + ((now - entityValue.timestamp) / 1000U);
+    }
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
@@ -0,0 +1,536 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Web handler for diagnostic downloads
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IVTRego6xxWebHandler.h"
+
+#ifdef USE_WEBSERVER
+
+#include "Rego6xxTracepoint.h"
+#include <string.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+namespace esphome
+{
+namespace ivt_rego6xx_ctrl
+{
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** URL of the UART traffic recording. */
+static const char* URL_RECORDING     = "/ivt_rego6xx/recording.bin";
+
+/** URL of the protocol frames. */
+static const char* URL_FRAMES        = "/ivt_rego6xx/frames.bin";
+
+/** URL of the metrics. */
+static const char* URL_METRICS       = "/ivt_rego6xx/metrics";
+
+/** URL of the event trace. */
+static const char* URL_TRACE         = "/ivt_rego6xx/trace.json";
+
+/** URL of the deferred log. */
+static const char* URL_LOG           = "/ivt_rego6xx/log.txt";
+
+/** URL of the decoded sample history. */
+static const char* URL_HISTORY_CSV   = "/ivt_rego6xx/history.csv";
+
+/** URL of the compressed sample history. */
+static const char* URL_HISTORY_BIN   = "/ivt_rego6xx/history.bin";
+
+/** URL of the entity value snapshot in JSON. */
+static const char* URL_SNAPSHOT_JSON = "/ivt_rego6xx/snapshot.json";
+
+/** URL of the entity value snapshot in the binary telemetry format. */
+static const char* URL_SNAPSHOT_BIN  = "/ivt_rego6xx/snapshot.bin";
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool IVTRego6xxWebHandler::canHandle(AsyncWebServerRequest* request) const
+{
+    bool canHandle = false;
+
+    if ((request->url() == URL_RECORDING) ||
+        (request->url() == URL_FRAMES) ||
+        (request->url() == URL_METRICS) ||
+        (request->url() == URL_TRACE) ||
+        (request->url() == URL_LOG) ||
+        (request->url() == URL_HISTORY_CSV) ||
+        (request->url() == URL_HISTORY_BIN) ||
+        (request->url() == URL_SNAPSHOT_JSON) ||
+        (request->url() == URL_SNAPSHOT_BIN))
+    {
+        canHandle = true;
+    }
+
+    return canHandle;
+}
+
+void IVTRego6xxWebHandler::handleRequest(AsyncWebServerRequest* request)
+{
+    if (request->url() == URL_RECORDING)
+    {
+        handleRecording(request);
+    }
+    else if (request->url() == URL_FRAMES)
+    {
+        handleFrames(request);
+    }
+    else if (request->url() == URL_METRICS)
+    {
+        handleMetrics(request);
+    }
+    else if (request->url() == URL_TRACE)
+    {
+        handleTrace(request);
+    }
+    else if (request->url() == URL_LOG)
+    {
+        handleLog(request);
+    }
+    else if (request->url() == URL_HISTORY_CSV)
+    {
+        handleHistory(request, false);
+    }
+    else if (request->url() == URL_HISTORY_BIN)
+    {
+        handleHistory(request, true);
+    }
+    else if (request->url() == URL_SNAPSHOT_JSON)
+    {
+        handleSnapshot(request, false);
+    }
+    else if (request->url() == URL_SNAPSHOT_BIN)
+    {
+        handleSnapshot(request, true);
+    }
+    else
+    {
+        request->send(404, "text/plain", "Not found.");
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void IVTRego6xxWebHandler::handleRecording(AsyncWebServerRequest* request)
+{
+    if ((nullptr == m_recording) ||
+        (nullptr == m_recording->getData()))
+    {
+        request->send(404, "text/plain", "Recorder is disabled.");
+    }
+    else
+    {
+        /* The recording is only appended, so the data up to the current
+         * size stays untouched while it is sent.
+         */
+        AsyncWebServerResponse* response = request->beginResponse(200, "application/octet-stream", m_recording->getData(), m_recording->getSize());
+
+        response->addHeader("Content-Disposition", "attachment; filename=recording.bin");
+        request->send(response);
+    }
+}
+
+void IVTRego6xxWebHandler::handleFrames(AsyncWebServerRequest* request)
+{
+    if ((nullptr == m_frameRing) ||
+        (false == m_frameRing->isEnabled()))
+    {
+        request->send(404, "text/plain", "Frame trace is disabled.");
+    }
+    else
+    {
+        const Rego6xxFrameRing* frameRing = m_frameRing;
+        AsyncWebServerResponse* response  = nullptr;
+        uint32_t                pos       = frameRing->getTail();
+        uint32_t                end       = frameRing->getHead();
+
+        /* Only the frames up to the request are sent, while recording continues.
+         * The filler keeps its own read position between the chunks.
+         */
+        response = request->beginChunkedResponse("application/octet-stream",
+            [frameRing, pos, end](uint8_t* buffer, size_t maxLen, size_t index) mutable -> size_t
+            {
+                size_t size = 0U;
+
+                if ((0U == index) &&
+                    (Rego6xxTrace::HEADER_SIZE <= maxLen))
+                {
+                    Rego6xxTrace::encodeHeader(buffer);
+                    size = Rego6xxTrace::HEADER_SIZE;
+                }
+
+                /* The first chunk starts with the file header. */
+                if ((0U < index) || (0U < size))
+                {
+                    size += frameRing->read(pos, end, &buffer[size], maxLen - size);
+                }
+
+                return size;
+            });
+
+        response->addHeader("Content-Disposition", "attachment; filename=frames.bin");
+        request->send(response);
+    }
+}
+
+void IVTRego6xxWebHandler::handleMetrics(AsyncWebServerRequest* request)
+{
+    if (nullptr == m_busHealth)
+    {
+        request->send(404, "text/plain", "Metrics are not available.");
+    }
+    else
+    {
+        AsyncWebServerResponse* response = nullptr;
+        size_t                  section  = 0U;
+        size_t                  part     = 0U;
+        size_t                  offset   = 0U;
+        std::string             pending;
+
+        /* The metrics are rendered part by part from the values in RAM, while
+         * polling continues. Only the current part is buffered, which keeps
+         * the heap usage small and independent of the number of entities.
+         */
+        response = request->beginChunkedResponse("text/plain; version=0.0.4",
+            [this, section, part, offset, pending](uint8_t* buffer, size_t maxLen, size_t index) mutable -> size_t
+            {
+                size_t size = 0U;
+
+                (void)index;
+
+                while ((maxLen > size) && (METRICS_SECTION_COUNT > section))
+                {
+                    if (pending.size() <= offset)
+                    {
+                        pending.clear();
+                        offset = 0U;
+
+                        if (true == writeMetricsPart(pending, section, part))
+                        {
+                            ++part;
+                        }
+                        else
+                        {
+                            ++section;
+                            part = 0U;
+                        }
+                    }
+                    else
+                    {
+                        size_t length = pending.size() - offset;
+
+                        if ((maxLen - size) < length)
+                        {
+                            length = maxLen - size;
+                        }
+
+                        memcpy(&buffer[size], &pending[offset], length);
+                        size   += length;
+                        offset += length;
+                    }
+                }
+
+                return size;
+            });
+
+        request->send(response);
+    }
+}
+
+void IVTRego6xxWebHandler::handleTrace(AsyncWebServerRequest* request)
+{
+#ifdef EVENT_TRACE_SIZE
+    const EventTrace&       trace    = EventTrace::getInstance();
+    AsyncWebServerResponse* response = nullptr;
+    EventTrace::Cursor      cursor;
+
+    trace.beginExport(cursor);
+
+    /* The trace is exported chunk by chunk, while tracing continues.
+     * The filler keeps its own copy of the cursor between the chunks.
+     */
+    response = request->beginChunkedResponse("application/json",
+        [&trace, cursor](uint8_t* buffer, size_t maxLen, size_t index) mutable -> size_t
+        {
+            (void)index;
+
+            return trace.exportChromeTrace(reinterpret_cast<char*>(buffer), maxLen, cursor, Rego6xxTracepoint::INFOS, Rego6xxTracepoint::ID_COUNT);
+        });
+
+    response->addHeader("Content-Disposition", "attachment; filename=trace.json");
+    request->send(response);
+#else /* EVENT_TRACE_SIZE */
+    request->send(404, "text/plain", "Event trace is disabled.");
+#endif /* EVENT_TRACE_SIZE */
+}
+
+void IVTRego6xxWebHandler::handleLog(AsyncWebServerRequest* request)
+{
+    if ((nullptr == m_deferredLog) ||
+        (false == IVTRego6xxDeferredLog::isEnabled()))
+    {
+        request->send(404, "text/plain", "Deferred log is disabled.");
+    }
+    else
+    {
+        const IVTRego6xxDeferredLog* deferredLog = m_deferredLog;
+        AsyncWebServerResponse*      response    = nullptr;
+        uint32_t                     seq         = deferredLog->getFirstSeq();
+
+        /* The records are formatted chunk by chunk, while logging continues.
+         * The filler keeps its own sequence number between the chunks.
+         */
+        response = request->beginChunkedResponse("text/plain",
+            [deferredLog, seq](uint8_t* buffer, size_t maxLen, size_t index) mutable -> size_t
+            {
+                (void)index;
+
+                return deferredLog->exportText(reinterpret_cast<char*>(buffer), maxLen, seq);
+            });
+
+        request->send(response);
+    }
+}
+
+void IVTRego6xxWebHandler::handleHistory(AsyncWebServerRequest* request, bool isBinary)
+{
+    if (nullptr == m_history)
+    {
+        request->send(404, "text/plain", "Sample history is disabled.");
+    }
+    else
+    {
+        const IVTRego6xxHistory*  history  = m_history;
+        AsyncWebServerResponse*   response = nullptr;
+        IVTRego6xxHistory::Cursor cursor;
+
+        history->beginExport(cursor);
+
+        /* The history is exported chunk by chunk, while sampling continues.
+         * The filler keeps its own copy of the cursor between the chunks.
+         */
+        if (true == isBinary)
+        {
+            response = request->beginChunkedResponse("application/octet-stream",
+                [history, cursor](uint8_t* buffer, size_t maxLen, size_t index) mutable -> size_t
+                {
+                    (void)index;
+
+                    return history->exportBinary(buffer, maxLen, cursor);
+                });
+
+            response->addHeader("Content-Disposition", "attachment; filename=history.bin");
+        }
+        else
+        {
+            response = request->beginChunkedResponse("text/csv",
+                [history, cursor](uint8_t* buffer, size_t maxLen, size_t index) mutable -> size_t
+                {
+                    (void)index;
+
+                    return history->exportCsv(reinterpret_cast<char*>(buffer), maxLen, cursor);
+                });
+
+            response->addHeader("Content-Disposition", "attachment; filename=history.csv");
+        }
+
+        request->send(response);
+    }
+}
+
+void IVTRego6xxWebHandler::handleSnapshot(AsyncWebServerRequest* request, bool isBinary)
+{
+    if (nullptr == m_telemetry)
+    {
+        request->send(404, "text/plain", "Telemetry is disabled.");
+    }
+    else if (false == isBinary)
+    {
+        std::string snapshot;
+
+        m_telemetry->writeJson(snapshot, false);
+
+        request->send(200, "application/json", snapshot.c_str());
+    }
+    else
+    {
+        AsyncWebServerResponse* response = nullptr;
+        std::string             snapshot;
+
+        m_telemetry->writeBinary(snapshot, false);
+
+        /* The binary snapshot may contain zero bytes, therefore the filler
+         * keeps its own copy and sends it by the chunk offset.
+         */
+        response = request->beginChunkedResponse("application/octet-stream",
+            [snapshot](uint8_t* buffer, size_t maxLen, size_t index) -> size_t
+            {
+                size_t size = 0U;
+
+                if (index < snapshot.size())
+                {
+                    size = snapshot.size() - index;
+
+                    if (maxLen < size)
+                    {
+                        size = maxLen;
+                    }
+
+                    memcpy(buffer, &snapshot[index], size);
+                }
+
+                return size;
+            });
+
+        response->addHeader("Content-Disposition", "attachment; filename=snapshot.bin");
+        request->send(response);
+    }
+}
+
+bool IVTRego6xxWebHandler::writeMetricsPart(std::string& out, size_t section, size_t part) const
+{
+    bool isAvailable = false;
+
+    switch (section)
+    {
+    case METRICS_SECTION_BUS_HEALTH:
+        isAvailable = m_busHealth->writeMetricsPart(out, part);
+        break;
+
+    case METRICS_SECTION_ENTITY_VALUES:
+        isAvailable = (nullptr != m_telemetry) && (true == m_telemetry->writeValueMetricsPart(out, part));
+        break;
+
+    case METRICS_SECTION_STALENESS:
+        isAvailable = writeSinglePart(out, m_staleness, part);
+        break;
+
+    case METRICS_SECTION_ACTION_LATENCY:
+        isAvailable = writeSinglePart(out, m_actionLatency, part);
+        break;
+
+    case METRICS_SECTION_LOOP_COST:
+        isAvailable = writeSinglePart(out, m_loopCost, part);
+        break;
+
+    case METRICS_SECTION_WARM_START:
+        isAvailable = writeSinglePart(out, m_warmStart, part);
+        break;
+
+    case METRICS_SECTION_PROFILES:
+        isAvailable = writeSinglePart(out, m_profiles, part);
+        break;
+
+    case METRICS_SECTION_DEPENDENCIES:
+        isAvailable = writeSinglePart(out, m_dependencies, part);
+        break;
+
+    case METRICS_SECTION_ADAPTIVE_SAMPLING:
+        isAvailable = writeSinglePart(out, m_adaptiveSampling, part);
+        break;
+
+    case METRICS_SECTION_SAMPLING_GROUPS:
+        isAvailable = writeSinglePart(out, m_samplingGroups, part);
+        break;
+
+    case METRICS_SECTION_DERIVED_METRICS:
+        isAvailable = writeSinglePart(out, m_derivedMetrics, part);
+        break;
+
+    case METRICS_SECTION_AGGREGATION:
+        isAvailable = writeSinglePart(out, m_aggregation, part);
+        break;
+
+    case METRICS_SECTION_HISTORY:
+        isAvailable = writeSinglePart(out, m_history, part);
+        break;
+
+    case METRICS_SECTION_OUTBOX:
+        isAvailable = writeSinglePart(out, m_outbox, part);
+        break;
+
+    case METRICS_SECTION_TELEMETRY:
+        isAvailable = writeSinglePart(out, m_telemetry, part);
+        break;
+
+#ifdef IVT_REGO6XX_MODBUS
+    case METRICS_SECTION_MODBUS:
+        isAvailable = writeSinglePart(out, m_modbusServer, part);
+        break;
+#endif /* IVT_REGO6XX_MODBUS */
+
+    default:
+        break;
+    }
+
+    return isAvailable;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+#endif /* USE_WEBSERVER */
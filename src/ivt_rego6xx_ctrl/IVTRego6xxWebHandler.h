@@ -0,0 +1,481 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Web handler for diagnostic downloads
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_WEBSERVER
+
+#include "esphome/components/web_server_base/web_server_base.h"
+#include "Rego6xxTraceBuffer.h"
+#include "Rego6xxFrameRing.h"
+#include "IVTRego6xxBusHealth.h"
+#include "IVTRego6xxStaleness.h"
+#include "IVTRego6xxActionLatency.h"
+#include "IVTRego6xxLoopCost.h"
+#include "IVTRego6xxDeferredLog.h"
+#include "IVTRego6xxWarmStart.h"
+#include "IVTRego6xxPollingProfiles.h"
+#include "IVTRego6xxDependencies.h"
+#include "IVTRego6xxAdaptiveSampling.h"
+#include "IVTRego6xxSamplingGroups.h"
+#include "IVTRego6xxDerivedMetrics.h"
+#include "IVTRego6xxAggregation.h"
+#include "IVTRego6xxHistory.h"
+#include "IVTRego6xxOutbox.h"
+#include "IVTRego6xxTelemetry.h"
+#include "IVTRego6xxModbusServer.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * Web handler, which provides diagnostic data of the IVT rego6xx controller
+ * component for download. All URLs start with /ivt_rego6xx/.
+ *
+ * The requests are handled by the webserver task, therefore only data which
+ * can be read concurrently is provided.
+ */
+class IVTRego6xxWebHandler : public AsyncWebHandler
+{
+public:
+
+    /**
+     * Constructs the web handler.
+     */
+    IVTRego6xxWebHandler() :
+        AsyncWebHandler(),
+        m_recording(nullptr),
+        m_frameRing(nullptr),
+        m_busHealth(nullptr),
+        m_staleness(nullptr),
+        m_actionLatency(nullptr),
+        m_loopCost(nullptr),
+        m_deferredLog(nullptr),
+        m_warmStart(nullptr),
+        m_profiles(nullptr),
+        m_dependencies(nullptr),
+        m_adaptiveSampling(nullptr),
+        m_samplingGroups(nullptr),
+        m_derivedMetrics(nullptr),
+        m_aggregation(nullptr),
+        m_history(nullptr),
+        m_outbox(nullptr),
+        m_telemetry(nullptr)
+#ifdef IVT_REGO6XX_MODBUS
+        ,
+        m_modbusServer(nullptr)
+#endif /* IVT_REGO6XX_MODBUS */
+    {
+    }
+
+    /**
+     * Destroys the web handler.
+     */
+    ~IVTRego6xxWebHandler()
+    {
+    }
+
+    /**
+     * Set the UART traffic recording, which is provided at /ivt_rego6xx/recording.bin.
+     *
+     * @param[in] recording UART traffic recording
+     */
+    void setRecording(const Rego6xxTraceBuffer* recording)
+    {
+        m_recording = recording;
+    }
+
+    /**
+     * Set the protocol frame ring, which is provided at /ivt_rego6xx/frames.bin.
+     *
+     * @param[in] frameRing Protocol frame ring
+     */
+    void setFrameRing(const Rego6xxFrameRing* frameRing)
+    {
+        m_frameRing = frameRing;
+    }
+
+    /**
+     * Set the bus health, which is provided at /ivt_rego6xx/metrics.
+     *
+     * @param[in] busHealth Bus health
+     */
+    void setBusHealth(const IVTRego6xxBusHealth* busHealth)
+    {
+        m_busHealth = busHealth;
+    }
+
+    /**
+     * Set the staleness of the entity values, which is provided at /ivt_rego6xx/metrics.
+     *
+     * @param[in] staleness Staleness of the entity values
+     */
+    void setStaleness(const IVTRego6xxStaleness* staleness)
+    {
+        m_staleness = staleness;
+    }
+
+    /**
+     * Set the user action latency, which is provided at /ivt_rego6xx/metrics.
+     *
+     * @param[in] actionLatency User action latency
+     */
+    void setActionLatency(const IVTRego6xxActionLatency* actionLatency)
+    {
+        m_actionLatency = actionLatency;
+    }
+
+    /**
+     * Set the main loop cost, which is provided at /ivt_rego6xx/metrics.
+     *
+     * @param[in] loopCost  Main loop cost
+     */
+    void setLoopCost(const IVTRego6xxLoopCost* loopCost)
+    {
+        m_loopCost = loopCost;
+    }
+
+    /**
+     * Set the deferred log, which is provided at /ivt_rego6xx/log.txt.
+     *
+     * @param[in] deferredLog   Deferred log
+     */
+    void setDeferredLog(const IVTRego6xxDeferredLog* deferredLog)
+    {
+        m_deferredLog = deferredLog;
+    }
+
+    /**
+     * Set the warm start, which is provided at /ivt_rego6xx/metrics.
+     *
+     * @param[in] warmStart Warm start
+     */
+    void setWarmStart(const IVTRego6xxWarmStart* warmStart)
+    {
+        m_warmStart = warmStart;
+    }
+
+    /**
+     * Set the polling profiles, which are provided at /ivt_rego6xx/metrics.
+     *
+     * @param[in] profiles  Polling profiles
+     */
+    void setPollingProfiles(const IVTRego6xxPollingProfiles* profiles)
+    {
+        m_profiles = profiles;
+    }
+
+    /**
+     * Set the dependent refreshes, which are provided at /ivt_rego6xx/metrics.
+     *
+     * @param[in] dependencies  Dependent refreshes
+     */
+    void setDependencies(const IVTRego6xxDependencies* dependencies)
+    {
+        m_dependencies = dependencies;
+    }
+
+    /**
+     * Set the adaptive sampling, which is provided at /ivt_rego6xx/metrics.
+     *
+     * @param[in] adaptiveSampling  Adaptive sampling
+     */
+    void setAdaptiveSampling(const IVTRego6xxAdaptiveSampling* adaptiveSampling)
+    {
+        m_adaptiveSampling = adaptiveSampling;
+    }
+
+    /**
+     * Set the sampling groups, which are provided at /ivt_rego6xx/metrics.
+     *
+     * @param[in] samplingGroups    Sampling groups
+     */
+    void setSamplingGroups(const IVTRego6xxSamplingGroups* samplingGroups)
+    {
+        m_samplingGroups = samplingGroups;
+    }
+
+    /**
+     * Set the derived metrics, which are provided at /ivt_rego6xx/metrics.
+     *
+     * @param[in] derivedMetrics    Derived metrics
+     */
+    void setDerivedMetrics(const IVTRego6xxDerivedMetrics* derivedMetrics)
+    {
+        m_derivedMetrics = derivedMetrics;
+    }
+
+    /**
+     * Set the windowed aggregation, which is provided at /ivt_rego6xx/metrics.
+     *
+     * @param[in] aggregation   Windowed aggregation
+     */
+    void setAggregation(const IVTRego6xxAggregation* aggregation)
+    {
+        m_aggregation = aggregation;
+    }
+
+    /**
+     * Set the sample history, which is provided at /ivt_rego6xx/history.csv,
+     * /ivt_rego6xx/history.bin and /ivt_rego6xx/metrics.
+     *
+     * @param[in] history   Sample history
+     */
+    void setHistory(const IVTRego6xxHistory* history)
+    {
+        m_history = history;
+    }
+
+    /**
+     * Set the MQTT outbox, which is provided at /ivt_rego6xx/metrics.
+     *
+     * @param[in] outbox    MQTT outbox
+     */
+    void setOutbox(const IVTRego6xxOutbox* outbox)
+    {
+        m_outbox = outbox;
+    }
+
+    /**
+     * Set the telemetry, whose snapshot is provided at /ivt_rego6xx/snapshot.json
+     * and /ivt_rego6xx/snapshot.bin. Its cached entity values are provided at
+     * /ivt_rego6xx/metrics too.
+     *
+     * @param[in] telemetry Telemetry
+     */
+    void setTelemetry(const IVTRego6xxTelemetry* telemetry)
+    {
+        m_telemetry = telemetry;
+    }
+
+#ifdef IVT_REGO6XX_MODBUS
+    /**
+     * Set the Modbus TCP server, which is provided at /ivt_rego6xx/metrics.
+     *
+     * @param[in] modbusServer  Modbus TCP server
+     */
+    void setModbusServer(const IVTRego6xxModbusServer* modbusServer)
+    {
+        m_modbusServer = modbusServer;
+    }
+#endif /* IVT_REGO6XX_MODBUS */
+
+    /**
+     * Can the request be handled?
+     *
+     * @param[in] request   Web request
+     *
+     * @return If the request can be handled, it will return true otherwise false.
+     */
+    bool canHandle(AsyncWebServerRequest* request) const override;
+
+    /**
+     * Handle the web request.
+     *
+     * @param[in] request   Web request
+     */
+    void handleRequest(AsyncWebServerRequest* request) override;
+
+private:
+
+    /**
+     * Sections of the metrics in the order of the exposition.
+     */
+    enum MetricsSection
+    {
+        METRICS_SECTION_BUS_HEALTH = 0U,    /**< Bus health */
+        METRICS_SECTION_ENTITY_VALUES,      /**< Entity values */
+        METRICS_SECTION_STALENESS,          /**< Staleness */
+        METRICS_SECTION_ACTION_LATENCY,     /**< User action latency */
+        METRICS_SECTION_LOOP_COST,          /**< Main loop cost */
+        METRICS_SECTION_WARM_START,         /**< Warm start */
+        METRICS_SECTION_PROFILES,           /**< Polling profiles */
+        METRICS_SECTION_DEPENDENCIES,       /**< Dependent refreshes */
+        METRICS_SECTION_ADAPTIVE_SAMPLING,  /**< Adaptive sampling */
+        METRICS_SECTION_SAMPLING_GROUPS,    /**< Sampling groups */
+        METRICS_SECTION_DERIVED_METRICS,    /**< Derived metrics */
+        METRICS_SECTION_AGGREGATION,        /**< Windowed aggregation */
+        METRICS_SECTION_HISTORY,            /**< Sample history */
+        METRICS_SECTION_OUTBOX,             /**< MQTT outbox */
+        METRICS_SECTION_TELEMETRY,          /**< Telemetry */
+#ifdef IVT_REGO6XX_MODBUS
+        METRICS_SECTION_MODBUS,             /**< Modbus TCP server */
+#endif /* IVT_REGO6XX_MODBUS */
+        METRICS_SECTION_COUNT               /**< Number of sections */
+    };
+
+    const Rego6xxTraceBuffer*         m_recording;        /**< UART traffic recording */
+    const Rego6xxFrameRing*           m_frameRing;        /**< Protocol frame ring */
+    const IVTRego6xxBusHealth*        m_busHealth;        /**< Bus health */
+    const IVTRego6xxStaleness*        m_staleness;        /**< Staleness of the entity values */
+    const IVTRego6xxActionLatency*    m_actionLatency;    /**< User action latency */
+    const IVTRego6xxLoopCost*         m_loopCost;         /**< Main loop cost */
+    const IVTRego6xxDeferredLog*      m_deferredLog;      /**< Deferred log */
+    const IVTRego6xxWarmStart*        m_warmStart;        /**< Warm start */
+    const IVTRego6xxPollingProfiles*  m_profiles;         /**< Polling profiles */
+    const IVTRego6xxDependencies*     m_dependencies;     /**< Dependent refreshes */
+    const IVTRego6xxAdaptiveSampling* m_adaptiveSampling; /**< Adaptive sampling */
+    const IVTRego6xxSamplingGroups*   m_samplingGroups;   /**< Sampling groups */
+    const IVTRego6xxDerivedMetrics*   m_derivedMetrics;   /**< Derived metrics */
+    const IVTRego6xxAggregation*      m_aggregation;      /**< Windowed aggregation */
+    const IVTRego6xxHistory*          m_history;          /**< Sample history */
+    const IVTRego6xxOutbox*           m_outbox;           /**< MQTT outbox */
+    const IVTRego6xxTelemetry*        m_telemetry;        /**< Telemetry */
+#ifdef IVT_REGO6XX_MODBUS
+    const IVTRego6xxModbusServer*     m_modbusServer;     /**< Modbus TCP server */
+#endif /* IVT_REGO6XX_MODBUS */
+
+    IVTRego6xxWebHandler(const IVTRego6xxWebHandler& other);
+    IVTRego6xxWebHandler& operator=(const IVTRego6xxWebHandler& other);
+
+    /**
+     * Write a part of a metrics section.
+     *
+     * @param[out] out      Output
+     * @param[in]  section  Metrics section
+     * @param[in]  part     Part index in the section, starting with 0.
+     *
+     * @return If the part exists, it will return true otherwise false.
+     */
+    bool writeMetricsPart(std::string& out, size_t section, size_t part) const;
+
+    /**
+     * Write the metrics of a source, which are provided as a single part.
+     *
+     * @tparam     T        Type of the metrics source
+     * @param[out] out      Output
+     * @param[in]  source   Metrics source, may be nullptr.
+     * @param[in]  part     Part index
+     *
+     * @return If the part exists, it will return true otherwise false.
+     */
+    template<typename T>
+    static bool writeSinglePart(std::string& out, const T* source, size_t part)
+    {
+        if ((0U == part) && (nullptr != source))
+        {
+            source->writeMetrics(out);
+        }
+
+        return (0U == part);
+    }
+
+    /**
+     * Handle the request for the UART traffic recording.
+     *
+     * @param[in] request   Web request
+     */
+    void handleRecording(AsyncWebServerRequest* request);
+
+    /**
+     * Handle the request for the latest protocol frames.
+     *
+     * @param[in] request   Web request
+     */
+    void handleFrames(AsyncWebServerRequest* request);
+
+    /**
+     * Handle the request for the metrics in the Prometheus text format.
+     *
+     * @param[in] request   Web request
+     */
+    void handleMetrics(AsyncWebServerRequest* request);
+
+    /**
+     * Handle the request for the event trace in the Chrome trace event format.
+     *
+     * @param[in] request   Web request
+     */
+    void handleTrace(AsyncWebServerRequest* request);
+
+    /**
+     * Handle the request for the deferred log, which is formatted to text lines.
+     *
+     * @param[in] request   Web request
+     */
+    void handleLog(AsyncWebServerRequest* request);
+
+    /**
+     * Handle the request for the sample history, either decoded to CSV lines
+     * or compressed in the binary format.
+     *
+     * @param[in] request   Web request
+     * @param[in] isBinary  Shall the compressed binary format be provided?
+     */
+    void handleHistory(AsyncWebServerRequest* request, bool isBinary);
+
+    /**
+     * Handle the request for the snapshot of all entity values, either in
+     * the JSON or in the binary telemetry format.
+     *
+     * @param[in] request   Web request
+     * @param[in] isBinary  Shall the binary format be provided?
+     */
+    void handleSnapshot(AsyncWebServerRequest* request, bool isBinary);
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+#endif /* USE_WEBSERVER */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
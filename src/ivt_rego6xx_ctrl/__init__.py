@@ -26,8 +26,11 @@
 
 import esphome.codegen as cg # Code generation API
 import esphome.config_validation as cv # Configuration validation API
+import esphome.final_validate as fv # Validation of the whole configuration
 from esphome.components import uart # UART component
+from esphome.components import time as time_ # Time component
 from esphome.const import CONF_ID # ID configuration
+from esphome.core import CORE # Access to the configuration directory
 
 ################################################################################
 # Variables
@@ -38,6 +41,231 @@ DEPENDENCIES = ["uart"]
 # UART ID (mandatory)
 CONF_UART_ID = "uart_id"
 
+# Size of the UART traffic recording buffer in byte (optional)
+CONF_RECORDER_SIZE = "recorder_size"
+
+# Size of the protocol frame ring in byte, 0 disables the frame trace (optional)
+CONF_FRAME_TRACE_SIZE = "frame_trace_size"
+
+# Number of events in the event trace ring buffer, 0 disables the tracepoints (optional)
+CONF_EVENT_TRACE_SIZE = "event_trace_size"
+
+# Compile-time log levels of the component subsystems (optional)
+CONF_LOG_LEVELS = "log_levels"
+
+# Log level of the polling, which reads sensors, binary sensors, text sensors and numbers
+CONF_POLL = "poll"
+
+# Log level of the writes of buttons and numbers
+CONF_WRITE = "write"
+
+# Number of records in the deferred log, 0 disables it (optional)
+CONF_DEFERRED_LOG_SIZE = "deferred_log_size"
+
+# Restore the last-known entity values after a reboot (optional)
+CONF_WARM_START = "warm_start"
+
+# Interval for saving the last-known entity values
+CONF_SAVE_INTERVAL = "save_interval"
+
+# Read every entity once after the start with a minimal request pause (optional)
+CONF_STARTUP_BURST = "startup_burst"
+
+# Delay after the start until the startup burst begins
+CONF_INITIAL_DELAY = "initial_delay"
+
+# Order of the kinds of entities in the startup burst
+CONF_ORDER = "order"
+
+# Select the polling profile by the operating mode of the heatpump (optional)
+CONF_POLLING_PROFILES = "polling_profiles"
+
+# Time a new operating mode shall be detected until its profile is activated
+CONF_HOLD_TIME = "hold_time"
+
+# Refresh entities, if the value of another entity changes (optional)
+CONF_DEPENDENT_REFRESH = "dependent_refresh"
+
+# Entity, whose value change triggers the refresh
+CONF_ON_CHANGE = "on_change"
+
+# Entities, which are refreshed
+CONF_REFRESH = "refresh"
+
+# Time after the change, within the entities shall be refreshed
+CONF_WITHIN = "within"
+
+# Read sensors back to back as one unit (optional)
+CONF_SAMPLING_GROUPS = "sampling_groups"
+
+# Sensors of a sampling group
+CONF_SENSORS = "sensors"
+
+# Derive operating metrics from the read entity values (optional)
+CONF_DERIVED_METRICS = "derived_metrics"
+
+# Entities, the derived metrics are fed from
+CONF_COMPRESSOR = "compressor"
+CONF_ADD_HEAT_3KW = "add_heat_3kw"
+CONF_ADD_HEAT_6KW = "add_heat_6kw"
+CONF_HOT_WATER = "hot_water"
+CONF_HEAT_CURVE_ACTUAL = "heat_curve_actual"
+CONF_HEAT_CURVE_TARGET = "heat_curve_target"
+
+# Buffer the published values during a MQTT outage and replay them afterwards (optional)
+CONF_MQTT_OUTBOX = "mqtt_outbox"
+
+# Maximum number of buffered values
+CONF_SIZE = "size"
+
+# Interval between two replayed values
+CONF_REPLAY_INTERVAL = "replay_interval"
+
+# Time source for the original timestamp of the replayed values
+CONF_TIME_ID = "time_id"
+
+# Publish the changed entity values combined in a single telemetry frame (optional)
+CONF_TELEMETRY = "telemetry"
+
+# Interval between two telemetry frames
+CONF_INTERVAL = "interval"
+
+# Format of the telemetry frames
+CONF_FORMAT = "format"
+
+# Provide the entity values as registers by a Modbus TCP server (optional)
+CONF_MODBUS = "modbus"
+
+# TCP port of the Modbus TCP server
+CONF_PORT = "port"
+
+# Run the microbenchmarks once after startup (optional)
+CONF_BENCHMARK = "benchmark"
+
+# Replace the heatpump by the simulator and run the polling benchmark (optional)
+CONF_POLLING_BENCHMARK = "polling_benchmark"
+
+# Replace the heatpump by the replay of a recorded trace (optional)
+CONF_REPLAY = "replay"
+
+# Recorded trace file, e.g. downloaded from /ivt_rego6xx/recording.bin
+CONF_FILE = "file"
+
+# Replay speed factor, 0 provides every response immediately
+CONF_SPEED = "speed"
+
+# ID of the generated trace array
+CONF_RAW_DATA_ID = "raw_data_id"
+
+# Options of the entity platforms, which are checked for the Modbus register mapping
+CONF_PLATFORM = "platform"
+CONF_IVT_REGO6XX_CTRL_ID = "ivt_rego6xx_ctrl_id"
+CONF_IVT_REGO6XX_ADDR = "ivt_rego6xx_ctrl_addr"
+
+# Virtual duration of the polling benchmark
+CONF_DURATION = "duration"
+
+# Virtual interval between two scripted button presses, 0 disables them
+CONF_PRESS_INTERVAL = "press_interval"
+
+# Virtual interval, after which the scripted alarm is raised or cleared, 0 disables it
+CONF_ALARM_INTERVAL = "alarm_interval"
+
+# Virtual interval between two scripted temperature changes, 0 disables them
+CONF_TEMPERATURE_INTERVAL = "temperature_interval"
+
+# Polling policies, which are compared by the polling benchmark
+CONF_POLICIES = "policies"
+
+# Name of a polling policy
+CONF_NAME = "name"
+
+# Period for reading sensors from heatpump
+CONF_SENSOR_PERIOD = "sensor_period"
+
+# Period for reading binary sensors from heatpump
+CONF_BINARY_SENSOR_PERIOD = "binary_sensor_period"
+
+# Period for reading text sensors from heatpump
+CONF_TEXT_SENSOR_PERIOD = "text_sensor_period"
+
+# Period for reading numbers from heatpump
+CONF_NUMBER_PERIOD = "number_period"
+
+# Pause between every request to the heatpump controller
+CONF_REQUEST_PAUSE = "request_pause"
+
+# Handle buttons and number updates after every request or only once per round
+CONF_BUTTON_PREEMPTION = "button_preemption"
+
+# Log levels, which can be selected per subsystem
+LOG_LEVELS = {
+    "NONE": "ESPHOME_LOG_LEVEL_NONE",
+    "ERROR": "ESPHOME_LOG_LEVEL_ERROR",
+    "WARN": "ESPHOME_LOG_LEVEL_WARN",
+    "INFO": "ESPHOME_LOG_LEVEL_INFO",
+    "DEBUG": "ESPHOME_LOG_LEVEL_DEBUG"
+}
+
+# Log levels configuration schema, the default is the ESPHome log level.
+LOG_LEVELS_SCHEMA = cv.Schema({
+    cv.Optional(CONF_POLL): cv.one_of(*LOG_LEVELS, upper=True),
+    cv.Optional(CONF_WRITE): cv.one_of(*LOG_LEVELS, upper=True)
+})
+
+# Warm start configuration schema
+WARM_START_SCHEMA = cv.Schema({
+    cv.Optional(CONF_SAVE_INTERVAL, default="15min"): cv.positive_time_period_milliseconds
+})
+
+# Polling policy configuration schema, the defaults are the production policy.
+POLLING_POLICY_SCHEMA = cv.Schema({
+    cv.Required(CONF_NAME): cv.string,
+    cv.Optional(CONF_SENSOR_PERIOD, default="2min"): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_BINARY_SENSOR_PERIOD, default="30s"): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_TEXT_SENSOR_PERIOD, default="30s"): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_NUMBER_PERIOD, default="60s"): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_REQUEST_PAUSE, default="100ms"): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_BUTTON_PREEMPTION, default=True): cv.boolean
+})
+
+# Polling benchmark configuration schema
+POLLING_BENCHMARK_SCHEMA = cv.Schema({
+    cv.Optional(CONF_DURATION, default="7d"): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_PRESS_INTERVAL, default="5min"): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_ALARM_INTERVAL, default="6h"): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_TEMPERATURE_INTERVAL, default="10min"): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_POLICIES, default=[]): cv.ensure_list(POLLING_POLICY_SCHEMA)
+})
+
+def validate_trace(value):
+    """
+    Validate that the file is a recorded trace, see lib/Rego6xx/Rego6xxTrace.h.
+
+    Args:
+        value: Path of the trace file
+
+    Returns:
+        Path of the trace file
+    """
+    value = cv.file_(value)
+
+    with open(CORE.relative_config_path(value), "rb") as trace_file:
+        header = trace_file.read(8)
+
+    # File header: magic "R6TR" and version 1
+    if (8 > len(header)) or (b"R6TR" != header[0:4]) or (1 != header[4]):
+        raise cv.Invalid(f"'{value}' is not a Rego6xx trace.")
+
+    return value
+
+# Replay configuration schema
+REPLAY_SCHEMA = cv.Schema({
+    cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
+    cv.Required(CONF_FILE): validate_trace,
+    cv.Optional(CONF_SPEED, default=1): cv.int_range(min=0, max=255)
+})
+
 # Namespace for the generated code.
 ivt_rego6xx_ctrl_ns = cg.esphome_ns.namespace("ivt_rego6xx_ctrl")
 
@@ -46,6 +274,207 @@ ivt_rego6xx_ctrl = ivt_rego6xx_ctrl_ns.class_(
     "IVTRego6xxCtrl", cg.Component, uart.UARTDevice
 )
 
+# Kinds of entities, which can be part of the startup burst.
+BurstKind = ivt_rego6xx_ctrl.enum("BurstKind")
+BURST_KINDS = {
+    "sensors": BurstKind.BURST_KIND_SENSORS,
+    "binary_sensors": BurstKind.BURST_KIND_BINARY_SENSORS,
+    "text_sensors": BurstKind.BURST_KIND_TEXT_SENSORS,
+    "numbers": BurstKind.BURST_KIND_NUMBERS
+}
+
+# Polling profiles configuration schema
+POLLING_PROFILES_SCHEMA = cv.Schema({
+    cv.Optional(CONF_HOLD_TIME, default="60s"): cv.positive_time_period_milliseconds
+})
+
+# Polling profiles, which are selected by the operating mode of the heatpump.
+PollingProfile = ivt_rego6xx_ctrl_ns.class_("IVTRego6xxPollingProfiles").enum("Profile")
+POLLING_PROFILES = {
+    "idle": PollingProfile.PROFILE_IDLE,
+    "heating": PollingProfile.PROFILE_HEATING,
+    "hot_water": PollingProfile.PROFILE_HOT_WATER,
+    "alarm": PollingProfile.PROFILE_ALARM
+}
+
+DerivedInput = ivt_rego6xx_ctrl_ns.class_("IVTRego6xxDerivedMetrics").enum("Input")
+DERIVED_INPUTS = {
+    CONF_COMPRESSOR: DerivedInput.INPUT_COMPRESSOR,
+    CONF_ADD_HEAT_3KW: DerivedInput.INPUT_ADD_HEAT_3KW,
+    CONF_ADD_HEAT_6KW: DerivedInput.INPUT_ADD_HEAT_6KW,
+    CONF_HOT_WATER: DerivedInput.INPUT_HOT_WATER,
+    CONF_HEAT_CURVE_ACTUAL: DerivedInput.INPUT_HEAT_CURVE_ACTUAL,
+    CONF_HEAT_CURVE_TARGET: DerivedInput.INPUT_HEAT_CURVE_TARGET
+}
+
+# Classes of the polled entities, which are declared by the entity platforms.
+# The types of the entity references are validated by their class names.
+ivt_rego6xx_sensor = ivt_rego6xx_ctrl_ns.class_("IVTRego6xxSensor")
+ivt_rego6xx_binary_sensor = ivt_rego6xx_ctrl_ns.class_("IVTRego6xxBinarySensor")
+ivt_rego6xx_text_sensor = ivt_rego6xx_ctrl_ns.class_("IVTRego6xxTextSensor")
+ivt_rego6xx_number = ivt_rego6xx_ctrl_ns.class_("IVTRego6xxNumber")
+
+# Entities, whose read values are processed, e.g. to detect a change.
+VALUE_ENTITY_TYPES = [ivt_rego6xx_sensor, ivt_rego6xx_binary_sensor, ivt_rego6xx_number]
+
+# Entities, which are read by the polling engine.
+POLLED_ENTITY_TYPES = [ivt_rego6xx_sensor, ivt_rego6xx_binary_sensor, ivt_rego6xx_text_sensor, ivt_rego6xx_number]
+
+# Read periods of an entity per polling profile, used by the entity platforms.
+POLL_PERIODS_SCHEMA = cv.Schema({
+    cv.Optional(profile): cv.positive_time_period_milliseconds for profile in POLLING_PROFILES
+})
+
+# Dependent refresh configuration schema, one entry per triggering entity.
+DEPENDENT_REFRESH_SCHEMA = cv.Schema({
+    cv.Required(CONF_ON_CHANGE): cv.use_id(cg.EntityBase),
+    cv.Required(CONF_REFRESH): cv.ensure_list(cv.use_id(cg.EntityBase)),
+    cv.Optional(CONF_WITHIN, default="5s"): cv.positive_time_period_milliseconds
+})
+
+# Sampling group configuration schema, whose sensors are read back to back.
+SAMPLING_GROUP_SCHEMA = cv.Schema({
+    cv.Required(CONF_NAME): cv.string,
+    cv.Required(CONF_SENSORS): cv.All(cv.ensure_list(cv.use_id(ivt_rego6xx_sensor)), cv.Length(min=2))
+})
+
+# Derived metrics configuration schema, which maps the entities to the inputs.
+DERIVED_METRICS_SCHEMA = cv.All(
+    cv.Schema({
+        **{cv.Optional(name): cv.use_id(cg.EntityBase) for name in DERIVED_INPUTS},
+        cv.Optional(CONF_SAVE_INTERVAL, default="15min"): cv.positive_time_period_milliseconds
+    }),
+    cv.has_at_least_one_key(*DERIVED_INPUTS)
+)
+
+# MQTT outbox configuration schema
+MQTT_OUTBOX_SCHEMA = cv.All(
+    cv.Schema({
+        cv.Optional(CONF_SIZE, default=256): cv.int_range(min=16, max=4096),
+        cv.Optional(CONF_REPLAY_INTERVAL, default="100ms"): cv.All(
+            cv.positive_time_period_milliseconds,
+            cv.Range(min=cv.TimePeriod(milliseconds=10))
+        ),
+        cv.Optional(CONF_TIME_ID): cv.use_id(time_.RealTimeClock)
+    }),
+    cv.requires_component("mqtt")
+)
+
+# Telemetry configuration schema
+TELEMETRY_SCHEMA = cv.All(
+    cv.Schema({
+        cv.Optional(CONF_INTERVAL, default="30s"): cv.All(
+            cv.positive_time_period_milliseconds,
+            cv.Range(min=cv.TimePeriod(seconds=1))
+        ),
+        cv.Optional(CONF_FORMAT, default="json"): cv.one_of("json", "binary", lower=True)
+    }),
+    cv.requires_component("mqtt")
+)
+
+# Modbus TCP server configuration schema
+MODBUS_SCHEMA = cv.All(
+    cv.Schema({
+        cv.Optional(CONF_PORT, default=502): cv.port
+    }),
+    cv.requires_component("socket")
+)
+
+# Startup burst configuration schema
+STARTUP_BURST_SCHEMA = cv.Schema({
+    cv.Optional(CONF_INITIAL_DELAY, default="10s"): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_REQUEST_PAUSE, default="20ms"): cv.All(
+        cv.positive_time_period_milliseconds,
+        cv.Range(min=cv.TimePeriod(milliseconds=10))
+    ),
+    cv.Optional(CONF_ORDER, default=["sensors", "binary_sensors", "numbers", "text_sensors"]): cv.ensure_list(
+        cv.one_of(*BURST_KINDS, lower=True)
+    )
+})
+
+def validate_entity_type(full_config, entity_id, entity_types: list, option: str) -> None:
+    """
+    Validate that the referenced entity is one of the given entity classes.
+    The use_id() validator supports only a single class.
+
+    Args:
+        full_config: Whole configuration
+        entity_id: Reference to the entity
+        entity_types (list): Supported entity classes
+        option (str): Name of the option, which references the entity
+    """
+    path = full_config.get_path_for_id(entity_id)[:-1]
+    declared_type = full_config.get_config_for_path(path)[CONF_ID].type
+
+    if not any(declared_type.inherits_from(entity_type) for entity_type in entity_types):
+        names = ", ".join(str(entity_type) for entity_type in entity_types)
+        raise cv.Invalid(f"'{entity_id}' of '{option}' must be one of {names}.")
+
+def validate_modbus_registers(full_config, config: dict) -> None:
+    """
+    Validate that every Modbus register address is used only once per register type.
+    The register address is the address of the entity without its command id,
+    e.g. a front panel and a system register entity with the same address collide.
+
+    Args:
+        full_config: Whole configuration
+        config (dict): Configuration of this component
+    """
+    # Sensors and binary sensors are input registers, numbers are holding registers.
+    register_types = {
+        "sensor": "input",
+        "binary_sensor": "input",
+        "number": "holding"
+    }
+    used = {}
+
+    for domain, register_type in register_types.items():
+        for entity in full_config.get(domain, []):
+            is_register = (
+                ("ivt_rego6xx_ctrl" == entity.get(CONF_PLATFORM)) and
+                (config[CONF_ID] == entity.get(CONF_IVT_REGO6XX_CTRL_ID)) and
+                (CONF_IVT_REGO6XX_ADDR in entity)
+            )
+
+            if is_register:
+                key = (register_type, entity[CONF_IVT_REGO6XX_ADDR])
+
+                if key in used:
+                    raise cv.Invalid(
+                        f"Modbus {register_type} register 0x{key[1]:04X} is used by '{used[key]}' and '{entity[CONF_ID]}'. "
+                        "The command id isn't part of the register address."
+                    )
+
+                used[key] = entity[CONF_ID]
+
+def final_validate(config: dict) -> dict:
+    """
+    Validate the types of the entity references, which can't be done by the schema.
+
+    Args:
+        config (dict): Configuration
+
+    Returns:
+        dict: Configuration
+    """
+    full_config = fv.full_config.get()
+
+    for dependency in config[CONF_DEPENDENT_REFRESH]:
+        validate_entity_type(full_config, dependency[CONF_ON_CHANGE], VALUE_ENTITY_TYPES, CONF_ON_CHANGE)
+
+        for target_id in dependency[CONF_REFRESH]:
+            validate_entity_type(full_config, target_id, POLLED_ENTITY_TYPES, CONF_REFRESH)
+
+    if CONF_DERIVED_METRICS in config:
+        for name in DERIVED_INPUTS:
+            if name in config[CONF_DERIVED_METRICS]:
+                validate_entity_type(full_config, config[CONF_DERIVED_METRICS][name], VALUE_ENTITY_TYPES, name)
+
+    if CONF_MODBUS in config:
+        validate_modbus_registers(full_config, config)
+
+    return config
+
 # The configuration schema is automatically loaded by the ESPHome core and used to validate
 # the provided configuration. See https://esphome.io/guides/contributing#config-validation
 CONFIG_SCHEMA = (
@@ -53,12 +482,39 @@ CONFIG_SCHEMA = (
         cv.GenerateID(): cv.declare_id(ivt_rego6xx_ctrl),
 
         # Mandatory variables
-        cv.Required(CONF_UART_ID): cv.use_id(uart.UARTDevice)
+        cv.Required(CONF_UART_ID): cv.use_id(uart.UARTDevice),
+
+        # Optional variables
+        cv.Optional(CONF_RECORDER_SIZE, default=0): cv.int_range(min=0),
+        cv.Optional(CONF_FRAME_TRACE_SIZE, default=4096): cv.Any(0, cv.int_range(min=256)),
+        cv.Optional(CONF_EVENT_TRACE_SIZE, default=0): cv.int_range(min=0, max=65535),
+        cv.Optional(CONF_LOG_LEVELS, default={}): LOG_LEVELS_SCHEMA,
+        cv.Optional(CONF_DEFERRED_LOG_SIZE, default=0): cv.int_range(min=0, max=65535),
+        cv.Optional(CONF_WARM_START): WARM_START_SCHEMA,
+        cv.Optional(CONF_STARTUP_BURST): STARTUP_BURST_SCHEMA,
+        cv.Optional(CONF_POLLING_PROFILES): POLLING_PROFILES_SCHEMA,
+        cv.Optional(CONF_DEPENDENT_REFRESH, default=[]): cv.ensure_list(DEPENDENT_REFRESH_SCHEMA),
+        cv.Optional(CONF_DERIVED_METRICS): DERIVED_METRICS_SCHEMA,
+        cv.Optional(CONF_SAMPLING_GROUPS, default=[]): cv.All(cv.ensure_list(SAMPLING_GROUP_SCHEMA), cv.Length(max=4)),
+        cv.Optional(CONF_MQTT_OUTBOX): MQTT_OUTBOX_SCHEMA,
+        cv.Optional(CONF_TELEMETRY): TELEMETRY_SCHEMA,
+        cv.Optional(CONF_MODBUS): MODBUS_SCHEMA,
+        cv.Optional(CONF_BENCHMARK, default=False): cv.boolean,
+        cv.Optional(CONF_POLLING_BENCHMARK): POLLING_BENCHMARK_SCHEMA,
+        cv.Optional(CONF_REPLAY): REPLAY_SCHEMA
     })
     .extend(cv.COMPONENT_SCHEMA)
     .extend(uart.UART_DEVICE_SCHEMA)
+    # The polling benchmark and the replay both take the place of the heatpump.
+    .add_extra(cv.has_at_most_one_key(CONF_POLLING_BENCHMARK, CONF_REPLAY))
+    # Their values would be saved and published by the next production firmware.
+    .add_extra(cv.has_at_most_one_key(CONF_WARM_START, CONF_POLLING_BENCHMARK))
+    .add_extra(cv.has_at_most_one_key(CONF_WARM_START, CONF_REPLAY))
 )
 
+# The final validation runs after all components are validated and checks the entity references.
+FINAL_VALIDATE_SCHEMA = final_validate
+
 ################################################################################
 # Functions
 ################################################################################
@@ -76,6 +532,115 @@ async def to_code(config: dict) -> None:
     await cg.register_component(var, config)
     await uart.register_uart_device(var, config)
 
+    cg.add(var.setRecorderSize(config[CONF_RECORDER_SIZE]))
+    cg.add(var.setFrameTraceSize(config[CONF_FRAME_TRACE_SIZE]))
+
+    if 0 < config[CONF_EVENT_TRACE_SIZE]:
+        # The tracepoints are part of the libraries too, therefore a build flag is used.
+        cg.add_build_flag(f"-DEVENT_TRACE_SIZE={config[CONF_EVENT_TRACE_SIZE]}U")
+
+    log_levels = config[CONF_LOG_LEVELS]
+
+    if CONF_POLL in log_levels:
+        cg.add_define("IVT_REGO6XX_POLL_LOG_LEVEL", cg.RawExpression(LOG_LEVELS[log_levels[CONF_POLL]]))
+
+    if CONF_WRITE in log_levels:
+        cg.add_define("IVT_REGO6XX_WRITE_LOG_LEVEL", cg.RawExpression(LOG_LEVELS[log_levels[CONF_WRITE]]))
+
+    if 0 < config[CONF_DEFERRED_LOG_SIZE]:
+        cg.add_define("IVT_REGO6XX_DEFERRED_LOG_SIZE", cg.RawExpression(f"{config[CONF_DEFERRED_LOG_SIZE]}U"))
+
+    if CONF_WARM_START in config:
+        cg.add(var.setWarmStartSaveInterval(config[CONF_WARM_START][CONF_SAVE_INTERVAL].total_milliseconds))
+
+    # The warm start refreshes its restored values with the startup burst, with the burst defaults if not configured.
+    if (CONF_STARTUP_BURST in config) or (CONF_WARM_START in config):
+        startup_burst = config.get(CONF_STARTUP_BURST, STARTUP_BURST_SCHEMA({}))
+        cg.add(var.setStartupBurst(
+            startup_burst[CONF_INITIAL_DELAY].total_milliseconds,
+            startup_burst[CONF_REQUEST_PAUSE].total_milliseconds
+        ))
+
+        for kind in startup_burst[CONF_ORDER]:
+            cg.add(var.addStartupBurstKind(BURST_KINDS[kind]))
+
+    if CONF_POLLING_PROFILES in config:
+        cg.add(var.setPollingProfiles(config[CONF_POLLING_PROFILES][CONF_HOLD_TIME].total_milliseconds))
+
+    for dependency in config[CONF_DEPENDENT_REFRESH]:
+        trigger = await cg.get_variable(dependency[CONF_ON_CHANGE])
+
+        for target_id in dependency[CONF_REFRESH]:
+            target = await cg.get_variable(target_id)
+            cg.add(var.addDependency(trigger, target, dependency[CONF_WITHIN].total_milliseconds))
+
+    for sampling_group in config[CONF_SAMPLING_GROUPS]:
+        cg.add(var.addSamplingGroup(sampling_group[CONF_NAME]))
+
+        for sensor_id in sampling_group[CONF_SENSORS]:
+            member = await cg.get_variable(sensor_id)
+            cg.add(var.addSamplingGroupMember(member))
+
+    if CONF_DERIVED_METRICS in config:
+        derived_metrics = config[CONF_DERIVED_METRICS]
+
+        for name, derived_input in DERIVED_INPUTS.items():
+            if name in derived_metrics:
+                entity = await cg.get_variable(derived_metrics[name])
+                cg.add(var.setDerivedMetricsInput(derived_input, entity))
+
+        cg.add(var.setDerivedMetricsSaveInterval(derived_metrics[CONF_SAVE_INTERVAL].total_milliseconds))
+
+    if CONF_MQTT_OUTBOX in config:
+        mqtt_outbox = config[CONF_MQTT_OUTBOX]
+        cg.add(var.setMqttOutbox(mqtt_outbox[CONF_SIZE], mqtt_outbox[CONF_REPLAY_INTERVAL].total_milliseconds))
+
+        if CONF_TIME_ID in mqtt_outbox:
+            time_source = await cg.get_variable(mqtt_outbox[CONF_TIME_ID])
+            cg.add(var.setMqttOutboxTime(time_source))
+
+    if CONF_TELEMETRY in config:
+        telemetry = config[CONF_TELEMETRY]
+        cg.add(var.setTelemetry(telemetry[CONF_INTERVAL].total_milliseconds, "binary" == telemetry[CONF_FORMAT]))
+
+    if CONF_MODBUS in config:
+        cg.add_define("IVT_REGO6XX_MODBUS")
+        cg.add(var.setModbusPort(config[CONF_MODBUS][CONF_PORT]))
+
+    if config[CONF_BENCHMARK]:
+        cg.add_define("IVT_REGO6XX_BENCHMARK")
+        # Count heap allocations by wrapping the allocator at link time.
+        cg.add_build_flag("-Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc")
+
+    if CONF_POLLING_BENCHMARK in config:
+        polling_benchmark = config[CONF_POLLING_BENCHMARK]
+        cg.add_define("IVT_REGO6XX_POLLING_BENCHMARK")
+        cg.add(var.setPollingBenchmarkDuration(polling_benchmark[CONF_DURATION].total_milliseconds))
+        cg.add(var.setPollingBenchmarkPressInterval(polling_benchmark[CONF_PRESS_INTERVAL].total_milliseconds))
+        cg.add(var.setPollingBenchmarkAlarmInterval(polling_benchmark[CONF_ALARM_INTERVAL].total_milliseconds))
+        cg.add(var.setPollingBenchmarkTemperatureInterval(polling_benchmark[CONF_TEMPERATURE_INTERVAL].total_milliseconds))
+
+        for policy in polling_benchmark[CONF_POLICIES]:
+            cg.add(var.addPollingBenchmarkPolicy(
+                policy[CONF_NAME],
+                policy[CONF_SENSOR_PERIOD].total_milliseconds,
+                policy[CONF_BINARY_SENSOR_PERIOD].total_milliseconds,
+                policy[CONF_TEXT_SENSOR_PERIOD].total_milliseconds,
+                policy[CONF_NUMBER_PERIOD].total_milliseconds,
+                policy[CONF_REQUEST_PAUSE].total_milliseconds,
+                policy[CONF_BUTTON_PREEMPTION]
+            ))
+
+    if CONF_REPLAY in config:
+        replay = config[CONF_REPLAY]
+
+        with open(CORE.relative_config_path(replay[CONF_FILE]), "rb") as trace_file:
+            trace = trace_file.read()
+
+        cg.add_define("IVT_REGO6XX_REPLAY")
+        trace_data = cg.progmem_array(replay[CONF_RAW_DATA_ID], list(trace))
+        cg.add(var.setReplay(trace_data, len(trace), replay[CONF_SPEED]))
+
 ################################################################################
 # Main
 ################################################################################
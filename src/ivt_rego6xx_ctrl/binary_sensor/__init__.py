@@ -27,8 +27,9 @@
 import esphome.codegen as cg # Code generation API
 import esphome.config_validation as cv # Configuration validation API
 from esphome.components import binary_sensor # Binary sensor component
-from esphome.const import CONF_ID, CONF_STATE_CLASS
-from .. import ivt_rego6xx_ctrl_ns # IVT Rego6xx control component namespace
+from esphome.const import CONF_ID, CONF_STATE_CLASS, CONF_TYPE
+from esphome.const import DEVICE_CLASS_PROBLEM, ENTITY_CATEGORY_DIAGNOSTIC
+from .. import ivt_rego6xx_ctrl_ns, POLL_PERIODS_SCHEMA, POLLING_PROFILES # IVT Rego6xx control component namespace
 
 ################################################################################
 # Variables
@@ -41,14 +42,24 @@ ivt_rego6xx_binary_sensor = ivt_rego6xx_ctrl_ns.class_(
     "IVTRego6xxBinarySensor", binary_sensor.BinarySensor
 )
 
+# The class of the service level binary sensor.
+ivt_rego6xx_sla_binary_sensor = ivt_rego6xx_ctrl_ns.class_(
+    "IVTRego6xxSlaBinarySensor", binary_sensor.BinarySensor
+)
+
 # Sensor variables
 CONF_IVT_REGO6XX_CTRL_ID = "ivt_rego6xx_ctrl_id"
 CONF_IVT_REGO6XX_CMD = "ivt_rego6xx_ctrl_cmd"
 CONF_IVT_REGO6XX_ADDR = "ivt_rego6xx_ctrl_addr"
+CONF_MAX_AGE = "max_age"
+CONF_POLL_PERIODS = "poll_periods"
 
-# The configuration schema is automatically loaded by the ESPHome core and used to validate
-# the provided configuration. See https://esphome.io/guides/contributing#config-validation
-CONFIG_SCHEMA = binary_sensor.binary_sensor_schema(ivt_rego6xx_binary_sensor).extend(
+# Binary sensor types
+TYPE_REGISTER = "register"
+TYPE_SLA = "sla"
+
+# Binary sensor, which provides the value of a heatpump register.
+REGISTER_SCHEMA = binary_sensor.binary_sensor_schema(ivt_rego6xx_binary_sensor).extend(
     cv.Schema({
         cv.GenerateID(): cv.declare_id(ivt_rego6xx_binary_sensor),
 
@@ -56,9 +67,38 @@ CONFIG_SCHEMA = binary_sensor.binary_sensor_schema(ivt_rego6xx_binary_sensor).ex
         cv.Required(CONF_IVT_REGO6XX_CTRL_ID): cv.use_id(ivt_rego6xx_ctrl_ns.IVTRego6xxCtrl),
         cv.Required(CONF_IVT_REGO6XX_CMD): cv.hex_int_range(0x00, 0x7F),
         cv.Required(CONF_IVT_REGO6XX_ADDR): cv.hex_int_range(0x0000, 0x0300),
+
+        # Optional variables
+        cv.Optional(CONF_MAX_AGE): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_POLL_PERIODS): POLL_PERIODS_SCHEMA,
+    })
+)
+
+# Diagnostic binary sensor, which is on as long as an entity exceeds its maximum age.
+SLA_SCHEMA = binary_sensor.binary_sensor_schema(
+    ivt_rego6xx_sla_binary_sensor,
+    icon="mdi:timer-alert-outline",
+    device_class=DEVICE_CLASS_PROBLEM,
+    entity_category=ENTITY_CATEGORY_DIAGNOSTIC
+).extend(
+    cv.Schema({
+        cv.GenerateID(): cv.declare_id(ivt_rego6xx_sla_binary_sensor),
+
+        # Mandatory variables
+        cv.Required(CONF_IVT_REGO6XX_CTRL_ID): cv.use_id(ivt_rego6xx_ctrl_ns.IVTRego6xxCtrl),
     })
 )
 
+# The configuration schema is automatically loaded by the ESPHome core and used to validate
+# the provided configuration. See https://esphome.io/guides/contributing#config-validation
+CONFIG_SCHEMA = cv.typed_schema(
+    {
+        TYPE_REGISTER: REGISTER_SCHEMA,
+        TYPE_SLA: SLA_SCHEMA
+    },
+    default_type=TYPE_REGISTER
+)
+
 ################################################################################
 # Functions
 ################################################################################
@@ -72,18 +112,34 @@ async def to_code(config: dict) -> None:
     Args:
         config (dict): Configuration
     """
-    # Create a new variable for the sensor.
-    var = cg.new_Pvariable(config[CONF_ID],
-                           config[CONF_IVT_REGO6XX_CMD],
-                           config[CONF_IVT_REGO6XX_ADDR])
-    await binary_sensor.register_binary_sensor(var, config)
+    ivt_rego6xx_ctrl = await cg.get_variable(config[CONF_IVT_REGO6XX_CTRL_ID])
 
-    if CONF_STATE_CLASS in config:
-        cg.add(var.set_state_class(config[CONF_STATE_CLASS]))
+    if TYPE_SLA == config[CONF_TYPE]:
+        # Create a new variable for the service level binary sensor.
+        var = cg.new_Pvariable(config[CONF_ID])
+        await binary_sensor.register_binary_sensor(var, config)
 
-    # Register sensor at the IVT Rego6xx control component.
-    ivt_rego6xx_ctrl = await cg.get_variable(config[CONF_IVT_REGO6XX_CTRL_ID])
-    cg.add(ivt_rego6xx_ctrl.registerBinarySensor(var))
+        # Register service level binary sensor at the IVT Rego6xx control component.
+        cg.add(ivt_rego6xx_ctrl.registerSlaBinarySensor(var))
+
+    else:
+        # Create a new variable for the sensor.
+        var = cg.new_Pvariable(config[CONF_ID],
+                               config[CONF_IVT_REGO6XX_CMD],
+                               config[CONF_IVT_REGO6XX_ADDR])
+        await binary_sensor.register_binary_sensor(var, config)
+
+        if CONF_STATE_CLASS in config:
+            cg.add(var.set_state_class(config[CONF_STATE_CLASS]))
+
+        # Register sensor at the IVT Rego6xx control component.
+        cg.add(ivt_rego6xx_ctrl.registerBinarySensor(var))
+
+        if CONF_MAX_AGE in config:
+            cg.add(ivt_rego6xx_ctrl.setMaxAge(var, config[CONF_MAX_AGE].total_milliseconds))
+
+        for profile, period in config.get(CONF_POLL_PERIODS, {}).items():
+            cg.add(ivt_rego6xx_ctrl.setPollPeriod(var, POLLING_PROFILES[profile], period.total_milliseconds))
 
 ################################################################################
 # Main
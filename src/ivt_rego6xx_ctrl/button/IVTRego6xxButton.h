@@ -44,6 +44,7 @@
  *****************************************************************************/
 #include <Arduino.h>
 #include "esphome/components/button/button.h"
+#include "SimpleTimer.hpp"
 
 /******************************************************************************
  * Macros
@@ -79,7 +80,8 @@ public:
         m_cmdId(cmdId),
         m_addr(addr),
         m_value(value),
-        m_isPressed(false)
+        m_isPressed(false),
+        m_pressTimestamp(0U)
     {
     }
 
@@ -135,12 +137,23 @@ public:
         return isPressed;
     }
 
+    /**
+     * Get the time of the last button press.
+     *
+     * @return Timestamp in ms
+     */
+    uint32_t getPressTimestamp() const
+    {
+        return m_pressTimestamp;
+    }
+
 private:
 
-    uint8_t  m_cmdId;     /**< Command id to send to the heatpump. */
-    uint16_t m_addr;      /**< Address to read by the command. */
-    uint32_t m_value;     /**< Value to write by the command. */
-    bool     m_isPressed; /**< Is the button pressed? */
+    uint8_t  m_cmdId;          /**< Command id to send to the heatpump. */
+    uint16_t m_addr;           /**< Address to read by the command. */
+    uint32_t m_value;          /**< Value to write by the command. */
+    bool     m_isPressed;      /**< Is the button pressed? */
+    uint32_t m_pressTimestamp; /**< Timestamp of the last button press in ms. */
 
     /** No default constructor. */
     IVTRego6xxButton();
@@ -156,7 +169,8 @@ private:
      */
     void press_action() final
     {
-        m_isPressed = true;
+        m_isPressed      = true;
+        m_pressTimestamp = SimpleTimer::now();
     }
 };
 
@@ -44,6 +44,7 @@
  *****************************************************************************/
 #include <Arduino.h>
 #include "esphome/components/number/number.h"
+#include "SimpleTimer.hpp"
 
 /******************************************************************************
  * Macros
@@ -80,7 +81,8 @@ public:
         m_writeCmdId(writeCmdId),
         m_addr(addr),
         m_value(0.0F),
-        m_isUpdateRequested(false)
+        m_isUpdateRequested(false),
+        m_updateTimestamp(0U)
     {
     }
 
@@ -131,6 +133,16 @@ public:
         return m_isUpdateRequested;
     }
 
+    /**
+     * Get the time of the last update request.
+     *
+     * @return Timestamp in ms
+     */
+    uint32_t getUpdateTimestamp() const
+    {
+        return m_updateTimestamp;
+    }
+
     /**
      * Get the value to write by the command.
      *
@@ -150,6 +162,7 @@ private:
     uint16_t m_addr;              /**< Address to read by the command. */
     float    m_value;             /**< Value to write by the command. */
     bool     m_isUpdateRequested; /**< Flag to indicate whether a number update is requested. */
+    uint32_t m_updateTimestamp;   /**< Timestamp of the last update request in ms. */
 
     /** No default constructor. */
     IVTRego6xxNumber();
@@ -169,6 +182,7 @@ private:
     {
         m_value             = value;
         m_isUpdateRequested = true;
+        m_updateTimestamp   = SimpleTimer::now();
     }
 };
 
@@ -28,7 +28,7 @@ import esphome.codegen as cg  # Code generation API
 import esphome.config_validation as cv  # Configuration validation API
 from esphome.components import number  # Number
 from esphome.const import CONF_ID, CONF_UNIT_OF_MEASUREMENT, CONF_STATE_CLASS
-from .. import ivt_rego6xx_ctrl_ns  # IVT Rego6xx control component namespace
+from .. import ivt_rego6xx_ctrl_ns, POLL_PERIODS_SCHEMA, POLLING_PROFILES  # IVT Rego6xx control component namespace
 
 ################################################################################
 # Variables
@@ -46,6 +46,8 @@ CONF_IVT_REGO6XX_CTRL_ID = "ivt_rego6xx_ctrl_id"
 CONF_IVT_REGO6XX_CMD_READ = "ivt_rego6xx_ctrl_cmd_read"
 CONF_IVT_REGO6XX_CMD_WRITE = "ivt_rego6xx_ctrl_cmd_write"
 CONF_IVT_REGO6XX_ADDR = "ivt_rego6xx_ctrl_addr"
+CONF_MAX_AGE = "max_age"
+CONF_POLL_PERIODS = "poll_periods"
 CONF_IVT_REGO6XX_MIN_VALUE = "ivt_rego6xx_ctrl_min_value"
 CONF_IVT_REGO6XX_MAX_VALUE = "ivt_rego6xx_ctrl_max_value"
 CONF_IVT_REGO6XX_STEP = "ivt_rego6xx_ctrl_step"
@@ -71,6 +73,10 @@ CONFIG_SCHEMA = number.number_schema(ivt_rego6xx_number).extend(
         cv.Required(CONF_IVT_REGO6XX_CMD_READ): cv.hex_int_range(0x00, 0x7F),
         cv.Required(CONF_IVT_REGO6XX_CMD_WRITE): cv.hex_int_range(0x00, 0x7F),
         cv.Required(CONF_IVT_REGO6XX_ADDR): cv.hex_int_range(0x0000, 0x0300),
+
+        # Optional variables
+        cv.Optional(CONF_MAX_AGE): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_POLL_PERIODS): POLL_PERIODS_SCHEMA,
     })
 )
 
@@ -110,6 +116,12 @@ async def to_code(config: dict) -> None:
     ivt_rego6xx_ctrl = await cg.get_variable(config[CONF_IVT_REGO6XX_CTRL_ID])
     cg.add(ivt_rego6xx_ctrl.registerNumber(var))
 
+    if CONF_MAX_AGE in config:
+        cg.add(ivt_rego6xx_ctrl.setMaxAge(var, config[CONF_MAX_AGE].total_milliseconds))
+
+    for profile, period in config.get(CONF_POLL_PERIODS, {}).items():
+        cg.add(ivt_rego6xx_ctrl.setPollPeriod(var, POLLING_PROFILES[profile], period.total_milliseconds))
+
 ################################################################################
 # Main
 ################################################################################
@@ -0,0 +1,150 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  IVT rego6xx controller user action latency sensor.
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <Arduino.h>
+#include "esphome/components/sensor/sensor.h"
+#include "../IVTRego6xxActionLatency.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * IVT Rego6xx diagnostic sensor for ESPHome, which provides a statistic
+ * of a stage of the user action latency in ms.
+ */
+class IVTRego6xxActionLatencySensor : public sensor::Sensor
+{
+public:
+
+    /** Percentile, which stands for the maximum. */
+    static const uint8_t PERCENTILE_MAX = 100U;
+
+    /**
+     * Constructs the IVT rego6xx user action latency sensor.
+     *
+     * @param[in] action        Type of user action
+     * @param[in] stage         Stage of the user action
+     * @param[in] percentile    Percentile in %, 100 provides the maximum.
+     */
+    IVTRego6xxActionLatencySensor(IVTRego6xxActionLatency::Action action, IVTRego6xxActionLatency::Stage stage, uint8_t percentile) :
+        m_action(action),
+        m_stage(stage),
+        m_percentile(percentile)
+    {
+    }
+
+    /**
+     * Destroys the IVT rego6xx user action latency sensor.
+     */
+    ~IVTRego6xxActionLatencySensor()
+    {
+    }
+
+    /**
+     * Get the type of user action.
+     *
+     * @return The type of user action
+     */
+    IVTRego6xxActionLatency::Action getAction() const
+    {
+        return m_action;
+    }
+
+    /**
+     * Get the stage of the user action.
+     *
+     * @return The stage
+     */
+    IVTRego6xxActionLatency::Stage getStage() const
+    {
+        return m_stage;
+    }
+
+    /**
+     * Get the percentile.
+     *
+     * @return The percentile in %, 100 stands for the maximum.
+     */
+    uint8_t getPercentile() const
+    {
+        return m_percentile;
+    }
+
+private:
+
+    IVTRego6xxActionLatency::Action m_action;     /**< Type of user action */
+    IVTRego6xxActionLatency::Stage  m_stage;      /**< Stage of the user action */
+    uint8_t                         m_percentile; /**< Percentile in %, 100 stands for the maximum. */
+
+    /** No default constructor. */
+    IVTRego6xxActionLatencySensor();
+    /** No copy constructor. */
+    IVTRego6xxActionLatencySensor(const IVTRego6xxActionLatencySensor& other)            = delete;
+    /** No assignment operator. */
+    IVTRego6xxActionLatencySensor& operator=(const IVTRego6xxActionLatencySensor& other) = delete;
+    /** No move constructor. */
+    IVTRego6xxActionLatencySensor(IVTRego6xxActionLatencySensor&& other)                 = delete;
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
@@ -0,0 +1,134 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  IVT rego6xx controller aggregate sensor.
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <Arduino.h>
+#include "esphome/components/sensor/sensor.h"
+#include "../IVTRego6xxAggregation.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * IVT Rego6xx sensor for ESPHome, which provides a statistic of the values
+ * of another sensor over a window.
+ */
+class IVTRego6xxAggregateSensor : public sensor::Sensor
+{
+public:
+
+    /**
+     * Constructs the IVT rego6xx aggregate sensor.
+     *
+     * @param[in] source    The sensor, whose values are aggregated.
+     * @param[in] statistic The provided statistic.
+     */
+    IVTRego6xxAggregateSensor(const sensor::Sensor* source, IVTRego6xxAggregation::Statistic statistic) :
+        m_source(source),
+        m_statistic(statistic)
+    {
+    }
+
+    /**
+     * Destroys the IVT rego6xx aggregate sensor.
+     */
+    ~IVTRego6xxAggregateSensor()
+    {
+    }
+
+    /**
+     * Get the sensor, whose values are aggregated.
+     *
+     * @return Source sensor
+     */
+    const sensor::Sensor* getSource() const
+    {
+        return m_source;
+    }
+
+    /**
+     * Get the provided statistic.
+     *
+     * @return The provided statistic
+     */
+    IVTRego6xxAggregation::Statistic getStatistic() const
+    {
+        return m_statistic;
+    }
+
+private:
+
+    const sensor::Sensor*            m_source;    /**< The sensor, whose values are aggregated. */
+    IVTRego6xxAggregation::Statistic m_statistic; /**< The provided statistic. */
+
+    /** No default constructor. */
+    IVTRego6xxAggregateSensor();
+    /** No copy constructor. */
+    IVTRego6xxAggregateSensor(const IVTRego6xxAggregateSensor& other)            = delete;
+    /** No assignment operator. */
+    IVTRego6xxAggregateSensor& operator=(const IVTRego6xxAggregateSensor& other) = delete;
+    /** No move constructor. */
+    IVTRego6xxAggregateSensor(IVTRego6xxAggregateSensor&& other)                 = delete;
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
@@ -0,0 +1,136 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  IVT rego6xx controller bus health sensor.
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <Arduino.h>
+#include "esphome/components/sensor/sensor.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * IVT Rego6xx diagnostic sensor for ESPHome, which provides a health metric
+ * of the bus to the heatpump.
+ */
+class IVTRego6xxBusSensor : public sensor::Sensor
+{
+public:
+
+    /**
+     * The provided metric.
+     */
+    enum Metric
+    {
+        METRIC_REQUESTS = 0U,    /**< Number of requests, which were answered or timed out. */
+        METRIC_TIMEOUTS,         /**< Number of response timeouts. */
+        METRIC_INVALID,          /**< Number of invalid responses. */
+        METRIC_WRONG_DEST,       /**< Number of responses with wrong destination. */
+        METRIC_TX_FRAME_RATE,    /**< Sent frames per second. */
+        METRIC_RX_FRAME_RATE,    /**< Received frames per second. */
+        METRIC_TX_BYTE_RATE,     /**< Sent bytes per second. */
+        METRIC_RX_BYTE_RATE,     /**< Received bytes per second. */
+        METRIC_UTILISATION       /**< Bus utilisation in %. */
+    };
+
+    /**
+     * Constructs the IVT rego6xx bus health sensor.
+     *
+     * @param[in] metric    The provided metric.
+     */
+    IVTRego6xxBusSensor(Metric metric) :
+        m_metric(metric)
+    {
+    }
+
+    /**
+     * Destroys the IVT rego6xx bus health sensor.
+     */
+    ~IVTRego6xxBusSensor()
+    {
+    }
+
+    /**
+     * Get the provided metric.
+     *
+     * @return The provided metric
+     */
+    Metric getMetric() const
+    {
+        return m_metric;
+    }
+
+private:
+
+    Metric m_metric; /**< The provided metric. */
+
+    /** No default constructor. */
+    IVTRego6xxBusSensor();
+    /** No copy constructor. */
+    IVTRego6xxBusSensor(const IVTRego6xxBusSensor& other)            = delete;
+    /** No assignment operator. */
+    IVTRego6xxBusSensor& operator=(const IVTRego6xxBusSensor& other) = delete;
+    /** No move constructor. */
+    IVTRego6xxBusSensor(IVTRego6xxBusSensor&& other)                 = delete;
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
@@ -0,0 +1,134 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  IVT rego6xx controller delta sensor.
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <Arduino.h>
+#include "esphome/components/sensor/sensor.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * IVT Rego6xx sensor for ESPHome, which provides the difference of two
+ * sensors of the same sampling group. It is published after every
+ * coherent read of the group.
+ */
+class IVTRego6xxDeltaSensor : public sensor::Sensor
+{
+public:
+
+    /**
+     * Constructs the IVT rego6xx delta sensor.
+     *
+     * @param[in] minuend       The sensor, which value is subtracted from.
+     * @param[in] subtrahend    The sensor, which value is subtracted.
+     */
+    IVTRego6xxDeltaSensor(const sensor::Sensor* minuend, const sensor::Sensor* subtrahend) :
+        m_minuend(minuend),
+        m_subtrahend(subtrahend)
+    {
+    }
+
+    /**
+     * Destroys the IVT rego6xx delta sensor.
+     */
+    ~IVTRego6xxDeltaSensor()
+    {
+    }
+
+    /**
+     * Get the sensor, which value is subtracted from.
+     *
+     * @return Minuend sensor
+     */
+    const sensor::Sensor* getMinuend() const
+    {
+        return m_minuend;
+    }
+
+    /**
+     * Get the sensor, which value is subtracted.
+     *
+     * @return Subtrahend sensor
+     */
+    const sensor::Sensor* getSubtrahend() const
+    {
+        return m_subtrahend;
+    }
+
+private:
+
+    const sensor::Sensor* m_minuend;    /**< The sensor, which value is subtracted from. */
+    const sensor::Sensor* m_subtrahend; /**< The sensor, which value is subtracted. */
+
+    /** No default constructor. */
+    IVTRego6xxDeltaSensor();
+    /** No copy constructor. */
+    IVTRego6xxDeltaSensor(const IVTRego6xxDeltaSensor& other)            = delete;
+    /** No assignment operator. */
+    IVTRego6xxDeltaSensor& operator=(const IVTRego6xxDeltaSensor& other) = delete;
+    /** No move constructor. */
+    IVTRego6xxDeltaSensor(IVTRego6xxDeltaSensor&& other)                 = delete;
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
@@ -0,0 +1,121 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  IVT rego6xx controller derived metric sensor.
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <Arduino.h>
+#include "esphome/components/sensor/sensor.h"
+#include "../IVTRego6xxDerivedMetrics.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * IVT Rego6xx sensor for ESPHome, which provides a metric, which is derived
+ * on the device from the read entity values.
+ */
+class IVTRego6xxDerivedSensor : public sensor::Sensor
+{
+public:
+
+    /**
+     * Constructs the IVT rego6xx derived metric sensor.
+     *
+     * @param[in] metric    The provided metric.
+     */
+    IVTRego6xxDerivedSensor(IVTRego6xxDerivedMetrics::Metric metric) :
+        m_metric(metric)
+    {
+    }
+
+    /**
+     * Destroys the IVT rego6xx derived metric sensor.
+     */
+    ~IVTRego6xxDerivedSensor()
+    {
+    }
+
+    /**
+     * Get the provided metric.
+     *
+     * @return The provided metric
+     */
+    IVTRego6xxDerivedMetrics::Metric getMetric() const
+    {
+        return m_metric;
+    }
+
+private:
+
+    IVTRego6xxDerivedMetrics::Metric m_metric; /**< The provided metric. */
+
+    /** No default constructor. */
+    IVTRego6xxDerivedSensor();
+    /** No copy constructor. */
+    IVTRego6xxDerivedSensor(const IVTRego6xxDerivedSensor& other)            = delete;
+    /** No assignment operator. */
+    IVTRego6xxDerivedSensor& operator=(const IVTRego6xxDerivedSensor& other) = delete;
+    /** No move constructor. */
+    IVTRego6xxDerivedSensor(IVTRego6xxDerivedSensor&& other)                 = delete;
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
@@ -0,0 +1,158 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  IVT rego6xx controller latency sensor.
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <Arduino.h>
+#include "esphome/components/sensor/sensor.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * IVT Rego6xx diagnostic sensor for ESPHome, which provides a statistic
+ * of the response latency of a command in ms.
+ */
+class IVTRego6xxLatencySensor : public sensor::Sensor
+{
+public:
+
+    /**
+     * The measured stage of the response.
+     */
+    enum Stage
+    {
+        STAGE_FIRST_BYTE = 0U, /**< Until the first response byte is received. */
+        STAGE_COMPLETE         /**< Until the response is completely received. */
+    };
+
+    /** Percentile, which stands for the maximum. */
+    static const uint8_t PERCENTILE_MAX = 100U;
+
+    /**
+     * Constructs the IVT rego6xx latency sensor.
+     *
+     * @param[in] cmdId         Command id, whose latency is provided.
+     * @param[in] stage         The measured stage of the response.
+     * @param[in] percentile    Percentile in %, 100 provides the maximum.
+     */
+    IVTRego6xxLatencySensor(uint8_t cmdId, Stage stage, uint8_t percentile) :
+        m_cmdId(cmdId),
+        m_stage(stage),
+        m_percentile(percentile)
+    {
+    }
+
+    /**
+     * Destroys the IVT rego6xx latency sensor.
+     */
+    ~IVTRego6xxLatencySensor()
+    {
+    }
+
+    /**
+     * Get the command id, whose latency is provided.
+     *
+     * @return The command id
+     */
+    uint8_t getCmdId() const
+    {
+        return m_cmdId;
+    }
+
+    /**
+     * Get the measured stage of the response.
+     *
+     * @return The measured stage
+     */
+    Stage getStage() const
+    {
+        return m_stage;
+    }
+
+    /**
+     * Get the percentile.
+     *
+     * @return The percentile in %, 100 stands for the maximum.
+     */
+    uint8_t getPercentile() const
+    {
+        return m_percentile;
+    }
+
+private:
+
+    uint8_t m_cmdId;      /**< Command id, whose latency is provided. */
+    Stage   m_stage;      /**< The measured stage of the response. */
+    uint8_t m_percentile; /**< Percentile in %, 100 stands for the maximum. */
+
+    /** No default constructor. */
+    IVTRego6xxLatencySensor();
+    /** No copy constructor. */
+    IVTRego6xxLatencySensor(const IVTRego6xxLatencySensor& other)            = delete;
+    /** No assignment operator. */
+    IVTRego6xxLatencySensor& operator=(const IVTRego6xxLatencySensor& other) = delete;
+    /** No move constructor. */
+    IVTRego6xxLatencySensor(IVTRego6xxLatencySensor&& other)                 = delete;
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
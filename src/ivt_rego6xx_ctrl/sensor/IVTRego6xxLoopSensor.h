@@ -0,0 +1,133 @@
+/* MIT License
+ *
+ * Copyright (c) 2026 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  IVT rego6xx controller main loop cost sensor.
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup APP_LAYER
+ *
+ * @{
+ */
+
+#pragma once
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <Arduino.h>
+#include "esphome/components/sensor/sensor.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** ESPHome namspace */
+namespace esphome
+{
+
+/** IVT rego6xx controller namespace */
+namespace ivt_rego6xx_ctrl
+{
+
+/**
+ * IVT Rego6xx diagnostic sensor for ESPHome, which provides a metric of the
+ * CPU time, which the component takes from the ESPHome main loop.
+ */
+class IVTRego6xxLoopSensor : public sensor::Sensor
+{
+public:
+
+    /**
+     * The provided metric.
+     */
+    enum Metric
+    {
+        METRIC_MIN = 0U,                /**< Minimum duration of a loop call in us. */
+        METRIC_AVG,                     /**< Average duration of a loop call in us. */
+        METRIC_MAX,                     /**< Maximum duration of a loop call in us. */
+        METRIC_P50,                     /**< Median duration of a loop call in us. */
+        METRIC_P95,                     /**< 95th percentile of the duration of a loop call in us. */
+        METRIC_LOOPS_PER_TRANSACTION    /**< Number of loop calls per finished request. */
+    };
+
+    /**
+     * Constructs the IVT rego6xx main loop cost sensor.
+     *
+     * @param[in] metric    The provided metric.
+     */
+    IVTRego6xxLoopSensor(Metric metric) :
+        m_metric(metric)
+    {
+    }
+
+    /**
+     * Destroys the IVT rego6xx main loop cost sensor.
+     */
+    ~IVTRego6xxLoopSensor()
+    {
+    }
+
+    /**
+     * Get the provided metric.
+     *
+     * @return The provided metric
+     */
+    Metric getMetric() const
+    {
+        return m_metric;
+    }
+
+private:
+
+    Metric m_metric; /**< The provided metric. */
+
+    /** No default constructor. */
+    IVTRego6xxLoopSensor();
+    /** No copy constructor. */
+    IVTRego6xxLoopSensor(const IVTRego6xxLoopSensor& other)            = delete;
+    /** No assignment operator. */
+    IVTRego6xxLoopSensor& operator=(const IVTRego6xxLoopSensor& other) = delete;
+    /** No move constructor. */
+    IVTRego6xxLoopSensor(IVTRego6xxLoopSensor&& other)                 = delete;
+};
+
+} /* namespace ivt_rego6xx_ctrl */
+} /* namespace esphome */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/** @} */
@@ -27,8 +27,10 @@
 import esphome.codegen as cg # Code generation API
 import esphome.config_validation as cv # Configuration validation API
 from esphome.components import sensor # Sensor component
-from esphome.const import CONF_ID, CONF_UNIT_OF_MEASUREMENT, CONF_STATE_CLASS
-from .. import ivt_rego6xx_ctrl_ns # IVT Rego6xx control component namespace
+from esphome.const import CONF_ID, CONF_UNIT_OF_MEASUREMENT, CONF_STATE_CLASS, CONF_TYPE, CONF_ACCURACY_DECIMALS
+from esphome.const import ENTITY_CATEGORY_DIAGNOSTIC, STATE_CLASS_MEASUREMENT, STATE_CLASS_TOTAL_INCREASING
+from esphome.const import UNIT_CELSIUS, UNIT_HOUR, UNIT_KILOWATT_HOURS, UNIT_MILLISECOND, UNIT_MINUTE, UNIT_PERCENT
+from .. import ivt_rego6xx_ctrl_ns, POLL_PERIODS_SCHEMA, POLLING_PROFILES # IVT Rego6xx control component namespace
 
 ################################################################################
 # Variables
@@ -41,14 +43,216 @@ ivt_rego6xx_sensor = ivt_rego6xx_ctrl_ns.class_(
     "IVTRego6xxSensor", sensor.Sensor
 )
 
+# The class of the latency sensor.
+ivt_rego6xx_latency_sensor = ivt_rego6xx_ctrl_ns.class_(
+    "IVTRego6xxLatencySensor", sensor.Sensor
+)
+
+# Measured stage of the response
+LatencyStage = ivt_rego6xx_latency_sensor.enum("Stage")
+
+# The class of the user action latency sensor.
+ivt_rego6xx_action_latency_sensor = ivt_rego6xx_ctrl_ns.class_(
+    "IVTRego6xxActionLatencySensor", sensor.Sensor
+)
+
+# Type and stage of a user action
+ivt_rego6xx_action_latency = ivt_rego6xx_ctrl_ns.class_("IVTRego6xxActionLatency")
+ActionType = ivt_rego6xx_action_latency.enum("Action")
+ActionStage = ivt_rego6xx_action_latency.enum("Stage")
+
+# The class of the bus health sensor.
+ivt_rego6xx_bus_sensor = ivt_rego6xx_ctrl_ns.class_(
+    "IVTRego6xxBusSensor", sensor.Sensor
+)
+
+# Provided metric of the bus health
+BusMetric = ivt_rego6xx_bus_sensor.enum("Metric")
+
+# The class of the main loop cost sensor.
+ivt_rego6xx_loop_sensor = ivt_rego6xx_ctrl_ns.class_(
+    "IVTRego6xxLoopSensor", sensor.Sensor
+)
+
+# Provided metric of the main loop cost
+LoopMetric = ivt_rego6xx_loop_sensor.enum("Metric")
+
+# The class of the derived metric sensor.
+ivt_rego6xx_derived_sensor = ivt_rego6xx_ctrl_ns.class_(
+    "IVTRego6xxDerivedSensor", sensor.Sensor
+)
+
+# Provided derived metric
+DerivedMetric = ivt_rego6xx_ctrl_ns.class_("IVTRego6xxDerivedMetrics").enum("Metric")
+
+# The class of the aggregate sensor.
+ivt_rego6xx_aggregate_sensor = ivt_rego6xx_ctrl_ns.class_(
+    "IVTRego6xxAggregateSensor", sensor.Sensor
+)
+
+# Provided statistic of a window
+AggregateStatistic = ivt_rego6xx_ctrl_ns.class_("IVTRego6xxAggregation").enum("Statistic")
+
+# The class of the delta sensor.
+ivt_rego6xx_delta_sensor = ivt_rego6xx_ctrl_ns.class_(
+    "IVTRego6xxDeltaSensor", sensor.Sensor
+)
+
 # Sensor variables
 CONF_IVT_REGO6XX_CTRL_ID = "ivt_rego6xx_ctrl_id"
 CONF_IVT_REGO6XX_CMD = "ivt_rego6xx_ctrl_cmd"
 CONF_IVT_REGO6XX_ADDR = "ivt_rego6xx_ctrl_addr"
+CONF_MAX_AGE = "max_age"
+CONF_POLL_PERIODS = "poll_periods"
+CONF_ADAPTIVE_SAMPLING = "adaptive_sampling"
+CONF_MIN_PERIOD = "min_period"
+CONF_MAX_PERIOD = "max_period"
+CONF_TOLERANCE = "tolerance"
+CONF_AGGREGATION = "aggregation"
+CONF_WINDOW = "window"
+CONF_PUBLISH_SAMPLES = "publish_samples"
+CONF_HISTORY_SIZE = "history_size"
 
-# The configuration schema is automatically loaded by the ESPHome core and used to validate
-# the provided configuration. See https://esphome.io/guides/contributing#config-validation
-CONFIG_SCHEMA = sensor.sensor_schema(ivt_rego6xx_sensor).extend(
+# Latency sensor variables
+CONF_STAGE = "stage"
+CONF_STATISTIC = "statistic"
+
+# User action latency sensor variables
+CONF_ACTION = "action"
+
+# Bus health sensor variables
+CONF_METRIC = "metric"
+
+# Aggregate sensor variables
+CONF_SENSOR = "sensor"
+
+# Delta sensor variables
+CONF_MINUEND = "minuend"
+CONF_SUBTRAHEND = "subtrahend"
+
+# Sensor types
+TYPE_REGISTER = "register"
+TYPE_LATENCY = "latency"
+TYPE_BUS = "bus"
+TYPE_ACTION_LATENCY = "action_latency"
+TYPE_LOOP = "loop"
+TYPE_DELTA = "delta"
+TYPE_DERIVED = "derived"
+TYPE_AGGREGATE = "aggregate"
+
+# Commands, whose latencies are measured.
+LATENCY_CMDS = [0x00, 0x01, 0x02, 0x03, 0x20, 0x40, 0x7F]
+
+# Measured stages of the response
+LATENCY_STAGES = {
+    "first_byte": LatencyStage.STAGE_FIRST_BYTE,
+    "complete": LatencyStage.STAGE_COMPLETE
+}
+
+# Statistics of the latency, mapped to the percentile. 100 stands for the maximum.
+LATENCY_STATISTICS = {
+    "p50": 50,
+    "p95": 95,
+    "max": 100
+}
+
+# Types of user actions
+ACTION_TYPES = {
+    "button": ActionType.ACTION_BUTTON,
+    "number": ActionType.ACTION_NUMBER
+}
+
+# Stages of a user action
+ACTION_STAGES = {
+    "queued": ActionStage.STAGE_QUEUED,
+    "wire": ActionStage.STAGE_WIRE,
+    "confirm": ActionStage.STAGE_CONFIRM,
+    "refresh": ActionStage.STAGE_REFRESH,
+    "total": ActionStage.STAGE_TOTAL
+}
+
+# Metrics of the bus health, mapped to the metric, unit, state class and accuracy.
+BUS_METRICS = {
+    "requests": (BusMetric.METRIC_REQUESTS, "", STATE_CLASS_TOTAL_INCREASING, 0),
+    "timeouts": (BusMetric.METRIC_TIMEOUTS, "", STATE_CLASS_TOTAL_INCREASING, 0),
+    "invalid_responses": (BusMetric.METRIC_INVALID, "", STATE_CLASS_TOTAL_INCREASING, 0),
+    "wrong_destinations": (BusMetric.METRIC_WRONG_DEST, "", STATE_CLASS_TOTAL_INCREASING, 0),
+    "tx_frame_rate": (BusMetric.METRIC_TX_FRAME_RATE, "frames/s", STATE_CLASS_MEASUREMENT, 2),
+    "rx_frame_rate": (BusMetric.METRIC_RX_FRAME_RATE, "frames/s", STATE_CLASS_MEASUREMENT, 2),
+    "tx_byte_rate": (BusMetric.METRIC_TX_BYTE_RATE, "B/s", STATE_CLASS_MEASUREMENT, 1),
+    "rx_byte_rate": (BusMetric.METRIC_RX_BYTE_RATE, "B/s", STATE_CLASS_MEASUREMENT, 1),
+    "utilisation": (BusMetric.METRIC_UTILISATION, UNIT_PERCENT, STATE_CLASS_MEASUREMENT, 1)
+}
+
+# Metrics of the main loop cost, mapped to the metric, unit and accuracy.
+LOOP_METRICS = {
+    "min": (LoopMetric.METRIC_MIN, "µs", 0),
+    "avg": (LoopMetric.METRIC_AVG, "µs", 1),
+    "max": (LoopMetric.METRIC_MAX, "µs", 0),
+    "p50": (LoopMetric.METRIC_P50, "µs", 0),
+    "p95": (LoopMetric.METRIC_P95, "µs", 0),
+    "loops_per_transaction": (LoopMetric.METRIC_LOOPS_PER_TRANSACTION, "", 1)
+}
+
+# Statistics of an aggregation window
+AGGREGATE_STATISTICS = {
+    "min": AggregateStatistic.STATISTIC_MIN,
+    "max": AggregateStatistic.STATISTIC_MAX,
+    "mean": AggregateStatistic.STATISTIC_MEAN,
+    "last": AggregateStatistic.STATISTIC_LAST,
+    "count": AggregateStatistic.STATISTIC_COUNT
+}
+
+# Derived metrics, mapped to the metric, unit, state class and accuracy.
+DERIVED_METRICS = {
+    "compressor_duty_cycle": (DerivedMetric.METRIC_COMPRESSOR_DUTY_CYCLE, UNIT_PERCENT, STATE_CLASS_MEASUREMENT, 1),
+    "compressor_starts_per_hour": (DerivedMetric.METRIC_COMPRESSOR_STARTS_PER_HOUR, "starts/h", STATE_CLASS_MEASUREMENT, 0),
+    "compressor_starts": (DerivedMetric.METRIC_COMPRESSOR_STARTS, "", STATE_CLASS_TOTAL_INCREASING, 0),
+    "compressor_on_time": (DerivedMetric.METRIC_COMPRESSOR_ON_TIME, UNIT_HOUR, STATE_CLASS_TOTAL_INCREASING, 2),
+    "add_heat_3kw_on_time": (DerivedMetric.METRIC_ADD_HEAT_3KW_ON_TIME, UNIT_HOUR, STATE_CLASS_TOTAL_INCREASING, 2),
+    "add_heat_6kw_on_time": (DerivedMetric.METRIC_ADD_HEAT_6KW_ON_TIME, UNIT_HOUR, STATE_CLASS_TOTAL_INCREASING, 2),
+    "add_heat_energy": (DerivedMetric.METRIC_ADD_HEAT_ENERGY, UNIT_KILOWATT_HOURS, STATE_CLASS_TOTAL_INCREASING, 2),
+    "hot_water_cycle_duration": (DerivedMetric.METRIC_HOT_WATER_CYCLE_DURATION, UNIT_MINUTE, STATE_CLASS_MEASUREMENT, 1),
+    "hot_water_cycles": (DerivedMetric.METRIC_HOT_WATER_CYCLES, "", STATE_CLASS_TOTAL_INCREASING, 0),
+    "heat_curve_deviation": (DerivedMetric.METRIC_HEAT_CURVE_DEVIATION, UNIT_CELSIUS, STATE_CLASS_MEASUREMENT, 1)
+}
+
+def validate_adaptive_sampling(config: dict) -> dict:
+    """
+    Validate the bounds of the adaptive sampling.
+
+    Args:
+        config (dict): Adaptive sampling configuration
+
+    Returns:
+        dict: Validated configuration
+    """
+    if config[CONF_MAX_PERIOD] < config[CONF_MIN_PERIOD]:
+        raise cv.Invalid(f"{CONF_MIN_PERIOD} must not be greater than {CONF_MAX_PERIOD}")
+
+    return config
+
+# Read period of a sensor, which follows the rate of change of its value.
+ADAPTIVE_SAMPLING_SCHEMA = cv.All(
+    cv.Schema({
+        cv.Optional(CONF_MIN_PERIOD, default="30s"): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_MAX_PERIOD, default="10min"): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_TOLERANCE, default=0.2): cv.positive_not_null_float
+    }),
+    validate_adaptive_sampling
+)
+
+# Windowed aggregation of the values of a sensor.
+AGGREGATION_SCHEMA = cv.Schema({
+    cv.Optional(CONF_WINDOW, default="1min"): cv.All(
+        cv.positive_time_period_milliseconds,
+        cv.Range(min=cv.TimePeriod(seconds=1))
+    ),
+    cv.Optional(CONF_PUBLISH_SAMPLES, default=True): cv.boolean
+})
+
+# Sensor, which provides the value of a heatpump register.
+REGISTER_SCHEMA = sensor.sensor_schema(ivt_rego6xx_sensor).extend(
     cv.Schema({
         cv.GenerateID(): cv.declare_id(ivt_rego6xx_sensor),
 
@@ -56,9 +260,150 @@ CONFIG_SCHEMA = sensor.sensor_schema(ivt_rego6xx_sensor).extend(
         cv.Required(CONF_IVT_REGO6XX_CTRL_ID): cv.use_id(ivt_rego6xx_ctrl_ns.IVTRego6xxCtrl),
         cv.Required(CONF_IVT_REGO6XX_CMD): cv.hex_int_range(0x00, 0x7F),
         cv.Required(CONF_IVT_REGO6XX_ADDR): cv.hex_int_range(0x0000, 0x0300),
+
+        # Optional variables
+        cv.Optional(CONF_MAX_AGE): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_POLL_PERIODS): POLL_PERIODS_SCHEMA,
+        cv.Optional(CONF_ADAPTIVE_SAMPLING): ADAPTIVE_SAMPLING_SCHEMA,
+        cv.Optional(CONF_AGGREGATION): AGGREGATION_SCHEMA,
+        cv.Optional(CONF_HISTORY_SIZE): cv.int_range(min=512, max=65536),
+    })
+)
+
+# Diagnostic sensor, which provides a statistic of the response latency of a command.
+LATENCY_SCHEMA = sensor.sensor_schema(
+    ivt_rego6xx_latency_sensor,
+    unit_of_measurement=UNIT_MILLISECOND,
+    icon="mdi:timer-outline",
+    accuracy_decimals=1,
+    state_class=STATE_CLASS_MEASUREMENT,
+    entity_category=ENTITY_CATEGORY_DIAGNOSTIC
+).extend(
+    cv.Schema({
+        cv.GenerateID(): cv.declare_id(ivt_rego6xx_latency_sensor),
+
+        # Mandatory variables
+        cv.Required(CONF_IVT_REGO6XX_CTRL_ID): cv.use_id(ivt_rego6xx_ctrl_ns.IVTRego6xxCtrl),
+        cv.Required(CONF_IVT_REGO6XX_CMD): cv.All(cv.hex_int, cv.one_of(*LATENCY_CMDS)),
+        cv.Required(CONF_STAGE): cv.enum(LATENCY_STAGES, lower=True),
+        cv.Required(CONF_STATISTIC): cv.enum(LATENCY_STATISTICS, lower=True),
     })
 )
 
+# Diagnostic sensor, which provides a statistic of a stage of the user action latency.
+ACTION_LATENCY_SCHEMA = sensor.sensor_schema(
+    ivt_rego6xx_action_latency_sensor,
+    unit_of_measurement=UNIT_MILLISECOND,
+    icon="mdi:gesture-tap-button",
+    accuracy_decimals=0,
+    state_class=STATE_CLASS_MEASUREMENT,
+    entity_category=ENTITY_CATEGORY_DIAGNOSTIC
+).extend(
+    cv.Schema({
+        cv.GenerateID(): cv.declare_id(ivt_rego6xx_action_latency_sensor),
+
+        # Mandatory variables
+        cv.Required(CONF_IVT_REGO6XX_CTRL_ID): cv.use_id(ivt_rego6xx_ctrl_ns.IVTRego6xxCtrl),
+        cv.Required(CONF_ACTION): cv.enum(ACTION_TYPES, lower=True),
+        cv.Required(CONF_STAGE): cv.enum(ACTION_STAGES, lower=True),
+        cv.Required(CONF_STATISTIC): cv.enum(LATENCY_STATISTICS, lower=True),
+    })
+)
+
+# Diagnostic sensor, which provides a health metric of the bus to the heatpump.
+BUS_SCHEMA = sensor.sensor_schema(
+    ivt_rego6xx_bus_sensor,
+    icon="mdi:swap-horizontal",
+    entity_category=ENTITY_CATEGORY_DIAGNOSTIC
+).extend(
+    cv.Schema({
+        cv.GenerateID(): cv.declare_id(ivt_rego6xx_bus_sensor),
+
+        # Mandatory variables
+        cv.Required(CONF_IVT_REGO6XX_CTRL_ID): cv.use_id(ivt_rego6xx_ctrl_ns.IVTRego6xxCtrl),
+        cv.Required(CONF_METRIC): cv.one_of(*BUS_METRICS, lower=True),
+    })
+)
+
+# Diagnostic sensor, which provides a metric of the CPU time the component takes from the main loop.
+LOOP_SCHEMA = sensor.sensor_schema(
+    ivt_rego6xx_loop_sensor,
+    icon="mdi:timer-cog-outline",
+    state_class=STATE_CLASS_MEASUREMENT,
+    entity_category=ENTITY_CATEGORY_DIAGNOSTIC
+).extend(
+    cv.Schema({
+        cv.GenerateID(): cv.declare_id(ivt_rego6xx_loop_sensor),
+
+        # Mandatory variables
+        cv.Required(CONF_IVT_REGO6XX_CTRL_ID): cv.use_id(ivt_rego6xx_ctrl_ns.IVTRego6xxCtrl),
+        cv.Required(CONF_METRIC): cv.one_of(*LOOP_METRICS, lower=True),
+    })
+)
+
+# Sensor, which provides the difference of two sensors of the same sampling group.
+DELTA_SCHEMA = sensor.sensor_schema(
+    ivt_rego6xx_delta_sensor,
+    unit_of_measurement=UNIT_CELSIUS,
+    icon="mdi:delta",
+    accuracy_decimals=1,
+    state_class=STATE_CLASS_MEASUREMENT
+).extend(
+    cv.Schema({
+        cv.GenerateID(): cv.declare_id(ivt_rego6xx_delta_sensor),
+
+        # Mandatory variables
+        cv.Required(CONF_IVT_REGO6XX_CTRL_ID): cv.use_id(ivt_rego6xx_ctrl_ns.IVTRego6xxCtrl),
+        cv.Required(CONF_MINUEND): cv.use_id(ivt_rego6xx_sensor),
+        cv.Required(CONF_SUBTRAHEND): cv.use_id(ivt_rego6xx_sensor),
+    })
+)
+
+# Sensor, which provides a metric derived on the device from the read entity values.
+DERIVED_SCHEMA = sensor.sensor_schema(
+    ivt_rego6xx_derived_sensor,
+    icon="mdi:chart-timeline-variant"
+).extend(
+    cv.Schema({
+        cv.GenerateID(): cv.declare_id(ivt_rego6xx_derived_sensor),
+
+        # Mandatory variables
+        cv.Required(CONF_IVT_REGO6XX_CTRL_ID): cv.use_id(ivt_rego6xx_ctrl_ns.IVTRego6xxCtrl),
+        cv.Required(CONF_METRIC): cv.one_of(*DERIVED_METRICS, lower=True),
+    })
+)
+
+# Sensor, which provides a statistic of the values of another sensor over a window.
+AGGREGATE_SCHEMA = sensor.sensor_schema(
+    ivt_rego6xx_aggregate_sensor,
+    state_class=STATE_CLASS_MEASUREMENT
+).extend(
+    cv.Schema({
+        cv.GenerateID(): cv.declare_id(ivt_rego6xx_aggregate_sensor),
+
+        # Mandatory variables
+        cv.Required(CONF_IVT_REGO6XX_CTRL_ID): cv.use_id(ivt_rego6xx_ctrl_ns.IVTRego6xxCtrl),
+        cv.Required(CONF_SENSOR): cv.use_id(ivt_rego6xx_sensor),
+        cv.Required(CONF_STATISTIC): cv.enum(AGGREGATE_STATISTICS, lower=True),
+    })
+)
+
+# The configuration schema is automatically loaded by the ESPHome core and used to validate
+# the provided configuration. See https://esphome.io/guides/contributing#config-validation
+CONFIG_SCHEMA = cv.typed_schema(
+    {
+        TYPE_REGISTER: REGISTER_SCHEMA,
+        TYPE_LATENCY: LATENCY_SCHEMA,
+        TYPE_BUS: BUS_SCHEMA,
+        TYPE_ACTION_LATENCY: ACTION_LATENCY_SCHEMA,
+        TYPE_LOOP: LOOP_SCHEMA,
+        TYPE_DELTA: DELTA_SCHEMA,
+        TYPE_DERIVED: DERIVED_SCHEMA,
+        TYPE_AGGREGATE: AGGREGATE_SCHEMA
+    },
+    default_type=TYPE_REGISTER
+)
+
 ################################################################################
 # Functions
 ################################################################################
@@ -72,22 +417,150 @@ async def to_code(config: dict) -> None:
     Args:
         config (dict): Configuration
     """
-    # Create a new variable for the sensor.
-    var = cg.new_Pvariable(config[CONF_ID],
-                           config[CONF_IVT_REGO6XX_CMD],
-                           config[CONF_IVT_REGO6XX_ADDR])
-    await sensor.register_sensor(var, config)
+    ivt_rego6xx_ctrl = await cg.get_variable(config[CONF_IVT_REGO6XX_CTRL_ID])
 
-    # Add the optional variables.
-    if CONF_UNIT_OF_MEASUREMENT in config:
-        cg.add(var.set_unit_of_measurement(config[CONF_UNIT_OF_MEASUREMENT]))
+    if TYPE_LATENCY == config[CONF_TYPE]:
+        # Create a new variable for the latency sensor.
+        var = cg.new_Pvariable(config[CONF_ID],
+                               config[CONF_IVT_REGO6XX_CMD],
+                               config[CONF_STAGE],
+                               config[CONF_STATISTIC])
+        await sensor.register_sensor(var, config)
 
-    if CONF_STATE_CLASS in config:
-        cg.add(var.set_state_class(config[CONF_STATE_CLASS]))
+        # Register latency sensor at the IVT Rego6xx control component.
+        cg.add(ivt_rego6xx_ctrl.registerLatencySensor(var))
 
-    # Register sensor at the IVT Rego6xx control component.
-    ivt_rego6xx_ctrl = await cg.get_variable(config[CONF_IVT_REGO6XX_CTRL_ID])
-    cg.add(ivt_rego6xx_ctrl.registerSensor(var))
+    elif TYPE_ACTION_LATENCY == config[CONF_TYPE]:
+        # Create a new variable for the user action latency sensor.
+        var = cg.new_Pvariable(config[CONF_ID],
+                               config[CONF_ACTION],
+                               config[CONF_STAGE],
+                               config[CONF_STATISTIC])
+        await sensor.register_sensor(var, config)
+
+        # Register user action latency sensor at the IVT Rego6xx control component.
+        cg.add(ivt_rego6xx_ctrl.registerActionLatencySensor(var))
+
+    elif TYPE_BUS == config[CONF_TYPE]:
+        metric, unit, state_class, accuracy = BUS_METRICS[config[CONF_METRIC]]
+
+        # Create a new variable for the bus health sensor.
+        var = cg.new_Pvariable(config[CONF_ID], metric)
+        await sensor.register_sensor(var, config)
+
+        # Defaults of the metric, unless they are configured.
+        if CONF_UNIT_OF_MEASUREMENT not in config:
+            cg.add(var.set_unit_of_measurement(unit))
+
+        if CONF_STATE_CLASS not in config:
+            cg.add(var.set_state_class(state_class))
+
+        if CONF_ACCURACY_DECIMALS not in config:
+            cg.add(var.set_accuracy_decimals(accuracy))
+
+        # Register bus health sensor at the IVT Rego6xx control component.
+        cg.add(ivt_rego6xx_ctrl.registerBusSensor(var))
+
+    elif TYPE_LOOP == config[CONF_TYPE]:
+        metric, unit, accuracy = LOOP_METRICS[config[CONF_METRIC]]
+
+        # Create a new variable for the main loop cost sensor.
+        var = cg.new_Pvariable(config[CONF_ID], metric)
+        await sensor.register_sensor(var, config)
+
+        # Defaults of the metric, unless they are configured.
+        if CONF_UNIT_OF_MEASUREMENT not in config:
+            cg.add(var.set_unit_of_measurement(unit))
+
+        if CONF_ACCURACY_DECIMALS not in config:
+            cg.add(var.set_accuracy_decimals(accuracy))
+
+        # Register main loop cost sensor at the IVT Rego6xx control component.
+        cg.add(ivt_rego6xx_ctrl.registerLoopSensor(var))
+
+    elif TYPE_DELTA == config[CONF_TYPE]:
+        minuend = await cg.get_variable(config[CONF_MINUEND])
+        subtrahend = await cg.get_variable(config[CONF_SUBTRAHEND])
+
+        # Create a new variable for the delta sensor.
+        var = cg.new_Pvariable(config[CONF_ID], minuend, subtrahend)
+        await sensor.register_sensor(var, config)
+
+        # Register delta sensor at the IVT Rego6xx control component.
+        cg.add(ivt_rego6xx_ctrl.registerDeltaSensor(var))
+
+    elif TYPE_DERIVED == config[CONF_TYPE]:
+        metric, unit, state_class, accuracy = DERIVED_METRICS[config[CONF_METRIC]]
+
+        # Create a new variable for the derived metric sensor.
+        var = cg.new_Pvariable(config[CONF_ID], metric)
+        await sensor.register_sensor(var, config)
+
+        # Defaults of the metric, unless they are configured.
+        if CONF_UNIT_OF_MEASUREMENT not in config:
+            cg.add(var.set_unit_of_measurement(unit))
+
+        if CONF_STATE_CLASS not in config:
+            cg.add(var.set_state_class(state_class))
+
+        if CONF_ACCURACY_DECIMALS not in config:
+            cg.add(var.set_accuracy_decimals(accuracy))
+
+        # Register derived metric sensor at the IVT Rego6xx control component.
+        cg.add(ivt_rego6xx_ctrl.registerDerivedSensor(var))
+
+    elif TYPE_AGGREGATE == config[CONF_TYPE]:
+        source = await cg.get_variable(config[CONF_SENSOR])
+
+        # Create a new variable for the aggregate sensor.
+        var = cg.new_Pvariable(config[CONF_ID], source, config[CONF_STATISTIC])
+        await sensor.register_sensor(var, config)
+
+        # Register aggregate sensor at the IVT Rego6xx control component.
+        cg.add(ivt_rego6xx_ctrl.registerAggregateSensor(var))
+
+    else:
+        # Create a new variable for the sensor.
+        var = cg.new_Pvariable(config[CONF_ID],
+                               config[CONF_IVT_REGO6XX_CMD],
+                               config[CONF_IVT_REGO6XX_ADDR])
+        await sensor.register_sensor(var, config)
+
+        # Add the optional variables.
+        if CONF_UNIT_OF_MEASUREMENT in config:
+            cg.add(var.set_unit_of_measurement(config[CONF_UNIT_OF_MEASUREMENT]))
+
+        if CONF_STATE_CLASS in config:
+            cg.add(var.set_state_class(config[CONF_STATE_CLASS]))
+
+        # Register sensor at the IVT Rego6xx control component.
+        cg.add(ivt_rego6xx_ctrl.registerSensor(var))
+
+        if CONF_MAX_AGE in config:
+            cg.add(ivt_rego6xx_ctrl.setMaxAge(var, config[CONF_MAX_AGE].total_milliseconds))
+
+        for profile, period in config.get(CONF_POLL_PERIODS, {}).items():
+            cg.add(ivt_rego6xx_ctrl.setPollPeriod(var, POLLING_PROFILES[profile], period.total_milliseconds))
+
+        if CONF_ADAPTIVE_SAMPLING in config:
+            adaptive_sampling = config[CONF_ADAPTIVE_SAMPLING]
+            cg.add(ivt_rego6xx_ctrl.setAdaptiveSampling(
+                var,
+                adaptive_sampling[CONF_MIN_PERIOD].total_milliseconds,
+                adaptive_sampling[CONF_MAX_PERIOD].total_milliseconds,
+                adaptive_sampling[CONF_TOLERANCE]
+            ))
+
+        if CONF_AGGREGATION in config:
+            aggregation = config[CONF_AGGREGATION]
+            cg.add(ivt_rego6xx_ctrl.setAggregation(
+                var,
+                aggregation[CONF_WINDOW].total_milliseconds,
+                aggregation[CONF_PUBLISH_SAMPLES]
+            ))
+
+        if CONF_HISTORY_SIZE in config:
+            cg.add(ivt_rego6xx_ctrl.setHistory(var, config[CONF_HISTORY_SIZE]))
 
 ################################################################################
 # Main
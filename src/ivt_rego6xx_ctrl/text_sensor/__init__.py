@@ -28,7 +28,7 @@ import esphome.codegen as cg # Code generation API
 import esphome.config_validation as cv # Configuration validation API
 from esphome.components import text_sensor # Text sensor component
 from esphome.const import CONF_ID, CONF_STATE_CLASS
-from .. import ivt_rego6xx_ctrl_ns # IVT Rego6xx control component namespace
+from .. import ivt_rego6xx_ctrl_ns, POLL_PERIODS_SCHEMA, POLLING_PROFILES # IVT Rego6xx control component namespace
 
 ################################################################################
 # Variables
@@ -45,6 +45,8 @@ ivt_rego6xx_text_sensor = ivt_rego6xx_ctrl_ns.class_(
 CONF_IVT_REGO6XX_CTRL_ID = "ivt_rego6xx_ctrl_id"
 CONF_IVT_REGO6XX_CMD = "ivt_rego6xx_ctrl_cmd"
 CONF_IVT_REGO6XX_ADDR = "ivt_rego6xx_ctrl_addr"
+CONF_MAX_AGE = "max_age"
+CONF_POLL_PERIODS = "poll_periods"
 
 # The configuration schema is automatically loaded by the ESPHome core and used to validate
 # the provided configuration. See https://esphome.io/guides/contributing#config-validation
@@ -56,6 +58,10 @@ CONFIG_SCHEMA = text_sensor.text_sensor_schema(ivt_rego6xx_text_sensor).extend(
         cv.Required(CONF_IVT_REGO6XX_CTRL_ID): cv.use_id(ivt_rego6xx_ctrl_ns.IVTRego6xxCtrl),
         cv.Required(CONF_IVT_REGO6XX_CMD): cv.hex_int_range(0x00, 0x7F),
         cv.Required(CONF_IVT_REGO6XX_ADDR): cv.hex_int_range(0x0000, 0x0300),
+
+        # Optional variables
+        cv.Optional(CONF_MAX_AGE): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_POLL_PERIODS): POLL_PERIODS_SCHEMA,
     })
 )
 
@@ -85,6 +91,12 @@ async def to_code(config: dict) -> None:
     ivt_rego6xx_ctrl = await cg.get_variable(config[CONF_IVT_REGO6XX_CTRL_ID])
     cg.add(ivt_rego6xx_ctrl.registerTextSensor(var))
 
+    if CONF_MAX_AGE in config:
+        cg.add(ivt_rego6xx_ctrl.setMaxAge(var, config[CONF_MAX_AGE].total_milliseconds))
+
+    for profile, period in config.get(CONF_POLL_PERIODS, {}).items():
+        cg.add(ivt_rego6xx_ctrl.setPollPeriod(var, POLLING_PROFILES[profile], period.total_milliseconds))
+
 ################################################################################
 # Main
 ################################################################################
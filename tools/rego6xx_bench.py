@@ -0,0 +1,166 @@
+# MIT License
+#
+# Copyright (c) 2026 Andreas Merkle (web@blue-andi.de)
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""
+Compare the microbenchmark results of a device log with reference results,
+which were recorded on the same board with the same build flags.
+
+Usage:
+    esphome logs IVTRego6xxCtrl.yaml > before.log
+    python tools/rego6xx_bench.py before.log --save before.csv --board "ESP32-POE-ISO, -O2"
+    esphome logs IVTRego6xxCtrl.yaml > after.log
+    python tools/rego6xx_bench.py after.log --reference before.csv
+"""
+
+################################################################################
+# Imports
+################################################################################
+
+import argparse
+import csv
+import re
+import sys
+
+################################################################################
+# Variables
+################################################################################
+
+# Result line, logged by IVTRego6xxBenchmark.
+RESULT_PATTERN = re.compile(r"BENCH\s+(.+?)\s+([0-9.]+) ns/op\s+([0-9.]+) allocs/op")
+
+################################################################################
+# Functions
+################################################################################
+
+def read_log(file_name: str) -> dict:
+    """
+    Read the benchmark results from a device log.
+
+    Args:
+        file_name (str): Log file name
+
+    Returns:
+        dict: Benchmark name -> (ns/op, allocs/op)
+    """
+    results = {}
+
+    with open(file_name, "r", encoding="utf-8", errors="replace") as file:
+        for line in file:
+            match = RESULT_PATTERN.search(line)
+
+            if match is not None:
+                results[match.group(1)] = (float(match.group(2)), float(match.group(3)))
+
+    return results
+
+def read_reference(file_name: str) -> dict:
+    """
+    Read the reference results.
+
+    Args:
+        file_name (str): Reference file name
+
+    Returns:
+        dict: Benchmark name -> (ns/op, allocs/op)
+    """
+    results = {}
+
+    with open(file_name, "r", encoding="utf-8") as file:
+        rows = (line for line in file if not line.startswith("#"))
+
+        for row in csv.DictReader(rows):
+            results[row["name"]] = (float(row["ns_per_op"]), float(row["allocs_per_op"]))
+
+    return results
+
+def save_reference(file_name: str, results: dict, board: str) -> None:
+    """
+    Write the results as reference for later runs.
+
+    Args:
+        file_name (str): Reference file name
+        results (dict): Benchmark name -> (ns/op, allocs/op)
+        board (str): Board and build flags, the results were recorded with
+    """
+    with open(file_name, "w", encoding="utf-8", newline="") as file:
+        file.write("# Rego6xx microbenchmark results, recorded with tools/rego6xx_bench.py --save.\n")
+        file.write(f"# Board and build flags: {board}\n")
+        writer = csv.writer(file, lineterminator="\n")
+        writer.writerow(["name", "ns_per_op", "allocs_per_op"])
+
+        for name, (ns_per_op, allocs_per_op) in results.items():
+            writer.writerow([name, f"{ns_per_op:.1f}", f"{allocs_per_op:.2f}"])
+
+def main() -> int:
+    """
+    Main entry point.
+
+    Returns:
+        int: Exit status
+    """
+    parser = argparse.ArgumentParser(description="Compare Rego6xx microbenchmark results with reference results.")
+    parser.add_argument("log", help="Device log, which contains the benchmark results.")
+    parser.add_argument("--reference", help="Reference results of the same board and build flags.")
+    parser.add_argument("--save", help="Save the results as reference to this file.")
+    parser.add_argument("--board", default="unknown", help="Board and build flags, stored with the saved results.")
+    args = parser.parse_args()
+
+    results = read_log(args.log)
+
+    if 0 == len(results):
+        print("No benchmark results found.", file=sys.stderr)
+        return 1
+
+    reference = {}
+
+    if args.reference is not None:
+        reference = read_reference(args.reference)
+
+    print(f"{'Benchmark':<26} {'ns/op':>10} {'ref':>10} {'delta':>8} {'allocs/op':>10} {'ref':>10}")
+
+    for name, (ns_per_op, allocs_per_op) in results.items():
+        ref_ns = "-"
+        ref_allocs = "-"
+        delta = "-"
+
+        if name in reference:
+            ref_ns_per_op, ref_allocs_per_op = reference[name]
+            ref_ns = f"{ref_ns_per_op:.1f}"
+            ref_allocs = f"{ref_allocs_per_op:.2f}"
+
+            if 0.0 < ref_ns_per_op:
+                delta = f"{(ns_per_op - ref_ns_per_op) * 100.0 / ref_ns_per_op:+.1f}%"
+
+        print(f"{name:<26} {ns_per_op:>10.1f} {ref_ns:>10} {delta:>8} {allocs_per_op:>10.2f} {ref_allocs:>10}")
+
+    if args.save is not None:
+        save_reference(args.save, results, args.board)
+        print(f"Results saved to {args.save}.")
+
+    return 0
+
+################################################################################
+# Main
+################################################################################
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,208 @@
+# MIT License
+#
+# Copyright (c) 2026 Andreas Merkle (web@blue-andi.de)
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""
+Decode a compressed sample history to CSV,
+see src/ivt_rego6xx_ctrl/IVTRego6xxHistory.h.
+
+Usage: python tools/rego6xx_history.py history.bin > history.csv
+"""
+
+################################################################################
+# Imports
+################################################################################
+
+import argparse
+import struct
+import sys
+
+################################################################################
+# Variables
+################################################################################
+
+# File header: magic, version, number of sensors, reserved, uptime in s of the export
+HEADER_FORMAT = "<4sBBHI"
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+MAGIC = b"R6HS"
+VERSION = 1
+
+# Block header: sensor index, reserved, data size, uptime in s and raw value of the first sample, reserved
+BLOCK_HEADER_FORMAT = "<BBHIhH"
+BLOCK_HEADER_SIZE = struct.calcsize(BLOCK_HEADER_FORMAT)
+
+# First byte of a sample, whose deltas follow as varints.
+ESCAPE = 0x80
+
+################################################################################
+# Functions
+################################################################################
+
+def decode_varint(data: bytes, pos: int) -> tuple:
+    """
+    Decode a LEB128 varint.
+
+    Args:
+        data (bytes): Sample data
+        pos (int): Position of the varint
+
+    Returns:
+        tuple: Value and position after the varint
+    """
+    value = 0
+    shift = 0
+
+    while True:
+        if pos >= len(data):
+            raise ValueError("Truncated varint.")
+
+        byte = data[pos]
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        pos += 1
+
+        if 0 == (byte & 0x80):
+            break
+
+    return value, pos
+
+def decode_zigzag(value: int) -> int:
+    """
+    Map a zigzag encoded value back to the signed value.
+
+    Args:
+        value (int): Zigzag encoded value
+
+    Returns:
+        int: Signed value
+    """
+    return (value >> 1) ^ -(value & 1)
+
+def decode_block(start_time: int, start_value: int, data: bytes):
+    """
+    Decode the samples of a block.
+
+    Args:
+        start_time (int): Uptime in s of the first sample
+        start_value (int): Raw value of the first sample
+        data (bytes): Sample data
+
+    Yields:
+        tuple: Uptime in s and raw value of every sample.
+    """
+    time = start_time
+    value = start_value
+    time_delta = 0
+    pos = 0
+
+    yield time, value
+
+    while pos < len(data):
+        if ESCAPE != data[pos]:
+            # 7-bit two's complement value delta, unchanged timestamp delta
+            delta = data[pos]
+            value += delta - 0x80 if 0 != (delta & 0x40) else delta
+            pos += 1
+        else:
+            dod, pos = decode_varint(data, pos + 1)
+            delta, pos = decode_varint(data, pos)
+            time_delta += decode_zigzag(dod)
+            value += decode_zigzag(delta)
+
+        time += time_delta
+
+        yield time, value
+
+def read_samples(data: bytes):
+    """
+    Parse a history.
+
+    Args:
+        data (bytes): History incl. file header
+
+    Yields:
+        tuple: Sensor name, uptime in s and raw value of every sample.
+    """
+    if len(data) < HEADER_SIZE:
+        raise ValueError("History is too short.")
+
+    magic, version, count, _reserved, now = struct.unpack_from(HEADER_FORMAT, data, 0)
+
+    if magic != MAGIC:
+        raise ValueError("Not a Rego6xx history.")
+
+    if version != VERSION:
+        raise ValueError(f"Unsupported history version {version}.")
+
+    pos = HEADER_SIZE
+    names = []
+
+    for _ in range(count):
+        if pos >= len(data):
+            raise ValueError("History is too short.")
+
+        size = data[pos]
+        names.append(data[pos + 1:pos + 1 + size].decode("utf-8", errors="replace"))
+        pos += 1 + size
+
+    while pos + BLOCK_HEADER_SIZE <= len(data):
+        idx, _reserved, size, start_time, start_value, _reserved2 = struct.unpack_from(BLOCK_HEADER_FORMAT, data, pos)
+        pos += BLOCK_HEADER_SIZE
+
+        if (pos + size > len(data)) or (idx >= count):
+            break
+
+        for time, value in decode_block(start_time, start_value, data[pos:pos + size]):
+            yield names[idx], time, now - time, value
+
+        pos += size
+
+def main() -> int:
+    """
+    Main entry point.
+
+    Returns:
+        int: Exit status
+    """
+    parser = argparse.ArgumentParser(description="Decode a compressed sample history to CSV.")
+    parser.add_argument("history", help="History file, e.g. downloaded from /ivt_rego6xx/history.bin")
+    args = parser.parse_args()
+
+    with open(args.history, "rb") as file:
+        data = file.read()
+
+    try:
+        print("entity,uptime_s,age_s,value")
+
+        for name, time, age, value in read_samples(data):
+            print(f"{name},{time},{age},{value / 10.0:.1f}")
+    except ValueError as error:
+        print(error, file=sys.stderr)
+        return 1
+
+    return 0
+
+################################################################################
+# Main
+################################################################################
+
+if __name__ == "__main__":
+    sys.exit(main())
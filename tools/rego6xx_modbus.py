@@ -0,0 +1,182 @@
+# MIT License
+#
+# Copyright (c) 2026 Andreas Merkle (web@blue-andi.de)
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""
+Read and write the registers of the Modbus TCP server,
+see src/ivt_rego6xx_ctrl/IVTRego6xxModbusServer.h.
+
+Usage: python tools/rego6xx_modbus.py <host> read-input 0x0209 [count]
+       python tools/rego6xx_modbus.py <host> read-holding 0x006E [count]
+       python tools/rego6xx_modbus.py <host> write 0x006E 45.0 [46.0 ...]
+"""
+
+################################################################################
+# Imports
+################################################################################
+
+import argparse
+import socket
+import struct
+import sys
+
+################################################################################
+# Variables
+################################################################################
+
+# MBAP header: transaction id, protocol id, length, unit id
+MBAP_FORMAT = ">HHHB"
+MBAP_SIZE = struct.calcsize(MBAP_FORMAT)
+
+FC_READ_HOLDING_REGISTERS = 0x03
+FC_READ_INPUT_REGISTERS = 0x04
+FC_WRITE_MULTIPLE_REGISTERS = 0x10
+
+# Register value of a not yet read entity
+VALUE_UNKNOWN = 0x8000
+
+EXCEPTIONS = {
+    0x01: "illegal function",
+    0x02: "illegal data address",
+    0x03: "illegal data value",
+    0x04: "server device failure",
+    0x06: "server device busy"
+}
+
+################################################################################
+# Functions
+################################################################################
+
+def receive(sock: socket.socket, size: int) -> bytes:
+    """
+    Receive a number of bytes.
+
+    Args:
+        sock (socket.socket): Connected socket
+        size (int): Number of bytes
+
+    Returns:
+        bytes: Received bytes
+    """
+    data = b""
+
+    while len(data) < size:
+        chunk = sock.recv(size - len(data))
+
+        if not chunk:
+            raise ValueError("Connection closed.")
+
+        data += chunk
+
+    return data
+
+def request(sock: socket.socket, transaction_id: int, pdu: bytes) -> bytes:
+    """
+    Send a request and receive its response.
+
+    Args:
+        sock (socket.socket): Connected socket
+        transaction_id (int): Transaction id
+        pdu (bytes): Request PDU
+
+    Returns:
+        bytes: Response PDU
+    """
+    sock.sendall(struct.pack(MBAP_FORMAT, transaction_id, 0, len(pdu) + 1, 1) + pdu)
+
+    rsp_transaction_id, _protocol_id, length, _unit_id = struct.unpack(MBAP_FORMAT, receive(sock, MBAP_SIZE))
+    rsp = receive(sock, length - 1)
+
+    if rsp_transaction_id != transaction_id:
+        raise ValueError("Unexpected transaction id.")
+
+    if 0 != (rsp[0] & 0x80):
+        raise ValueError(f"Exception {rsp[1]:#04x}: {EXCEPTIONS.get(rsp[1], 'unknown')}.")
+
+    return rsp
+
+def to_value(raw: int) -> str:
+    """
+    Convert a raw register value to text.
+
+    Args:
+        raw (int): Raw register value
+
+    Returns:
+        str: Value with one decimal or "unknown"
+    """
+    if VALUE_UNKNOWN == raw:
+        return "unknown"
+
+    return f"{struct.unpack('>h', struct.pack('>H', raw))[0] / 10.0:.1f}"
+
+def main() -> int:
+    """
+    Main entry point.
+
+    Returns:
+        int: Exit status
+    """
+    parser = argparse.ArgumentParser(description="Read and write the registers of the Modbus TCP server.")
+    parser.add_argument("host", help="Host name or IP address of the device")
+    parser.add_argument("--port", type=int, default=502, help="TCP port")
+    subparsers = parser.add_subparsers(dest="command", required=True)
+
+    for command in ("read-input", "read-holding"):
+        read_parser = subparsers.add_parser(command, help=f"Read {command[5:]} registers")
+        read_parser.add_argument("addr", type=lambda text: int(text, 0), help="Address of the first register")
+        read_parser.add_argument("count", type=int, nargs="?", default=1, help="Number of registers")
+
+    write_parser = subparsers.add_parser("write", help="Write holding registers")
+    write_parser.add_argument("addr", type=lambda text: int(text, 0), help="Address of the first register")
+    write_parser.add_argument("values", type=float, nargs="+", help="Values, e.g. 21.5")
+
+    args = parser.parse_args()
+
+    try:
+        with socket.create_connection((args.host, args.port), timeout=15) as sock:
+            if "write" == args.command:
+                raws = [round(value * 10) & 0xFFFF for value in args.values]
+                pdu = struct.pack(">BHHB", FC_WRITE_MULTIPLE_REGISTERS, args.addr, len(raws), 2 * len(raws))
+                pdu += struct.pack(f">{len(raws)}H", *raws)
+
+                # The response is sent after the heatpump confirmed the write.
+                request(sock, 1, pdu)
+                print(f"Wrote {len(raws)} registers.")
+            else:
+                function = FC_READ_INPUT_REGISTERS if "read-input" == args.command else FC_READ_HOLDING_REGISTERS
+                rsp = request(sock, 1, struct.pack(">BHH", function, args.addr, args.count))
+                raws = struct.unpack_from(f">{args.count}H", rsp, 2)
+
+                for idx, raw in enumerate(raws):
+                    print(f"{args.addr + idx:#06x}: {to_value(raw)}")
+    except (OSError, ValueError) as error:
+        print(error, file=sys.stderr)
+        return 1
+
+    return 0
+
+################################################################################
+# Main
+################################################################################
+
+if __name__ == "__main__":
+    sys.exit(main())
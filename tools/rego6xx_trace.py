@@ -0,0 +1,189 @@
+# MIT License
+#
+# Copyright (c) 2026 Andreas Merkle (web@blue-andi.de)
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""
+Decode a Rego6xx UART traffic recording or protocol frame trace,
+see lib/Rego6xx/Rego6xxTrace.h.
+
+Usage: python tools/rego6xx_trace.py recording.bin
+       python tools/rego6xx_trace.py frames.bin
+"""
+
+################################################################################
+# Imports
+################################################################################
+
+import argparse
+import struct
+import sys
+
+################################################################################
+# Variables
+################################################################################
+
+# File header: magic, version, flags, reserved
+HEADER_FORMAT = "<4sBBH"
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+MAGIC = b"R6TR"
+VERSION = 1
+
+# Record header: timestamp in us, direction (bit 7) and data size (bit 0-6)
+RECORD_HEADER_FORMAT = "<IB"
+RECORD_HEADER_SIZE = struct.calcsize(RECORD_HEADER_FORMAT)
+
+DIR_TX = 0
+DIR_RX = 1
+
+COMMAND_NAMES = {
+    0x00: "Read front panel",
+    0x01: "Write front panel",
+    0x02: "Read system register",
+    0x03: "Write system register",
+    0x04: "Read timer register",
+    0x05: "Write timer register",
+    0x06: "Read register 1B61",
+    0x07: "Write register 1B61",
+    0x20: "Read display",
+    0x40: "Read last error",
+    0x42: "Read previous error",
+    0x7F: "Read REGO version"
+}
+
+################################################################################
+# Functions
+################################################################################
+
+def read_records(data: bytes):
+    """
+    Parse a trace.
+
+    Args:
+        data (bytes): Trace incl. file header
+
+    Yields:
+        tuple: Timestamp in us, direction and data bytes of every record.
+    """
+    if len(data) < HEADER_SIZE:
+        raise ValueError("Trace is too short.")
+
+    magic, version, _flags, _reserved = struct.unpack_from(HEADER_FORMAT, data, 0)
+
+    if magic != MAGIC:
+        raise ValueError("Not a Rego6xx trace.")
+
+    if version != VERSION:
+        raise ValueError(f"Unsupported trace version {version}.")
+
+    pos = HEADER_SIZE
+
+    while pos + RECORD_HEADER_SIZE <= len(data):
+        timestamp, info = struct.unpack_from(RECORD_HEADER_FORMAT, data, pos)
+        size = info & 0x7F
+        direction = DIR_RX if 0 != (info & 0x80) else DIR_TX
+        pos += RECORD_HEADER_SIZE
+
+        if pos + size > len(data):
+            break
+
+        yield timestamp, direction, data[pos:pos + size]
+        pos += size
+
+def describe_command(frame: bytes) -> str:
+    """
+    Describe a command frame.
+
+    Args:
+        frame (bytes): Command frame, which was sent to the heatpump controller.
+
+    Returns:
+        str: Description
+    """
+    description = ""
+
+    if len(frame) == 9:
+        cmd_id = frame[1]
+        addr = (frame[2] << 14) | (frame[3] << 7) | frame[4]
+        value = (frame[5] << 14) | (frame[6] << 7) | frame[7]
+        checksum = 0
+
+        for byte in frame[2:8]:
+            checksum ^= byte
+
+        name = COMMAND_NAMES.get(cmd_id, "Unknown command")
+        description = f"{name} (0x{cmd_id:02X}) addr=0x{addr:04X} value=0x{value:04X}"
+
+        if checksum != frame[8]:
+            description += " CHECKSUM ERROR"
+
+    return description
+
+def main() -> int:
+    """
+    Main entry point.
+
+    Returns:
+        int: Exit status
+    """
+    parser = argparse.ArgumentParser(description="Decode a Rego6xx UART traffic recording or protocol frame trace.")
+    parser.add_argument("trace", help="Trace file, e.g. downloaded from /ivt_rego6xx/recording.bin or /ivt_rego6xx/frames.bin")
+    args = parser.parse_args()
+
+    with open(args.trace, "rb") as file:
+        data = file.read()
+
+    start = None
+    last_tx = None
+
+    try:
+        for timestamp, direction, frame in read_records(data):
+            if start is None:
+                start = timestamp
+
+            hex_data = " ".join(f"{byte:02X}" for byte in frame)
+            rel = (timestamp - start) & 0xFFFFFFFF
+
+            if DIR_TX == direction:
+                last_tx = timestamp
+                print(f"{rel / 1000.0:12.3f} ms TX {hex_data}  {describe_command(frame)}")
+            else:
+                latency = ""
+
+                if last_tx is not None:
+                    latency = f"  +{((timestamp - last_tx) & 0xFFFFFFFF) / 1000.0:.3f} ms"
+
+                # The frame trace marks a response timeout by an empty receive record.
+                if 0 == len(frame):
+                    hex_data = "TIMEOUT"
+
+                print(f"{rel / 1000.0:12.3f} ms RX {hex_data}{latency}")
+    except ValueError as error:
+        print(error, file=sys.stderr)
+        return 1
+
+    return 0
+
+################################################################################
+# Main
+################################################################################
+
+if __name__ == "__main__":
+    sys.exit(main())